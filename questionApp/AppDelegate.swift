@@ -46,13 +46,21 @@ class AppDelegate: UIResponder, UIApplicationDelegate {
 //			BNLocalNotification.parseLocalNotification(launchOptions)
 //		}
 		
-		// TODO - add all test reminders to the milestones app reminders screen then
-		// remove all local notifications containing test reminders.
-		BNLocalNotification.clearAllLocalNotifications()
+		// Earlier versions called BNLocalNotification.clearAllLocalNotifications() here, which cancelled every scheduled
+		// test reminder at launch, so a reminder only fired if the app was not opened before its date. Reminders are now
+		// kept across launches and looked up through BNReminderIndex; only the badge is cleared.
+		// TODO - add all test reminders to the milestones app reminders screen.
+		UIApplication.sharedApplication().applicationIconBadgeNumber = 0
 		
 		// Setup the test monitor.
 		testMonitor = TestMonitor()
 		
+		// Repair the current profile's test histories from its result log, off the main thread.
+		let profileName = Parent.currentProfileName()
+		dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0)) {
+			ProfileStore.sharedStore.compactResultLog(profileName: profileName)
+		}
+		
 		// allow landscape mode when playing videos
 		NSNotificationCenter.defaultCenter().addObserver(self, selector: "moviePlayerPlaybackFullscreenStarted:", name: MPMoviePlayerWillEnterFullscreenNotification, object: nil)
 		NSNotificationCenter.defaultCenter().addObserver(self, selector: "moviePlayerPlaybackFullscreenEnded:", name: MPMoviePlayerWillExitFullscreenNotification, object: nil)
@@ -63,11 +71,15 @@ class AppDelegate: UIResponder, UIApplicationDelegate {
   func applicationWillResignActive(application: UIApplication) {
     // Sent when the application is about to move from active to inactive state. This can occur for certain types of temporary interruptions (such as an incoming phone call or SMS message) or when the user quits the application and it begins the transition to the background state.
     // Use this method to pause ongoing tasks, disable timers, and throttle down OpenGL ES frame rates. Games should use this method to pause the game.
+    // Hand batched analytics events to Mixpanel before it archives its queue in the background.
+    Tracker.flush()
   }
 
   func applicationDidEnterBackground(application: UIApplication) {
     // Use this method to release shared resources, save user data, invalidate timers, and store enough application state information to restore your application to its current state in case it is terminated later.
     // If your application supports background execution, this method is called instead of applicationWillTerminate: when the user quits.
+    // Write any pending test profile changes before the app can be suspended.
+    ProfileStore.sharedStore.flush()
   }
 
   func applicationWillEnterForeground(application: UIApplication) {
@@ -84,6 +96,8 @@ class AppDelegate: UIResponder, UIApplicationDelegate {
     // Called when the application is about to terminate. Save data if appropriate. See also applicationDidEnterBackground:.
     // Saves changes in the application's managed object context before the application terminates.
     self.saveContext()
+    ProfileStore.sharedStore.flush()
+    Tracker.flush()
   }
 	
 	func application(application: UIApplication, didReceiveLocalNotification notification: UILocalNotification) {
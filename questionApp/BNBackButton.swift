@@ -20,7 +20,15 @@ class BNBackButton: UIButton {
   
   required init?(coder aDecoder: NSCoder) {
     super.init(coder: aDecoder)
-    
+    setupAppearance()
+  }
+  
+  override init(frame: CGRect) {
+    super.init(frame: frame)
+    setupAppearance()
+  }
+  
+  func setupAppearance() {
     self.setTitle("", forState: .Normal)
     self.imageView?.contentMode = UIViewContentMode.Center
 //    self.setBackgroundImage(UIImage(named: "backIcon"), forState: .Normal)
@@ -14,7 +14,11 @@ class BNButton: UIButton {
   // An empty implementation adversely affects performance during animation.
   required init?(coder aDecoder: NSCoder) {
     super.init(coder: aDecoder)
-    // Drawing code
+    setupAppearance()
+  }
+  
+  // Shared by both initializers so buttons created in code match the storyboard buttons.
+  func setupAppearance() {
     self.layer.cornerRadius = 7
     self.clipsToBounds = true
     self.titleLabel?.font = UIFont(name: kOmnesFontMedium, size: 20)
@@ -38,5 +42,6 @@ class BNButton: UIButton {
 	
 	override init(frame: CGRect) {
 		super.init(frame: frame)
+		setupAppearance()
 	}
 }
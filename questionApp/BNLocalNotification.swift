@@ -39,11 +39,16 @@ class BNLocalNotification {
   }
   
   static let LocalNotificationInfoDictionaryTestNameKey = "NotificationTestName"
+  static let LocalNotificationInfoDictionaryProfileNameKey = "NotificationProfileName"
   
   /* Set testName to a TestNamesPresentable member to identify the test. (See Test.TestNamesPresentable) This testName will be used in the Reminder presented to the user.
   */
   var testName: String? = nil
   
+  /* The profile the reminder belongs to. Defaults to the current profile (see Parent.currentProfileName()), so reminders of siblings testing the same milestone are kept apart.
+  */
+  var profileName: String = Parent.currentProfileName()
+  
   /* Set elapsedSecondsBeforePresentingReminder to identify the number of seconds from now that should elapse before the reminder is presented to the user.
   */
   var elapsedSecondsBeforePresentingReminder: Double = NotificationConstants.defaultInterval // 2 weeks in seconds by default
@@ -88,12 +93,22 @@ class BNLocalNotification {
 
     // Specify the test in the userInfo property so the app knows which test to display when it is launched.
     if let testName = testName {
-      let infoDictionary = [BNLocalNotification.LocalNotificationInfoDictionaryTestNameKey : testName]
+      let infoDictionary = [BNLocalNotification.LocalNotificationInfoDictionaryTestNameKey : testName,
+                            BNLocalNotification.LocalNotificationInfoDictionaryProfileNameKey : profileName]
       localNotification.userInfo = infoDictionary
     }
     
-    // schedule the notification
     localNotification.fireDate = NSDate(timeIntervalSinceNow: elapsedSecondsBeforePresentingReminder)
+    
+    // Keep one reminder per test and profile so the index matches the system list. The index is updated
+    // before scheduling, since it may read the system list and must not mistake the new reminder for the previous one.
+    if let testName = testName {
+      if let previous = BNReminderIndex.sharedIndex.add(localNotification, testName: testName, profileName: profileName) {
+        UIApplication.sharedApplication().cancelLocalNotification(previous)
+      }
+    }
+    
+    // schedule the notification
     UIApplication.sharedApplication().scheduleLocalNotification(localNotification)
     
     // Send a notification indicating that a reminder has been scheduled.
@@ -263,6 +278,8 @@ class BNLocalNotification {
     
     // remove the local notification
     UIApplication.sharedApplication().cancelLocalNotification(localNotification)
+    let profileName = localNotification.userInfo?[BNLocalNotification.LocalNotificationInfoDictionaryProfileNameKey] as? String ?? Parent.currentProfileName()
+    BNReminderIndex.sharedIndex.remove(testName: testName, profileName: profileName)
     
     // Send a notification indicating that a reminder has been removed.
     BNLocalNotification.postTestReminderRemovedNotification(testName)
@@ -301,9 +318,7 @@ class BNLocalNotification {
       controller = storyboard.instantiateViewControllerWithIdentifier(storyboardID!) as! WhyIsPointFollowingViewController
       
     case Test.TestNamesPresentable.hearing: // Hearing
-      storyboardID = "WhyIsHearingStoryboardID"
-      var storyboard = UIStoryboard (name: "Hearing", bundle: nil)
-      controller = storyboard.instantiateViewControllerWithIdentifier(storyboardID!) as! WhyIsHearingViewController
+      controller = TestFlowCoordinator.firstViewControllerForTest(Test.TestNames.hearing)
       
     case Test.TestNamesPresentable.crossingEyes: // Crossing Eyes
       storyboardID = "WhyIsCrossingEyesStoryboardID"
@@ -389,58 +404,29 @@ class BNLocalNotification {
   
   /*!
   @brief Remove a local notification if the test was passed in the interim.
-  @discussion If the local notification was previously scheduled, this function will remove it by searching all local notifications for the proper userInfo key containing the test's name.
+  @discussion If the local notification was previously scheduled for the current profile, this function will remove it using the reminder index (see BNReminderIndex). Reminders of other profiles for the same test are kept.
   @param (in) testName - The name of the test whose local notification is to be deleted. Use a Test.TestNamesPresentable value. (cannot be nil)
   */
   static func removeLocalNotification(testName: String) {
     
-    var theApp:UIApplication = UIApplication.sharedApplication()
-    
-    // Iterate through all local notifications to find one containing testName in the userInfo and delete it.
-    for locNotif in theApp.scheduledLocalNotifications! {
-      var notification = locNotif as UILocalNotification!
-      let notificationUserInfo = notification.userInfo! as! [String:AnyObject]
-      let notificationTestName = notificationUserInfo[BNLocalNotification.LocalNotificationInfoDictionaryTestNameKey]! as! String
-      if notificationTestName == testName {
-                // TODO: add profile name to the userInfo and only delete if same profile name
-                //        in other words, the first child fails repeatedly, while the 2nd fails then passes. Only delete the notification belonging to the second child.
-        
-        // match! Cancel this local notification.
-        theApp.cancelLocalNotification(notification)
-        
-        // Send a notification indicating that a reminder has been removed.
-        BNLocalNotification.postTestReminderRemovedNotification(testName)
-        break
-      }
+    if let notification = BNReminderIndex.sharedIndex.remove(testName: testName, profileName: Parent.currentProfileName()) {
+      
+      // match! Cancel this local notification.
+      UIApplication.sharedApplication().cancelLocalNotification(notification)
+      
+      // Send a notification indicating that a reminder has been removed.
+      BNLocalNotification.postTestReminderRemovedNotification(testName)
     }
   }
   
   /*!
-  @brief Determine if a local notification exists that contains testName in userInfo.
+  @brief Determine if a local notification exists for the current profile that contains testName in userInfo.
+  @discussion This is a lookup in the reminder index, so it is cheap enough to call from viewWillAppear.
   @param (in) testName - The name of the test to be found in the userInfo of a local notification. Use a Test.TestNamesPresentable value. (cannot be nil)
   @return Returns true if testName is found in the userInfo of a local notification, else returns false.
   */
   static func doesLocalNotificationExist(testName: String) -> Bool {
-    
-    // Iterate through all local notifications to find one containing testName in the userInfo.
-    var theApp:UIApplication = UIApplication.sharedApplication()
-    for locNotif in theApp.scheduledLocalNotifications! {
-      
-      var notification = locNotif as! UILocalNotification
-      let notificationUserInfo = notification.userInfo! as! [String:AnyObject]
-      let notificationTestName = notificationUserInfo[BNLocalNotification.LocalNotificationInfoDictionaryTestNameKey]! as! String
-      
-      if notificationTestName == testName {
-        // TODO: add profile name to the userInfo and only delete if same profile name
-        //        in other words, the first child fails repeatedly, while the 2nd fails then passes. Only delete the notification belonging to the second child.
-        
-        // Match! Found a local notification containing testName in userInfo.
-        return true
-      }
-    }
-    
-    // No local notification was found containing testName in userInfo.
-    return false
+    return BNReminderIndex.sharedIndex.fireDate(testName: testName, profileName: Parent.currentProfileName()) != nil
   }
   
   /*
@@ -491,6 +477,7 @@ class BNLocalNotification {
   static func clearAllLocalNotifications() {
     UIApplication.sharedApplication().applicationIconBadgeNumber = 0
     UIApplication.sharedApplication().cancelAllLocalNotifications()
+    BNReminderIndex.sharedIndex.removeAll()
   }
   
   /*
@@ -60,5 +60,18 @@ class BNMilestonePieChartView: PieChartView {
         
     }
     
+    /*
+    @brief Configure the chart with the passed and failed attempts recorded in a profile's result log.
+    @param resultLog (in) The result log of the profile to chart. (cannot be nil)
+    @param testNames (in) The tests to include, e.g. Test.TestNamesByCategory.sensoryAndMotor. Pass nil for all tests.
+    @param from (in) Earliest attempt date to include. Pass nil for no lower bound.
+    @param to (in) Date to stop before. Pass nil for no upper bound.
+    */
+    func config(resultLog log: TestResultLog, testNames: [String]?, from: NSDate?, to: NSDate?) {
+        let counts = log.outcomeCounts(testNames: testNames, from: from, to: to)
+        // an empty data point label is drawn as the incomplete (white) slice
+        config(["passed", ""], values: [Double(counts.passed), Double(counts.failed)])
+    }
+    
     
 }
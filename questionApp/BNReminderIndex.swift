@@ -0,0 +1,174 @@
+/*!
+@header BNReminderIndex.swift
+
+@brief This file contains the BNReminderIndex class, an in-memory index of scheduled test reminders keyed by profile name and test name.
+@discussion BNLocalNotification keeps the index in sync as reminders are scheduled, handled and removed, so checking whether a test has a reminder is a dictionary lookup rather than a scan of UIApplication.scheduledLocalNotifications. The fire date of each reminder is persisted next to the profile store, and lookups are answered from that file. The system list is only read when a scheduled UILocalNotification itself is needed (to cancel or replace a reminder), or when there is no persisted index yet; the index is then reconciled with it.
+
+@copyright 2015 Qidza, Inc.
+*/
+
+import UIKit
+
+class BNReminderIndex {
+
+  /* The shared index. Must only be used on the main thread. */
+  static let sharedIndex = BNReminderIndex()
+
+  // The name of the file, in the profile store directory, where reminder fire dates are persisted.
+  static let filename = "Reminders.plist"
+
+  /* Scheduled notifications keyed by profile name, then test name. Populated by scheduling and by loadScheduledNotificationsIfNeeded(). */
+  private var notifications = [String : [String : UILocalNotification]]()
+
+  /* Fire dates keyed by profile name, then test name. This is what is persisted. */
+  private var fireDates = [String : [String : NSDate]]()
+
+  /* true once fireDates has been read from filePath, or rebuilt from the system list. */
+  private var loaded = false
+
+  /* true once notifications has been filled from UIApplication.scheduledLocalNotifications. */
+  private var scheduledNotificationsLoaded = false
+
+  /* Serializes writes of the persisted index. */
+  private let writeQueue = dispatch_queue_create("com.qidza.reminderIndex", DISPATCH_QUEUE_SERIAL)
+
+  /** The path to the persisted index, in the same directory as the profile store shards. */
+  lazy var filePath: String = {
+    return (TestProfiles().storeDirectoryPath as NSString).stringByAppendingPathComponent(BNReminderIndex.filename)
+  }()
+
+  /*
+  @brief Get the fire date of the reminder scheduled for a test of a profile.
+  @return The fire date, else nil if no reminder is pending for testName in profileName.
+  */
+  func fireDate(testName testName: String, profileName: String) -> NSDate? {
+    loadIfNeeded()
+    if let fireDate = fireDates[profileName]?[testName] {
+      if fireDate.timeIntervalSinceNow > 0 {
+        return fireDate
+      }
+      // the reminder has already been delivered, so it is no longer scheduled
+      fireDates[profileName]?[testName] = nil
+      notifications[profileName]?[testName] = nil
+      save()
+    }
+    return nil
+  }
+
+  /*
+  @brief Record a reminder for a test of a profile.
+  @discussion Call before passing notification to UIApplication.scheduleLocalNotification(), since this may read the system list to find the previous reminder.
+  @return The reminder previously recorded for testName in profileName, if any, so the caller can cancel it.
+  */
+  func add(notification: UILocalNotification, testName: String, profileName: String) -> UILocalNotification? {
+    loadScheduledNotificationsIfNeeded()
+    let previous = notifications[profileName]?[testName]
+    BNReminderIndex.set(&notifications, profileName, testName, notification)
+    if let fireDate = notification.fireDate {
+      BNReminderIndex.set(&fireDates, profileName, testName, fireDate)
+    }
+    save()
+    return previous
+  }
+
+  /*
+  @brief Remove the reminder recorded for a test of a profile.
+  @return The scheduled notification, else nil if no reminder was recorded for testName in profileName.
+  */
+  func remove(testName testName: String, profileName: String) -> UILocalNotification? {
+    loadIfNeeded()
+    let hadReminder = fireDates[profileName]?[testName] != nil || notifications[profileName]?[testName] != nil
+    if !hadReminder {
+      // nothing to cancel, so there is no need to read the system list
+      return nil
+    }
+    loadScheduledNotificationsIfNeeded() = fireDates[profileName]?[testName] != nil || notifications[profileName]?[testName] != nil
+    let notification = notifications[profileName]?.removeValueForKey(testName)
+    fireDates[profileName]?[testName] = nil
+    save()
+    return notification
+  }
+
+  /* Forget all reminders, of every profile. */
+  func removeAll() {
+    notifications.removeAll()
+    fireDates.removeAll()
+    loaded = true
+    scheduledNotificationsLoaded = true
+    save()
+  }
+
+  // MARK: Persistence
+
+  /* Read the persisted fire dates. Without a persisted index (first launch of this version) it is built from the system list instead. */
+  private func loadIfNeeded() {
+    if loaded {
+      return
+    }
+    loaded = true
+    if let stored = NSDictionary(contentsOfFile: filePath) as? [String : [String : NSDate]] {
+      fireDates = stored
+    } else {
+      loadScheduledNotificationsIfNeeded()
+    }
+  }
+
+  /*
+  Fill notifications from UIApplication.scheduledLocalNotifications, which is slow to read, and make the fire dates match it.
+  Reminders scheduled before notifications carried a profile name are filed under the current profile.
+  */
+  private func loadScheduledNotificationsIfNeeded() {
+    if scheduledNotificationsLoaded {
+      return
+    }
+    scheduledNotificationsLoaded = true
+    loaded = true
+    var scheduled = [String : [String : UILocalNotification]]()
+    var dates = [String : [String : NSDate]]()
+    for notification in UIApplication.sharedApplication().scheduledLocalNotifications ?? [] {
+      if let testName = notification.userInfo?[BNLocalNotification.LocalNotificationInfoDictionaryTestNameKey] as? String {
+        let profileName = notification.userInfo?[BNLocalNotification.LocalNotificationInfoDictionaryProfileNameKey] as? String ?? Parent.currentProfileName()
+        BNReminderIndex.set(&scheduled, profileName, testName, notification)
+        if let fireDate = notification.fireDate {
+          BNReminderIndex.set(&dates, profileName, testName, fireDate)
+        }
+      }
+    }
+    notifications = scheduled
+    if !BNReminderIndex.equal(dates, fireDates) {
+      fireDates = dates
+      save()
+    }
+  }
+
+  /*
+  @brief Write the fire dates in the background.
+  @discussion Every write replaces the whole file, so a failed write is retried by the next change to the index.
+  */
+  private func save() {
+    let dates = fireDates as NSDictionary
+    let path = filePath
+    dispatch_async(writeQueue) {
+      do {
+        let directory = (path as NSString).stringByDeletingLastPathComponent
+        try NSFileManager.defaultManager().createDirectoryAtPath(directory, withIntermediateDirectories: true, attributes: nil)
+        let data = try NSPropertyListSerialization.dataWithPropertyList(dates, format: .BinaryFormat_v1_0, options: 0)
+        try data.writeToFile(path, options: .DataWritingAtomic)
+      } catch let error as NSError {
+        NSLog("BNReminderIndex: failed to write \(path): \(error), \(error.userInfo)")
+      }
+    }
+  }
+
+  /* Set the value for a test of a profile, adding the profile's dictionary if needed. */
+  private static func set<T>(inout index: [String : [String : T]], _ profileName: String, _ testName: String, _ value: T) {
+    var tests = index[profileName] ?? [String : T]()
+    tests[testName] = value
+    index[profileName] = tests
+  }
+
+  /* Compare two persisted forms of the index. */
+  private static func equal(a: [String : [String : NSDate]], _ b: [String : [String : NSDate]]) -> Bool {
+    return (a as NSDictionary).isEqualToDictionary(b)
+  }
+}
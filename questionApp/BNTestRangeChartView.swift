@@ -15,7 +15,23 @@ class BNTestRangeChartView: HorizontalBarChartView {
     super.init(coder: aDecoder)
   }
   
-  func config(startMonth startMonth: Double, endMonth: Double, successAgeInMonths: Double, babyAgeInMonths: Double, babyName: String) {
+  override init(frame: CGRect) {
+    super.init(frame: frame)
+  }
+  
+  /*
+  @brief Configure the chart using the baby's attempts recorded in the profile's result log.
+  @discussion Adds a second bar at the age the baby first passed testName, if that age falls within the chart's range.
+  */
+  func config(startMonth startMonth: Double, endMonth: Double, successAgeInMonths: Double, babyAgeInMonths: Double, babyName: String, resultLog: TestResultLog, testName: String, birthday: NSDate?) {
+    var babySuccessAgeInMonths: Double? = nil
+    if let birthday = birthday, age = resultLog.ageInMonthsOfFirstSuccess(testName: testName, birthday: birthday) where age >= startMonth && age <= endMonth {
+      babySuccessAgeInMonths = age
+    }
+    config(startMonth: startMonth, endMonth: endMonth, successAgeInMonths: successAgeInMonths, babyAgeInMonths: babyAgeInMonths, babyName: babyName, babySuccessAgeInMonths: babySuccessAgeInMonths)
+  }
+  
+  func config(startMonth startMonth: Double, endMonth: Double, successAgeInMonths: Double, babyAgeInMonths: Double, babyName: String, babySuccessAgeInMonths: Double? = nil) {
     // customize chart before setting data
     self.noDataText = "No data to show you"
     self.drawGridBackgroundEnabled = false
@@ -75,8 +91,12 @@ class BNTestRangeChartView: HorizontalBarChartView {
     // data should be set after customizing chart
     var dataEntries: [BarChartDataEntry] = []
     
-    let dataPoints = ["Jan"]
+    var dataPoints = ["Jan"]
     var values = [successAgeInMonths]
+    if let babySuccessAgeInMonths = babySuccessAgeInMonths {
+      dataPoints.append(babyName)
+      values.append(babySuccessAgeInMonths)
+    }
     
     for i in 0..<dataPoints.count {
       let dataEntry = BarChartDataEntry(value: values[i], xIndex: i)
@@ -86,6 +106,9 @@ class BNTestRangeChartView: HorizontalBarChartView {
     let chartDataSet = BarChartDataSet(yVals: dataEntries, label: nil)
     chartDataSet.drawValuesEnabled = false
     chartDataSet.barSpace = 0.35
+    if babySuccessAgeInMonths != nil {
+      chartDataSet.colors = [chartDataSet.colorAt(0), kOrange]
+    }
     let chartData = BarChartData(xVals: dataPoints, dataSet: chartDataSet)
     self.data = chartData
     
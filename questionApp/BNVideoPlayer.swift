@@ -20,6 +20,49 @@ import AVFoundation
   @IBOutlet weak var previewThumbnail: UIImageView!
   @IBOutlet weak var playButton: UIButton!
   
+  /* The video shown for a test: the bundled .mp4 file name and the time in seconds of its preview thumbnail, if it shows one. */
+  typealias TestVideo = (file: String, time: Int32?)
+  
+  /* The videos of the storyboard tests, keyed by Test.TestNames value. Loaded from TestVideos.plist. */
+  static let videosByTest: [String:TestVideo] = {
+    var videos = [String:TestVideo]()
+    if let path = NSBundle.mainBundle().pathForResource("TestVideos", ofType: "plist"),
+      dictionary = NSDictionary(contentsOfFile: path) as? [String:[String:AnyObject]] {
+      for (testName, video) in dictionary {
+        if let file = video["file"] as? String {
+          videos[testName] = (file, (video["time"] as? Int).map { Int32($0) })
+        }
+      }
+    } else {
+      NSLog("BNVideoPlayer: TestVideos.plist is missing or invalid")
+    }
+    return videos
+  }()
+  
+  /*
+  @brief Get the video of a test.
+  @discussion Tests on the flow engine take theirs from their TestFlowDefinition, the others from TestVideos.plist.
+  @return The video, else nil if the test has none.
+  */
+  class func videoForTest(testName: String) -> TestVideo? {
+    if let definition = TestFlowDefinition.definitionForTest(testName), file = definition.videoFile {
+      return (file, definition.videoTime)
+    }
+    return videosByTest[testName]
+  }
+  
+  /* Set in the test storyboards. Sets videoFileName and videoTime from the test's entry in TestVideos.plist. */
+  @IBInspectable var testName: String = "" {
+    didSet {
+      #if !TARGET_INTERFACE_BUILDER
+        if let video = BNVideoPlayer.videoForTest(testName) {
+          videoFileName = video.file
+          videoTime = video.time ?? 0
+        }
+      #endif
+    }
+  }
+  
   @IBInspectable var videoFileName: String = "pincer grasp" {
     didSet {
       #if !TARGET_INTERFACE_BUILDER
@@ -91,35 +134,46 @@ import AVFoundation
   }
   
   func thumbnailOfVideo(time time: Int32 = 0){
-    let time = Int64(time)
-    let videoURL = NSBundle.mainBundle().URLForResource(videoFileInfo.path, withExtension: videoFileInfo.ext)
-    let asset = AVURLAsset(URL: videoURL!, options: nil)
-    let imgGenerator = AVAssetImageGenerator(asset: asset)
-    do {
-      let thumbnail = try imgGenerator.copyCGImageAtTime(CMTimeMake(time, 1), actualTime: nil)
-      previewThumbnail.image = UIImage(CGImage: thumbnail)
+    // thumbnails are generated in the background and cached; see BNVideoThumbnailCache
+    let fileInfo = videoFileInfo
+    BNVideoThumbnailCache.sharedCache.thumbnail(file: fileInfo.path, ext: fileInfo.ext, time: time) { [weak self] image in
+      // ignore the result if the video changed while the thumbnail was loading
+      if let strongSelf = self where strongSelf.videoFileInfo.path == fileInfo.path && strongSelf.videoTime == time {
+        strongSelf.previewThumbnail.image = image
+      }
     }
-    catch {
+  }
+  
+  var videoURL: NSURL? {
+    return NSBundle.mainBundle().URLForResource(videoFileInfo.path, withExtension: videoFileInfo.ext)
+  }
+  
+  override func didMoveToWindow() {
+    super.didMoveToWindow()
+    // load the video while the parent reads the instructions, so playback starts sooner after the tap
+    if let url = videoURL where window != nil {
+      BNVideoPlayerPool.sharedPool.preload(url: url)
     }
   }
   
   func playVideo() {
-    let videoPath = NSBundle.mainBundle().pathForResource(videoFileInfo.path, ofType: videoFileInfo.ext)
-    let url = NSURL(fileURLWithPath: videoPath!)
-    if let moviePlayer = MPMoviePlayerController(contentURL: url) {
-        self.player = moviePlayer
-        moviePlayer.view.frame = self.view.bounds
-        moviePlayer.prepareToPlay()
-        moviePlayer.scalingMode = .AspectFill
-        self.view.addSubview(moviePlayer.view)
-        moviePlayer.fullscreen = true
+    if let url = videoURL {
+      let moviePlayer = BNVideoPlayerPool.sharedPool.checkoutPlayer(url: url)
+      self.player = moviePlayer
+      moviePlayer.view.frame = self.view.bounds
+      moviePlayer.scalingMode = .AspectFill
+      self.view.addSubview(moviePlayer.view)
+      moviePlayer.fullscreen = true
+      moviePlayer.play()
     } else {
       debugPrint("Ops, something wrong when playing video.m4v")
     }
   }
   
   deinit {
-    self.player?.stop()
+    if let player = self.player {
+      BNVideoPlayerPool.sharedPool.recycle(player)
+    }
   }
   
   func handleTap() {
@@ -0,0 +1,128 @@
+//
+//  BNVideoPlayerPool.swift
+//  questionApp
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import MediaPlayer
+import AVFoundation
+
+/*
+A small pool of reusable MPMoviePlayerController instances.
+A player is only prepared when the parent taps play, since preparing a second player interrupts the one
+that is playing; the preview shown before that comes from BNVideoThumbnailCache. Before the tap, preload()
+reads the video's metadata with AVURLAsset, which does not touch any player, so preparing starts from a
+warm file. Players are returned to the pool with recycle() instead of being destroyed, so replaying a video
+reuses its prepared player.
+All methods must be called on the main thread.
+*/
+class BNVideoPlayerPool: NSObject {
+
+  static let sharedPool = BNVideoPlayerPool()
+
+  // The number of idle players kept. Each prepared player holds decoder resources, so keep this small.
+  static let maximumIdlePlayers = 2
+
+  // The number of preloaded assets kept, about the videos on screen and the one before it.
+  static let maximumPreloadedAssets = 3
+
+  // Idle players, least recently used first.
+  private var idlePlayers = [MPMoviePlayerController]()
+
+  // Assets loading or loaded by preload(), least recently requested first.
+  private var preloadedAssets = [AVURLAsset]()
+
+  override init() {
+    super.init()
+    NSNotificationCenter.defaultCenter().addObserver(self, selector: "onMemoryWarning:", name: UIApplicationDidReceiveMemoryWarningNotification, object: nil)
+  }
+
+  deinit {
+    NSNotificationCenter.defaultCenter().removeObserver(self)
+  }
+
+  /*
+  @brief Get a player for url, reusing an idle one when possible.
+  @discussion The caller owns the player until it is passed to recycle(). Call play() to start playback.
+  */
+  func checkoutPlayer(url url: NSURL) -> MPMoviePlayerController {
+    let player: MPMoviePlayerController
+    if let index = idleIndex(url) {
+      player = idlePlayers.removeAtIndex(index)
+    } else {
+      player = reusablePlayer() ?? MPMoviePlayerController()
+      player.contentURL = url
+    }
+    player.shouldAutoplay = true
+    player.prepareToPlay()
+    return player
+  }
+
+  /*
+  @brief Load a video's tracks and duration in the background, ahead of checkoutPlayer(url:).
+  @discussion Safe to call while another video is playing. Does nothing if an idle player already holds url.
+  */
+  func preload(url url: NSURL) {
+    if idleIndex(url) != nil {
+      return
+    }
+    if let index = preloadedAssets.indexOf({ $0.URL == url }) {
+      preloadedAssets.append(preloadedAssets.removeAtIndex(index))
+      return
+    }
+    let asset = AVURLAsset(URL: url, options: nil)
+    asset.loadValuesAsynchronouslyForKeys(["playable", "tracks", "duration"], completionHandler: nil)
+    preloadedAssets.append(asset)
+    while preloadedAssets.count > BNVideoPlayerPool.maximumPreloadedAssets {
+      preloadedAssets.removeFirst().cancelLoading()
+    }
+  }
+
+  /*
+  @brief Stop a checked out player and keep it for reuse. Its content stays prepared.
+  */
+  func recycle(player: MPMoviePlayerController) {
+    player.stop()
+    player.fullscreen = false
+    player.view.removeFromSuperview()
+    player.shouldAutoplay = false
+    addIdle(player)
+  }
+
+  // MARK: Helpers
+
+  private func idleIndex(url: NSURL) -> Int? {
+    return idlePlayers.indexOf { $0.contentURL == url }
+  }
+
+  // Take the least recently used idle player to load different content, once the pool is full.
+  private func reusablePlayer() -> MPMoviePlayerController? {
+    if idlePlayers.count >= BNVideoPlayerPool.maximumIdlePlayers {
+      return idlePlayers.removeFirst()
+    }
+    return nil
+  }
+
+  private func addIdle(player: MPMoviePlayerController) {
+    if let index = idlePlayers.indexOf({ $0 === player }) {
+      idlePlayers.removeAtIndex(index)
+    }
+    idlePlayers.append(player)
+    while idlePlayers.count > BNVideoPlayerPool.maximumIdlePlayers {
+      idlePlayers.removeFirst().stop()
+    }
+  }
+
+  func onMemoryWarning(notification: NSNotification) {
+    for player in idlePlayers {
+      player.stop()
+    }
+    idlePlayers.removeAll()
+    for asset in preloadedAssets {
+      asset.cancelLoading()
+    }
+    preloadedAssets.removeAll()
+  }
+}
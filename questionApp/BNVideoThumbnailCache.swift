@@ -0,0 +1,153 @@
+//
+//  BNVideoThumbnailCache.swift
+//  questionApp
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import AVFoundation
+
+/*
+Caches preview thumbnails of the bundled test videos in memory and on disk.
+Thumbnails are keyed by video file, extension and time. They are generated off the main thread
+with AVAssetImageGenerator the first time they are requested and read back from Library/Caches after that.
+*/
+class BNVideoThumbnailCache {
+
+  static let sharedCache = BNVideoThumbnailCache()
+
+  /* The thumbnail shown by a test's BNVideoPlayer, from the same table the players read. nil if the test shows no thumbnail. */
+  class func thumbnailForTest(testName: String) -> (file: String, time: Int32)? {
+    if let video = BNVideoPlayer.videoForTest(testName), time = video.time {
+      return (video.file, time)
+    }
+    return nil
+  }
+
+  // Thumbnails are generated no larger than this; the preview never fills more than the screen width.
+  static let maximumSize = CGSize(width: 750, height: 750)
+
+  private let memoryCache = NSCache()
+
+  // Generates and reads thumbnails. Serial so two requests for the same thumbnail generate it once.
+  private let workQueue = dispatch_queue_create("com.codehatcher.videoThumbnails", DISPATCH_QUEUE_SERIAL)
+
+  // Callbacks waiting for a thumbnail that is being loaded, keyed by cache key. Main thread only.
+  private var pending = [String:[(UIImage?) -> Void]]()
+
+  // Directory in Library/Caches. Includes the bundle version so thumbnails are regenerated when the videos change.
+  lazy var directoryPath: String = {
+    let caches = NSSearchPathForDirectoriesInDomains(.CachesDirectory, .UserDomainMask, true)[0]
+    let version = NSBundle.mainBundle().objectForInfoDictionaryKey("CFBundleVersion") as? String ?? "0"
+    return (caches as NSString).stringByAppendingPathComponent("VideoThumbnails-\(version)")
+  }()
+
+  init() {
+    memoryCache.countLimit = 12
+  }
+
+  func cacheKey(file file: String, ext: String, time: Int32) -> String {
+    return "\(file).\(ext)@\(time)"
+  }
+
+  /*
+  @brief Get the cached thumbnail if it is already in memory.
+  */
+  func cachedThumbnail(file file: String, ext: String, time: Int32) -> UIImage? {
+    return memoryCache.objectForKey(cacheKey(file: file, ext: ext, time: time)) as? UIImage
+  }
+
+  /*
+  @brief Get a thumbnail of a bundled video, generating it in the background if needed.
+  @discussion Must be called on the main thread. completion is called on the main thread, synchronously if the thumbnail is in memory.
+  */
+  func thumbnail(file file: String, ext: String, time: Int32, completion: (UIImage?) -> Void) {
+    let key = cacheKey(file: file, ext: ext, time: time)
+    if let image = memoryCache.objectForKey(key) as? UIImage {
+      completion(image)
+      return
+    }
+    // coalesce concurrent requests for the same thumbnail
+    if pending[key] != nil {
+      pending[key]!.append(completion)
+      return
+    }
+    pending[key] = [completion]
+
+    dispatch_async(workQueue) {
+      let image = self.loadFromDisk(key) ?? self.generate(file: file, ext: ext, time: time, key: key)
+      dispatch_async(dispatch_get_main_queue()) {
+        if let image = image {
+          self.memoryCache.setObject(image, forKey: key)
+        }
+        let callbacks = self.pending.removeValueForKey(key) ?? []
+        for callback in callbacks {
+          callback(image)
+        }
+      }
+    }
+  }
+
+  /*
+  @brief Load the thumbnails of the given tests into memory so their screens show them immediately.
+  @discussion Only the preview frame is generated, with AVAssetImageGenerator; no movie player is prepared, so this never interrupts a video that is playing.
+  @param testNames (in) Test.TestNames values, e.g. Test.TestNamesByCategory.sensoryAndMotor.
+  */
+  func prewarmThumbnails(testNames testNames: [String]) {
+    for testName in testNames {
+      if let entry = BNVideoThumbnailCache.thumbnailForTest(testName) {
+        thumbnail(file: entry.file, ext: "mp4", time: entry.time) { _ in }
+      }
+    }
+  }
+
+  // MARK: Work queue helpers
+
+  private func diskPath(key: String) -> String {
+    let filename = key.stringByReplacingOccurrencesOfString("/", withString: "_") + ".jpg"
+    return (directoryPath as NSString).stringByAppendingPathComponent(filename)
+  }
+
+  private func loadFromDisk(key: String) -> UIImage? {
+    if let image = UIImage(contentsOfFile: diskPath(key)) {
+      return decoded(image)
+    }
+    return nil
+  }
+
+  private func generate(file file: String, ext: String, time: Int32, key: String) -> UIImage? {
+    guard let videoURL = NSBundle.mainBundle().URLForResource(file, withExtension: ext) else {
+      return nil
+    }
+    let asset = AVURLAsset(URL: videoURL, options: nil)
+    let imgGenerator = AVAssetImageGenerator(asset: asset)
+    imgGenerator.appliesPreferredTrackTransform = true
+    imgGenerator.maximumSize = BNVideoThumbnailCache.maximumSize
+    do {
+      let thumbnail = try imgGenerator.copyCGImageAtTime(CMTimeMake(Int64(time), 1), actualTime: nil)
+      let image = UIImage(CGImage: thumbnail)
+      if let data = UIImageJPEGRepresentation(image, 0.85) {
+        do {
+          try NSFileManager.defaultManager().createDirectoryAtPath(directoryPath, withIntermediateDirectories: true, attributes: nil)
+          try data.writeToFile(diskPath(key), options: .DataWritingAtomic)
+        } catch {
+          // the thumbnail is still usable from memory
+        }
+      }
+      return image
+    }
+    catch {
+      return nil
+    }
+  }
+
+  // Force decoding now so the first draw on the main thread does not decode the JPEG.
+  private func decoded(image: UIImage) -> UIImage {
+    UIGraphicsBeginImageContextWithOptions(image.size, true, image.scale)
+    image.drawAtPoint(CGPointZero)
+    let result = UIGraphicsGetImageFromCurrentImageContext()
+    UIGraphicsEndImageContext()
+    return result ?? image
+  }
+}
@@ -11,7 +11,6 @@ import UIKit
 class CrossingEyesWhatDidYouSeeViewController: UIViewController {
 
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -22,11 +21,8 @@ class CrossingEyesWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.crossingEyes)
+        test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.crossingEyes)
     }
 
     override func didReceiveMemoryWarning() {
@@ -39,14 +35,12 @@ class CrossingEyesWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "CrossingEyesGoodOutcomeSegueID" {
             
             // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
             
         } else if segue.identifier == "CrossingEyesBadOutcomeSegueID" || segue.identifier == "CrossingEyesBadOutcomeSegueID2" || segue.identifier == "CrossingEyesBadOutcomeSegueID3" {
             
             // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
             
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! CrossingEyesBadOutcomeViewController
@@ -28,7 +28,7 @@ class EmotionalAttachmentBadOutcomeViewController: UIViewController {
     Tracker.createEvent(.EmotionalAttachment, .Load, .Bad)
     
     // Do any additional setup after loading the view.
-    rangeChartView.config(startMonth: 0, endMonth: 20, successAgeInMonths: 13, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!)
+    rangeChartView.config(startMonth: 0, endMonth: 20, successAgeInMonths: 13, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!, resultLog: TestResultLog.logForProfile(Parent.currentProfileName()), testName: Test.TestNames.emotionalAttachment, birthday: parent.babyBirthday)
     
     // font can't be set directly in storyboard for attributed string, set the label font here
     // make label's set attr string to a mutable so we can add attributes on
@@ -11,7 +11,6 @@ import UIKit
 class EmotionalAttachmentWhatDidYouSeeViewController: UIViewController {
 
   var parent = Parent()
-  var profiles = TestProfiles()
   var test = Test()
   
   override func viewDidLoad() {
@@ -23,11 +22,8 @@ class EmotionalAttachmentWhatDidYouSeeViewController: UIViewController {
     // Ensure current information for parent by reloading.
     parent = Parent()
     
-    // Ensure current information for test profiles by reloading.
-    profiles.initProfilesFromPersistentStore()
-    
     // Get the test information.
-    test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.emotionalAttachment)
+    test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.emotionalAttachment)
   }
   
   override func didReceiveMemoryWarning() {
@@ -40,14 +36,12 @@ class EmotionalAttachmentWhatDidYouSeeViewController: UIViewController {
     if segue.identifier == "EmotionalAttachmentGoodOutcomeSegueID" {
       
       // Record the successful symmetry test result and save it to the persistent store on disk.
-      test.addTestResult(testResult: true)
-      profiles.save()
+      ProfileStore.sharedStore.addTestResult(test, testResult: true)
       
     } else if segue.identifier == "EmotionalAttachmentBadOutcomeSegueID" {
       
       // Record the failed symmetry test result and save it to the persistent store on disk.
-      test.addTestResult(testResult: false)
-      profiles.save()
+      ProfileStore.sharedStore.addTestResult(test, testResult: false)
       
       // Pass the test results history to the destination VC.
       let controller = segue.destinationViewController as! EmotionalAttachmentBadOutcomeViewController
@@ -27,7 +27,7 @@ class EmotionalSecurityBadOutcomeViewController: UIViewController {
     Tracker.createEvent(.EmotionalSecurity, .Load, .Bad)
     
     // Do any additional setup after loading the view.
-    rangeChartView.config(startMonth: 0, endMonth: 12, successAgeInMonths: 11, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!)
+    rangeChartView.config(startMonth: 0, endMonth: 12, successAgeInMonths: 11, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!, resultLog: TestResultLog.logForProfile(Parent.currentProfileName()), testName: Test.TestNames.emotionalSecurity, birthday: parent.babyBirthday)
     
     // font can't be set directly in storyboard for attributed string, set the label font here
     // make label's set attr string to a mutable so we can add attributes on
@@ -11,7 +11,6 @@ import UIKit
 class FacialMimicWhatDidYouSeeViewController: UIViewController {
     
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -26,13 +25,10 @@ class FacialMimicWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
         let profileName = parent.getCurrentProfileName()
         let testName = Test.TestNames.facialMimic
-        test = profiles.getTest(profileName, testName: testName)
+        test = ProfileStore.sharedStore.getTest(profileName, testName: testName)
     }
     
     override func didReceiveMemoryWarning() {
@@ -45,14 +41,12 @@ class FacialMimicWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "FacialMimicGoodOutcomeSegueID" {
             
             // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
             
         } else if segue.identifier == "FacialMimicBadOutcomeSegueID" {
             
             // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
             
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! FacialMimicBadOutcomeViewController
@@ -11,7 +11,6 @@ import UIKit
 class FallingToyWhatDidYouSeeViewController: UIViewController {
 
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -22,11 +21,8 @@ class FallingToyWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.fallingToy)
+        test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.fallingToy)
     }
 
     override func didReceiveMemoryWarning() {
@@ -39,14 +35,12 @@ class FallingToyWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "FallingToyGoodOutcomeSegueID" {
             
             // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
             
         } else if segue.identifier == "FallingToyBadOutcomeSegueID" {
             
             // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
             
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! FallingToyBadOutcomeViewController
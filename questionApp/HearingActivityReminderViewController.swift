@@ -1,18 +0,0 @@
-//
-//  HearingActivityReminderViewController.swift
-//  questionApp
-//
-//  Created by john bateman on 7/15/15.
-//  Copyright (c) 2015 codeHatcher. All rights reserved.
-//
-
-import UIKit
-
-class HearingActivityReminderViewController: ActivityReminderViewController {
-
-    @IBAction func onHomeButtonTap(sender: AnyObject) {
-        var storyboard = UIStoryboard (name: "Main", bundle: nil)
-        var controller: MilestonesViewController = storyboard.instantiateViewControllerWithIdentifier("MilestonesVCStoryboardID") as! MilestonesViewController
-        self.presentViewController(controller, animated: true, completion: nil);
-    }
-}
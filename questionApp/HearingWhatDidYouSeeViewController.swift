@@ -1,65 +0,0 @@
-//
-//  HearingWhatDidYouSeeViewController.swift
-//  questionApp
-//
-//  Created by john bateman on 7/15/15.
-//  Copyright (c) 2015 codeHatcher. All rights reserved.
-//
-
-import UIKit
-
-class HearingWhatDidYouSeeViewController: UIViewController {
-
-    var parent = Parent()
-    var profiles = TestProfiles()
-    var test = Test()
-
-    @IBOutlet weak var goodOutcomeButton: BNButton!
-    
-    override func viewDidLoad() {
-        super.viewDidLoad()
-      // analytics
-      Tracker.createEvent(.Hearing, .Load, .WhatDidSee)
-        
-        // TODO: center align text not working with BNButton class. Tried to move to drawText in BNButton but it didn't work.
-        goodOutcomeButton.contentHorizontalAlignment = UIControlContentHorizontalAlignment.Center
-        
-        // Ensure current information for parent by reloading.
-        parent = Parent()
-        
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
-        // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.hearing)
-    }
-    
-    override func didReceiveMemoryWarning() {
-        super.didReceiveMemoryWarning()
-        // Dispose of any resources that can be recreated.
-    }
-    
-    override func prepareForSegue(segue: UIStoryboardSegue, sender: AnyObject?) {
-        
-        if segue.identifier == "HearingGoodOutcomeSegueID" {
-            
-            // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
-            
-        } else if segue.identifier == "HearingBadOutcomeSegueID" {
-            
-            // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
-            
-            // Pass the test results history to the destination VC.
-            let controller = segue.destinationViewController as! HearingBadOutcomeViewController
-            controller.test = self.test
-        }
-    }
-    
-    @IBAction func onBackButtonTap(sender: AnyObject) {
-        self.dismissViewControllerAnimated(true, completion: nil)
-    }
-}
@@ -27,7 +27,7 @@ class JointAttentionBadOutcomeViewController: UIViewController {
         // Schedule a local notification to remind the user to rerun this test.
         scheduleReminder()
         
-        rangeChartView.config(startMonth: 0, endMonth: 40, successAgeInMonths: 30, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!)
+        rangeChartView.config(startMonth: 0, endMonth: 40, successAgeInMonths: 30, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!, resultLog: TestResultLog.logForProfile(Parent.currentProfileName()), testName: Test.TestNames.jointAttention, birthday: parent.babyBirthday)
         
         // font can't be set directly in storyboard for attributed string, set the label font here
         // make label's set attr string to a mutable so we can add attributes on
@@ -11,7 +11,6 @@ import UIKit
 class JointAttentionWhatDidYouSeeViewController: UIViewController {
     
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -20,11 +19,8 @@ class JointAttentionWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.jointAttention)
+        test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.jointAttention)
     }
     
     override func didReceiveMemoryWarning() {
@@ -37,14 +33,12 @@ class JointAttentionWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "JointAttentionGoodOutcomeSegueID" {
             
             // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
             
         } else if segue.identifier == "JointAttentionBadOutcomeSegueID" {
             
             // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
             
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! JointAttentionBadOutcomeViewController
@@ -20,6 +20,8 @@ class LanguageCognitiveMilestoneViewController: UIViewController {
   @IBOutlet weak var partiallyCoveredButton: BNButton!
     override func viewDidLoad() {
         super.viewDidLoad()
+        // load the preview thumbnails of this milestone's tests before one is opened
+        BNVideoThumbnailCache.sharedCache.prewarmThumbnails(testNames: Test.TestNamesByCategory.languageAndCognitive)
       // analytics
       Tracker.createEvent(.LanguageCognitiveMilestone, .Load)
 
@@ -65,7 +65,9 @@ class MilestonesViewController: UIViewController {
     babyImageView.layer.borderWidth = 4.0
     babyImageView.layer.borderColor = kBlue.CGColor
     
-    babyImageView.image = parent.image
+    parent.loadAvatarImage { [weak self] image in
+      self?.babyImageView.image = image
+    }
     
     
     // calculations for getting age in weeks
@@ -89,9 +91,9 @@ class MilestonesViewController: UIViewController {
     babyNameLabel.text = parent.babyName
     
     // get the test status by category
-    var profiles = TestProfiles()
-    profiles.initProfilesFromPersistentStore()
-    var testHistories = profiles.getTestHistories(profileName: Parent().getCurrentProfileName())
+    var testHistories = ProfileStore.sharedStore.read { profiles in
+      profiles.getTestHistories(profileName: Parent().getCurrentProfileName())
+    }
     var sensoryTests = 0;
     var languageTests = 0;
     var socialTests = 0;
@@ -142,9 +144,9 @@ class MilestonesViewController: UIViewController {
 		// Configure the Re-tests elements
 		configureReminders()
     
-    let profiles = TestProfiles()
-    profiles.initProfilesFromPersistentStore()
-    let testHistories = profiles.getTestHistories(profileName: Parent().getCurrentProfileName())
+    let testHistories = ProfileStore.sharedStore.read { profiles in
+      profiles.getTestHistories(profileName: Parent().getCurrentProfileName())
+    }
     
     // present feedback controller if it has not been shown before
     if !NSUserDefaults.standardUserDefaults().boolForKey(kHasFeedbackDialogShown) {
@@ -218,9 +220,9 @@ class MilestonesViewController: UIViewController {
 		
 		// get histories for the current profile
 		var parent = Parent()
-		var profiles = TestProfiles()
-		profiles.initProfilesFromPersistentStore()
-		var histories = profiles.getTestHistories(profileName: parent.getCurrentProfileName())
+		var histories = ProfileStore.sharedStore.read { profiles in
+			profiles.getTestHistories(profileName: parent.getCurrentProfileName())
+		}
 		
 		// configure the next test properties
 		if let histories = histories {
@@ -247,9 +249,9 @@ class MilestonesViewController: UIViewController {
 		
 		// get histories for the current profile
 		var parent = Parent()
-		var profiles = TestProfiles()
-		profiles.initProfilesFromPersistentStore()
-		var histories = profiles.getTestHistories(profileName: parent.getCurrentProfileName())
+		var histories = ProfileStore.sharedStore.read { profiles in
+			profiles.getTestHistories(profileName: parent.getCurrentProfileName())
+		}
 
 		// count the number of tests that have reminders
 		if let histories = histories {
@@ -265,9 +267,9 @@ class MilestonesViewController: UIViewController {
 
 		// get histories for the current profile
 		var parent = Parent()
-		var profiles = TestProfiles()
-		profiles.initProfilesFromPersistentStore()
-		var histories = profiles.getTestHistories(profileName: parent.getCurrentProfileName())
+		var histories = ProfileStore.sharedStore.read { profiles in
+			profiles.getTestHistories(profileName: parent.getCurrentProfileName())
+		}
 
 		// get a list of tests with reminders currently scheduled.
 		if let histories = histories {
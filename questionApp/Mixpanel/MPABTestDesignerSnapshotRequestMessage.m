@@ -7,11 +7,13 @@
 #import "MPApplicationStateSerializer.h"
 #import "MPObjectIdentityProvider.h"
 #import "MPObjectSerializerConfig.h"
+#import "MPValueTransformers.h"
 
 NSString * const MPABTestDesignerSnapshotRequestMessageType = @"snapshot_request";
 
 static NSString * const kSnapshotSerializerConfigKey = @"snapshot_class_descriptions";
 static NSString * const kObjectIdentityProviderKey = @"object_identity_provider";
+static NSString * const kDeliveredImageHashesKey = @"delivered_image_hashes";
 
 @implementation MPABTestDesignerSnapshotRequestMessage
 
@@ -60,6 +62,13 @@ static NSString * const kObjectIdentityProviderKey = @"object_identity_provider"
             [connection setSessionObject:objectIdentityProvider forKey:kObjectIdentityProviderKey];
         }
 
+        // Images already sent during this session are referenced by hash instead of resent.
+        NSMutableSet *deliveredImageHashes = [connection sessionObjectForKey:kDeliveredImageHashesKey];
+        if (deliveredImageHashes == nil) {
+            deliveredImageHashes = [NSMutableSet set];
+            [connection setSessionObject:deliveredImageHashes forKey:kDeliveredImageHashesKey];
+        }
+
         MPApplicationStateSerializer *serializer = [[MPApplicationStateSerializer alloc] initWithApplication:[UIApplication sharedApplication]
                                                                                                configuration:serializerConfig
                                                                                       objectIdentityProvider:objectIdentityProvider];
@@ -77,7 +86,9 @@ static NSString * const kObjectIdentityProviderKey = @"object_identity_provider"
             serializedObjects = [connection sessionObjectForKey:@"snapshot_hierarchy"];
         } else {
             dispatch_sync(dispatch_get_main_queue(), ^{
+                [MPUIImageToNSDictionaryValueTransformer setDeliveredImageHashes:deliveredImageHashes];
                 serializedObjects = [serializer objectHierarchyForWindowAtIndex:0];
+                [MPUIImageToNSDictionaryValueTransformer setDeliveredImageHashes:nil];
             });
             [connection setSessionObject:serializedObjects forKey:@"snapshot_hierarchy"];
         }
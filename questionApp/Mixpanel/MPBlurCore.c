@@ -0,0 +1,235 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "MPBlurCore.h"
+
+// M_PI is not part of C99, so strict C99 builds of the benchmark would not see it.
+static const double mp_blur_pi = 3.14159265358979323846;
+
+struct mp_blur_pool {
+    void *buffers[MP_BLUR_POOL_SLOT_COUNT];
+    size_t sizes[MP_BLUR_POOL_SLOT_COUNT];
+};
+
+mp_blur_pool *mp_blur_pool_create(void)
+{
+    return calloc(1, sizeof(mp_blur_pool));
+}
+
+void mp_blur_pool_destroy(mp_blur_pool *pool)
+{
+    if (pool) {
+        mp_blur_pool_trim(pool);
+        free(pool);
+    }
+}
+
+void *mp_blur_pool_buffer(mp_blur_pool *pool, int slot, size_t bytes)
+{
+    if (slot < 0 || slot >= MP_BLUR_POOL_SLOT_COUNT) {
+        return NULL;
+    }
+    if (pool->sizes[slot] < bytes) {
+        free(pool->buffers[slot]);
+        pool->buffers[slot] = malloc(bytes);
+        pool->sizes[slot] = pool->buffers[slot] ? bytes : 0;
+    }
+    return pool->buffers[slot];
+}
+
+void mp_blur_pool_trim(mp_blur_pool *pool)
+{
+    for (int i = 0; i < MP_BLUR_POOL_SLOT_COUNT; i++) {
+        free(pool->buffers[i]);
+        pool->buffers[i] = NULL;
+        pool->sizes[i] = 0;
+    }
+}
+
+uint32_t mp_blur_box_size_for_radius(double radius)
+{
+    if (radius <= 0) {
+        return 1;
+    }
+    uint32_t boxSize = (uint32_t)floor(radius * 3. * sqrt(2 * mp_blur_pi) / 4 + 0.5);
+    if (boxSize % 2 != 1) {
+        boxSize += 1;
+    }
+    return boxSize;
+}
+
+size_t mp_blur_downsample_factor(uint32_t boxSize)
+{
+    // Keep at least ~8 pixels of box after shrinking; past 8x the saving is
+    // negligible and the upscale starts to show blocks on hard edges.
+    size_t factor = boxSize / 8;
+    if (factor < 1) {
+        factor = 1;
+    } else if (factor > 8) {
+        factor = 8;
+    }
+    return factor;
+}
+
+void mp_blur_downsample(const mp_blur_image *src, mp_blur_image *dst, size_t factor)
+{
+    if (factor <= 1) {
+        for (size_t y = 0; y < src->height; y++) {
+            memcpy(dst->data + y * dst->rowBytes, src->data + y * src->rowBytes, src->width * 4);
+        }
+        return;
+    }
+
+    for (size_t dy = 0; dy < dst->height; dy++) {
+        size_t y0 = dy * factor;
+        size_t y1 = y0 + factor < src->height ? y0 + factor : src->height;
+        uint8_t *out = dst->data + dy * dst->rowBytes;
+        for (size_t dx = 0; dx < dst->width; dx++) {
+            size_t x0 = dx * factor;
+            size_t x1 = x0 + factor < src->width ? x0 + factor : src->width;
+            uint32_t sum[4] = {0, 0, 0, 0};
+            for (size_t y = y0; y < y1; y++) {
+                const uint8_t *in = src->data + y * src->rowBytes + x0 * 4;
+                for (size_t x = x0; x < x1; x++, in += 4) {
+                    sum[0] += in[0];
+                    sum[1] += in[1];
+                    sum[2] += in[2];
+                    sum[3] += in[3];
+                }
+            }
+            uint32_t count = (uint32_t)((y1 - y0) * (x1 - x0));
+            for (int c = 0; c < 4; c++) {
+                out[dx * 4 + c] = (uint8_t)((sum[c] + count / 2) / count);
+            }
+        }
+    }
+}
+
+static inline size_t mp_clamp_index(long i, size_t n)
+{
+    if (i < 0) {
+        return 0;
+    }
+    if ((size_t)i >= n) {
+        return n - 1;
+    }
+    return (size_t)i;
+}
+
+// One horizontal box pass over a single row, reading from src and writing dst.
+static void mp_box_row(const uint8_t *src, uint8_t *dst, size_t width, uint32_t boxSize)
+{
+    long r = boxSize / 2;
+    uint32_t half = boxSize / 2;
+    uint32_t sum[4] = {0, 0, 0, 0};
+    for (long k = -r; k <= r; k++) {
+        const uint8_t *p = src + mp_clamp_index(k, width) * 4;
+        sum[0] += p[0];
+        sum[1] += p[1];
+        sum[2] += p[2];
+        sum[3] += p[3];
+    }
+    for (size_t x = 0; x < width; x++) {
+        uint8_t *out = dst + x * 4;
+        out[0] = (uint8_t)((sum[0] + half) / boxSize);
+        out[1] = (uint8_t)((sum[1] + half) / boxSize);
+        out[2] = (uint8_t)((sum[2] + half) / boxSize);
+        out[3] = (uint8_t)((sum[3] + half) / boxSize);
+        const uint8_t *add = src + mp_clamp_index((long)x + r + 1, width) * 4;
+        const uint8_t *sub = src + mp_clamp_index((long)x - r, width) * 4;
+        sum[0] += add[0] - sub[0];
+        sum[1] += add[1] - sub[1];
+        sum[2] += add[2] - sub[2];
+        sum[3] += add[3] - sub[3];
+    }
+}
+
+// One vertical box pass, row by row with a running column sum so memory is
+// always walked in order.
+static void mp_box_columns(const mp_blur_image *src, mp_blur_image *dst, uint32_t boxSize, uint32_t *sums)
+{
+    size_t n = src->width * 4;
+    long r = boxSize / 2;
+    uint32_t half = boxSize / 2;
+    memset(sums, 0, n * sizeof(uint32_t));
+    for (long k = -r; k <= r; k++) {
+        const uint8_t *row = src->data + mp_clamp_index(k, src->height) * src->rowBytes;
+        for (size_t i = 0; i < n; i++) {
+            sums[i] += row[i];
+        }
+    }
+    for (size_t y = 0; y < src->height; y++) {
+        uint8_t *out = dst->data + y * dst->rowBytes;
+        const uint8_t *add = src->data + mp_clamp_index((long)y + r + 1, src->height) * src->rowBytes;
+        const uint8_t *sub = src->data + mp_clamp_index((long)y - r, src->height) * src->rowBytes;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = (uint8_t)((sums[i] + half) / boxSize);
+            sums[i] += add[i] - sub[i];
+        }
+    }
+}
+
+int mp_blur_box3(mp_blur_image *image, uint32_t boxSize, mp_blur_pool *pool)
+{
+    if (image->width == 0 || image->height == 0 || boxSize <= 1) {
+        return 0;
+    }
+    if (boxSize % 2 == 0) {
+        boxSize += 1;
+    }
+
+    size_t packedRowBytes = image->width * 4;
+    uint8_t *scratchData = mp_blur_pool_buffer(pool, MP_BLUR_POOL_SCRATCH, packedRowBytes * image->height);
+    uint32_t *sums = mp_blur_pool_buffer(pool, MP_BLUR_POOL_SUMS, packedRowBytes * sizeof(uint32_t));
+    if (scratchData == NULL || sums == NULL) {
+        return -1;
+    }
+    mp_blur_image scratch = { scratchData, image->width, image->height, packedRowBytes };
+
+    // Box filters are separable and commute, so the three 2D passes become
+    // three horizontal passes (row stays in cache) then three vertical ones.
+    for (size_t y = 0; y < image->height; y++) {
+        uint8_t *row = image->data + y * image->rowBytes;
+        uint8_t *tmp = scratchData + y * packedRowBytes;
+        mp_box_row(row, tmp, image->width, boxSize);
+        mp_box_row(tmp, row, image->width, boxSize);
+        mp_box_row(row, tmp, image->width, boxSize);
+    }
+    mp_box_columns(&scratch, image, boxSize, sums);
+    mp_box_columns(image, &scratch, boxSize, sums);
+    mp_box_columns(&scratch, image, boxSize, sums);
+
+    return 0;
+}
+
+void mp_blur_color_matrix(mp_blur_image *image, const int16_t matrix[16], int32_t divisor)
+{
+    int32_t round = divisor / 2;
+    for (size_t y = 0; y < image->height; y++) {
+        uint8_t *p = image->data + y * image->rowBytes;
+        for (size_t x = 0; x < image->width; x++, p += 4) {
+            int32_t in[4] = { p[0], p[1], p[2], p[3] };
+            for (int j = 0; j < 4; j++) {
+                int32_t v = in[0] * matrix[j] + in[1] * matrix[4 + j] + in[2] * matrix[8 + j] + in[3] * matrix[12 + j];
+                v = (v + round) / divisor;
+                p[j] = (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+            }
+        }
+    }
+}
+
+void mp_blur_saturation_matrix(double s, int16_t matrix[16], int32_t divisor)
+{
+    const double floatingPointSaturationMatrix[] = {
+        0.0722 + 0.9278 * s,  0.0722 - 0.0722 * s,  0.0722 - 0.0722 * s,  0,
+        0.7152 - 0.7152 * s,  0.7152 + 0.2848 * s,  0.7152 - 0.7152 * s,  0,
+        0.2126 - 0.2126 * s,  0.2126 - 0.2126 * s,  0.2126 + 0.7873 * s,  0,
+        0,                    0,                    0,                    1,
+    };
+    for (int i = 0; i < 16; i++) {
+        matrix[i] = (int16_t)round(floatingPointSaturationMatrix[i] * divisor);
+    }
+}
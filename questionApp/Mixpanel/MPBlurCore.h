@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+//
+// Portable pixel kernels behind UIImage+MPImageEffects. Nothing in here
+// depends on UIKit, CoreGraphics or Accelerate so the same code can be
+// exercised and benchmarked off-device.
+
+#ifndef MPBlurCore_h
+#define MPBlurCore_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A tightly or loosely packed 4 x 8 bit per pixel image. The kernels treat the
+// four channels uniformly, so the channel order is up to the caller.
+typedef struct {
+    uint8_t *data;
+    size_t width;
+    size_t height;
+    size_t rowBytes;
+} mp_blur_image;
+
+// Grow-only scratch buffers reused across blur calls. A pool must not be used
+// from more than one thread at a time.
+typedef struct mp_blur_pool mp_blur_pool;
+
+enum {
+    MP_BLUR_POOL_SOURCE = 0,
+    MP_BLUR_POOL_SCRATCH,
+    MP_BLUR_POOL_SUMS,
+    MP_BLUR_POOL_SLOT_COUNT
+};
+
+mp_blur_pool *mp_blur_pool_create(void);
+void mp_blur_pool_destroy(mp_blur_pool *pool);
+void *mp_blur_pool_buffer(mp_blur_pool *pool, int slot, size_t bytes);
+void mp_blur_pool_trim(mp_blur_pool *pool);
+
+// Box size approximating a gaussian of the given radius (in pixels) with three
+// box passes, as described in the SVG spec for feGaussianBlur. Always odd.
+uint32_t mp_blur_box_size_for_radius(double radius);
+
+// Integer factor to shrink an image by before blurring with the given box size.
+// The box is then divided by the same factor, keeping it at least a few pixels
+// wide so the result is indistinguishable once scaled back up.
+size_t mp_blur_downsample_factor(uint32_t boxSize);
+
+// Average factor x factor blocks of src into dst. dst must be
+// ceil(src.width / factor) x ceil(src.height / factor).
+void mp_blur_downsample(const mp_blur_image *src, mp_blur_image *dst, size_t factor);
+
+// Three separable box passes of boxSize (odd) with edge extension, in place.
+// Returns 0 on success or -1 if scratch memory could not be allocated.
+int mp_blur_box3(mp_blur_image *image, uint32_t boxSize, mp_blur_pool *pool);
+
+// 4x4 color matrix with the same layout as vImageMatrixMultiply_ARGB8888:
+// out[j] = sum_i(in[i] * matrix[i * 4 + j]) / divisor, clamped to 0...255.
+void mp_blur_color_matrix(mp_blur_image *image, const int16_t matrix[16], int32_t divisor);
+
+// Fill matrix with the saturation change used by the image effects, for
+// BGRA ordered pixels.
+void mp_blur_saturation_matrix(double saturationDeltaFactor, int16_t matrix[16], int32_t divisor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
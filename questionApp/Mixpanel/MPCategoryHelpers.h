@@ -7,6 +7,7 @@
 - (UIImage *)mp_snapshotImage;
 - (UIImage *)mp_snapshotForBlur;
 - (int)mp_fingerprintVersion;
+- (UIImage *)mp_fingerprintImage;
 
 @end
 
@@ -0,0 +1,320 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+
+#include <stdlib.h>
+#include <string.h>
+#include "MPDominantColor.h"
+
+#define MP_BIN_SHIFT (8 - MP_DOMINANT_COLOR_BITS)
+#define MP_BIN_MASK ((1 << MP_DOMINANT_COLOR_BITS) - 1)
+#define MP_KMEANS_ITERATIONS 8
+
+static inline unsigned mp_bin_index(uint8_t red, uint8_t green, uint8_t blue)
+{
+    return ((unsigned)(red >> MP_BIN_SHIFT) << (2 * MP_DOMINANT_COLOR_BITS)) |
+           ((unsigned)(green >> MP_BIN_SHIFT) << MP_DOMINANT_COLOR_BITS) |
+           (unsigned)(blue >> MP_BIN_SHIFT);
+}
+
+void mp_color_histogram_reset(mp_color_histogram *histogram)
+{
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+static int mp_skip_pixel(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha, unsigned filters)
+{
+    if ((filters & MP_DOMINANT_COLOR_SKIP_TRANSPARENT) && alpha < 128) {
+        return 1;
+    }
+    unsigned sum = (unsigned)red + green + blue;
+    if ((filters & MP_DOMINANT_COLOR_SKIP_NEAR_WHITE) && sum >= 255 + 255 + 200) {
+        return 1;
+    }
+    if ((filters & MP_DOMINANT_COLOR_SKIP_NEAR_BLACK) && sum < 12) {
+        return 1;
+    }
+    if (filters & MP_DOMINANT_COLOR_SKIP_GRAYS) {
+        uint8_t max = red > green ? (red > blue ? red : blue) : (green > blue ? green : blue);
+        uint8_t min = red < green ? (red < blue ? red : blue) : (green < blue ? green : blue);
+        if (max - min < 8) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void mp_color_histogram_add_pixels(mp_color_histogram *histogram, const uint8_t *pixels, size_t width, size_t height, size_t rowBytes, unsigned filters)
+{
+    for (size_t y = 0; y < height; y++) {
+        const uint8_t *p = pixels + y * rowBytes;
+        for (size_t x = 0; x < width; x++, p += 4) {
+            uint8_t blue = p[0], green = p[1], red = p[2], alpha = p[3];
+            if (mp_skip_pixel(red, green, blue, alpha, filters)) {
+                continue;
+            }
+            unsigned bin = mp_bin_index(red, green, blue);
+            histogram->count[bin]++;
+            histogram->sum[bin][0] += red;
+            histogram->sum[bin][1] += green;
+            histogram->sum[bin][2] += blue;
+            histogram->total++;
+        }
+    }
+}
+
+// A populated bin reduced to its mean color.
+typedef struct {
+    int32_t rgb[3];
+    uint32_t count;
+} mp_bin_color;
+
+static size_t mp_collect_bins(const mp_color_histogram *histogram, mp_bin_color *bins)
+{
+    size_t n = 0;
+    for (unsigned i = 0; i < MP_DOMINANT_COLOR_BIN_COUNT; i++) {
+        uint32_t count = histogram->count[i];
+        if (count) {
+            for (int c = 0; c < 3; c++) {
+                bins[n].rgb[c] = (int32_t)((histogram->sum[i][c] + count / 2) / count);
+            }
+            bins[n].count = count;
+            n++;
+        }
+    }
+    return n;
+}
+
+static void mp_set_result(mp_dominant_color *result, const int64_t sum[3], uint64_t population)
+{
+    result->red = (uint8_t)((sum[0] + (int64_t)population / 2) / (int64_t)population);
+    result->green = (uint8_t)((sum[1] + (int64_t)population / 2) / (int64_t)population);
+    result->blue = (uint8_t)((sum[2] + (int64_t)population / 2) / (int64_t)population);
+    result->population = (uint32_t)population;
+}
+
+static void mp_dominant_bin(const mp_color_histogram *histogram, mp_dominant_color *result)
+{
+    unsigned best = 0;
+    for (unsigned i = 1; i < MP_DOMINANT_COLOR_BIN_COUNT; i++) {
+        if (histogram->count[i] > histogram->count[best]) {
+            best = i;
+        }
+    }
+    int64_t sum[3] = { histogram->sum[best][0], histogram->sum[best][1], histogram->sum[best][2] };
+    mp_set_result(result, sum, histogram->count[best]);
+}
+
+static void mp_kmeans(mp_bin_color *bins, size_t n, unsigned k, mp_dominant_color *result)
+{
+    // Seed with the k largest bins so the result is deterministic.
+    int32_t centroids[MP_DOMINANT_COLOR_MAX_CLUSTERS][3];
+    uint8_t taken[MP_DOMINANT_COLOR_BIN_COUNT] = {0};
+    if (k > n) {
+        k = (unsigned)n;
+    }
+    for (unsigned j = 0; j < k; j++) {
+        size_t best = 0;
+        uint32_t bestCount = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (!taken[i] && bins[i].count > bestCount) {
+                best = i;
+                bestCount = bins[i].count;
+            }
+        }
+        taken[best] = 1;
+        memcpy(centroids[j], bins[best].rgb, sizeof(centroids[j]));
+    }
+
+    int64_t sums[MP_DOMINANT_COLOR_MAX_CLUSTERS][3];
+    uint64_t populations[MP_DOMINANT_COLOR_MAX_CLUSTERS];
+    for (int iteration = 0; iteration < MP_KMEANS_ITERATIONS; iteration++) {
+        memset(sums, 0, sizeof(sums));
+        memset(populations, 0, sizeof(populations));
+        for (size_t i = 0; i < n; i++) {
+            unsigned nearest = 0;
+            int32_t nearestDistance = INT32_MAX;
+            for (unsigned j = 0; j < k; j++) {
+                int32_t dr = bins[i].rgb[0] - centroids[j][0];
+                int32_t dg = bins[i].rgb[1] - centroids[j][1];
+                int32_t db = bins[i].rgb[2] - centroids[j][2];
+                int32_t distance = dr * dr + dg * dg + db * db;
+                if (distance < nearestDistance) {
+                    nearest = j;
+                    nearestDistance = distance;
+                }
+            }
+            for (int c = 0; c < 3; c++) {
+                sums[nearest][c] += (int64_t)bins[i].rgb[c] * bins[i].count;
+            }
+            populations[nearest] += bins[i].count;
+        }
+
+        int moved = 0;
+        for (unsigned j = 0; j < k; j++) {
+            if (populations[j] == 0) {
+                continue;
+            }
+            for (int c = 0; c < 3; c++) {
+                int32_t value = (int32_t)((sums[j][c] + (int64_t)populations[j] / 2) / (int64_t)populations[j]);
+                moved |= value != centroids[j][c];
+                centroids[j][c] = value;
+            }
+        }
+        if (!moved) {
+            break;
+        }
+    }
+
+    unsigned best = 0;
+    for (unsigned j = 1; j < k; j++) {
+        if (populations[j] > populations[best]) {
+            best = j;
+        }
+    }
+    mp_set_result(result, sums[best], populations[best]);
+}
+
+typedef struct {
+    size_t begin;
+    size_t end;
+    uint64_t population;
+} mp_color_box;
+
+// Stable counting sort of bins by one channel, O(n + 256).
+static void mp_sort_bins(mp_bin_color *bins, size_t count, int channel, mp_bin_color *scratch)
+{
+    size_t offsets[257] = {0};
+    for (size_t i = 0; i < count; i++) {
+        offsets[bins[i].rgb[channel] + 1]++;
+    }
+    for (int v = 0; v < 256; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    for (size_t i = 0; i < count; i++) {
+        scratch[offsets[bins[i].rgb[channel]]++] = bins[i];
+    }
+    memcpy(bins, scratch, count * sizeof(mp_bin_color));
+}
+
+static void mp_median_cut(mp_bin_color *bins, size_t n, unsigned k, mp_bin_color *scratch, mp_dominant_color *result)
+{
+    mp_color_box boxes[MP_DOMINANT_COLOR_MAX_CLUSTERS];
+    unsigned boxCount = 1;
+    boxes[0].begin = 0;
+    boxes[0].end = n;
+    boxes[0].population = 0;
+    for (size_t i = 0; i < n; i++) {
+        boxes[0].population += bins[i].count;
+    }
+
+    while (boxCount < k) {
+        // Split the box with the widest channel range that can still be split.
+        int splitBox = -1, splitChannel = 0;
+        int32_t widest = -1;
+        for (unsigned b = 0; b < boxCount; b++) {
+            if (boxes[b].end - boxes[b].begin < 2) {
+                continue;
+            }
+            for (int c = 0; c < 3; c++) {
+                int32_t lo = 255, hi = 0;
+                for (size_t i = boxes[b].begin; i < boxes[b].end; i++) {
+                    lo = bins[i].rgb[c] < lo ? bins[i].rgb[c] : lo;
+                    hi = bins[i].rgb[c] > hi ? bins[i].rgb[c] : hi;
+                }
+                if (hi - lo > widest) {
+                    widest = hi - lo;
+                    splitBox = (int)b;
+                    splitChannel = c;
+                }
+            }
+        }
+        if (splitBox < 0) {
+            break;
+        }
+
+        mp_color_box *box = &boxes[splitBox];
+        mp_sort_bins(bins + box->begin, box->end - box->begin, splitChannel, scratch);
+
+        // Weighted median: first index where the lower half holds half the population.
+        uint64_t running = 0;
+        size_t median = box->begin;
+        while (median < box->end - 1 && (running + bins[median].count) * 2 <= box->population) {
+            running += bins[median].count;
+            median++;
+        }
+        // Never split between bins with the same value on the split channel;
+        // move to the nearest boundary where the value changes.
+        if (median == box->begin) {
+            median++;
+        }
+        size_t forward = median, backward = median;
+        while (forward < box->end && bins[forward - 1].rgb[splitChannel] == bins[forward].rgb[splitChannel]) {
+            forward++;
+        }
+        while (backward > box->begin + 1 && bins[backward - 1].rgb[splitChannel] == bins[backward].rgb[splitChannel]) {
+            backward--;
+        }
+        int backwardValid = bins[backward - 1].rgb[splitChannel] != bins[backward].rgb[splitChannel];
+        if (forward < box->end && (!backwardValid || forward - median <= median - backward)) {
+            median = forward;
+        } else if (backwardValid) {
+            median = backward;
+        }
+        running = 0;
+        for (size_t i = box->begin; i < median; i++) {
+            running += bins[i].count;
+        }
+
+        mp_color_box *upper = &boxes[boxCount++];
+        upper->begin = median;
+        upper->end = box->end;
+        upper->population = box->population - running;
+        box->end = median;
+        box->population = running;
+    }
+
+    unsigned best = 0;
+    for (unsigned b = 1; b < boxCount; b++) {
+        if (boxes[b].population > boxes[best].population) {
+            best = b;
+        }
+    }
+    int64_t sum[3] = {0, 0, 0};
+    for (size_t i = boxes[best].begin; i < boxes[best].end; i++) {
+        for (int c = 0; c < 3; c++) {
+            sum[c] += (int64_t)bins[i].rgb[c] * bins[i].count;
+        }
+    }
+    mp_set_result(result, sum, boxes[best].population);
+}
+
+int mp_color_histogram_dominant_color(const mp_color_histogram *histogram, mp_dominant_color_refinement refinement, unsigned clusterCount, mp_dominant_color *result)
+{
+    if (histogram->total == 0) {
+        return -1;
+    }
+    if (clusterCount < 1) {
+        clusterCount = 1;
+    } else if (clusterCount > MP_DOMINANT_COLOR_MAX_CLUSTERS) {
+        clusterCount = MP_DOMINANT_COLOR_MAX_CLUSTERS;
+    }
+
+    if (refinement == MP_DOMINANT_COLOR_HISTOGRAM || clusterCount == 1) {
+        mp_dominant_bin(histogram, result);
+        return 0;
+    }
+
+    mp_bin_color *bins = malloc(2 * MP_DOMINANT_COLOR_BIN_COUNT * sizeof(mp_bin_color));
+    if (bins == NULL) {
+        mp_dominant_bin(histogram, result);
+        return 0;
+    }
+    size_t n = mp_collect_bins(histogram, bins);
+    if (refinement == MP_DOMINANT_COLOR_KMEANS) {
+        mp_kmeans(bins, n, clusterCount, result);
+    } else {
+        mp_median_cut(bins, n, clusterCount, bins + MP_DOMINANT_COLOR_BIN_COUNT, result);
+    }
+    free(bins);
+    return 0;
+}
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+//
+// Portable dominant color extraction behind -[UIImage mp_importantColor].
+// Works on plain BGRA8888 pixel buffers (the layout of a little endian
+// premultiplied-first bitmap context) and has no Apple dependencies.
+
+#ifndef MPDominantColor_h
+#define MPDominantColor_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    // Most populated histogram bin, reported as the mean of its pixels.
+    MP_DOMINANT_COLOR_HISTOGRAM = 0,
+    // Weighted k-means over the populated bins, seeded from the largest bins.
+    MP_DOMINANT_COLOR_KMEANS,
+    // Median cut over the populated bins.
+    MP_DOMINANT_COLOR_MEDIAN_CUT,
+} mp_dominant_color_refinement;
+
+typedef enum {
+    MP_DOMINANT_COLOR_SKIP_TRANSPARENT = 1 << 0,
+    MP_DOMINANT_COLOR_SKIP_NEAR_WHITE = 1 << 1,
+    MP_DOMINANT_COLOR_SKIP_NEAR_BLACK = 1 << 2,
+    MP_DOMINANT_COLOR_SKIP_GRAYS = 1 << 3,
+} mp_dominant_color_filter;
+
+// Filters matching the old header color heuristic.
+#define MP_DOMINANT_COLOR_DEFAULT_FILTERS (MP_DOMINANT_COLOR_SKIP_TRANSPARENT | MP_DOMINANT_COLOR_SKIP_NEAR_WHITE | MP_DOMINANT_COLOR_SKIP_NEAR_BLACK | MP_DOMINANT_COLOR_SKIP_GRAYS)
+
+#define MP_DOMINANT_COLOR_MAX_CLUSTERS 16
+
+typedef struct {
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    // Number of sampled pixels represented by this color.
+    uint32_t population;
+} mp_dominant_color;
+
+// 4 bits per channel: 4096 bins with 32 bit counters and per-bin channel sums.
+#define MP_DOMINANT_COLOR_BITS 4
+#define MP_DOMINANT_COLOR_BIN_COUNT (1 << (3 * MP_DOMINANT_COLOR_BITS))
+
+typedef struct {
+    uint32_t count[MP_DOMINANT_COLOR_BIN_COUNT];
+    uint32_t sum[MP_DOMINANT_COLOR_BIN_COUNT][3];
+    uint32_t total;
+} mp_color_histogram;
+
+void mp_color_histogram_reset(mp_color_histogram *histogram);
+
+// Adds every pixel of a BGRA8888 buffer that passes the filters.
+void mp_color_histogram_add_pixels(mp_color_histogram *histogram, const uint8_t *pixels, size_t width, size_t height, size_t rowBytes, unsigned filters);
+
+// Finds the dominant color of a filled histogram. clusterCount is only used by
+// the k-means and median cut refinements (clamped to 1...MP_DOMINANT_COLOR_MAX_CLUSTERS).
+// Returns 0 on success, -1 if no pixel survived the filters.
+int mp_color_histogram_dominant_color(const mp_color_histogram *histogram, mp_dominant_color_refinement refinement, unsigned clusterCount, mp_dominant_color *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
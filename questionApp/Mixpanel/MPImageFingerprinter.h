@@ -0,0 +1,39 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+
+#import <UIKit/UIKit.h>
+
+/*!
+ Computes and caches image fingerprints used by selector predicates.
+
+ Results are cached per backing CGImage, and all images are drawn through
+ one pair of reused 8x8/9x8 bitmap contexts instead of a new context per view.
+ */
+@interface MPImageFingerprinter : NSObject
+
++ (instancetype)sharedFingerprinter;
+
+/*!
+ The exact-match fingerprint: an 8x8 downsample packed to 2 bits per RGBA
+ component and base64 encoded. Compatible with mp_imageFingerprint version 1.
+ */
+- (NSString *)fingerprintForImage:(UIImage *)image;
+
+/*!
+ A 64 bit difference hash (dHash) as 16 lowercase hex characters. Images that
+ look alike have hashes a small Hamming distance apart.
+ */
+- (NSString *)perceptualHashForImage:(UIImage *)image;
+
+/*!
+ Computes fingerprints for every image not already cached in one pass.
+ */
+- (void)prefetchFingerprintsForImages:(NSArray *)images;
+
+/*!
+ Number of differing bits between two perceptual hashes, or NSNotFound if
+ either one is not a 16 character hex string.
+ */
++ (NSUInteger)hammingDistanceBetweenPerceptualHash:(NSString *)hash andPerceptualHash:(NSString *)otherHash;
+
+@end
@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+
+#if ! __has_feature(objc_arc)
+#error This file must be compiled with ARC. Either turn on ARC for the project or use -fobjc-arc flag on this file.
+#endif
+
+#import "MPImageFingerprinter.h"
+
+static const NSUInteger kMPFingerprintCacheCountLimit = 256;
+
+@interface MPImageFingerprint : NSObject
+
+@property (nonatomic, copy) NSString *fingerprint;
+@property (nonatomic, copy) NSString *perceptualHash;
+
+@end
+
+@implementation MPImageFingerprint
+
+@end
+
+@implementation MPImageFingerprinter
+
+{
+    // CGImageRef -> MPImageFingerprint. NSCache retains the CGImage key, so its
+    // address cannot be reused by another image while the entry is alive.
+    NSCache *_cache;
+
+    // Reused drawing surfaces, only touched while holding the lock on self.
+    uint32_t _colorPixels[64];
+    uint8_t _grayPixels[72];
+    CGContextRef _colorContext;
+    CGContextRef _grayContext;
+}
+
++ (instancetype)sharedFingerprinter
+{
+    static MPImageFingerprinter *sharedFingerprinter = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedFingerprinter = [[self alloc] init];
+    });
+
+    return sharedFingerprinter;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _cache = [[NSCache alloc] init];
+        _cache.countLimit = kMPFingerprintCacheCountLimit;
+
+        CGColorSpaceRef rgb = CGColorSpaceCreateDeviceRGB();
+        _colorContext = CGBitmapContextCreate(_colorPixels, 8, 8, 8, 8*4, rgb, kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Little);
+        CGColorSpaceRelease(rgb);
+        CGContextSetAllowsAntialiasing(_colorContext, NO);
+        CGContextSetInterpolationQuality(_colorContext, kCGInterpolationNone);
+
+        // dHash wants a smooth average rather than point samples.
+        CGColorSpaceRef gray = CGColorSpaceCreateDeviceGray();
+        _grayContext = CGBitmapContextCreate(_grayPixels, 9, 8, 8, 9, gray, (CGBitmapInfo)kCGImageAlphaNone);
+        CGColorSpaceRelease(gray);
+        CGContextSetInterpolationQuality(_grayContext, kCGInterpolationMedium);
+
+        [[NSNotificationCenter defaultCenter] addObserver:_cache
+                                                 selector:@selector(removeAllObjects)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification
+                                                   object:nil];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:_cache];
+    CGContextRelease(_colorContext);
+    CGContextRelease(_grayContext);
+}
+
+- (NSString *)fingerprintForImage:(UIImage *)image
+{
+    return [self fingerprintsForImage:image].fingerprint;
+}
+
+- (NSString *)perceptualHashForImage:(UIImage *)image
+{
+    return [self fingerprintsForImage:image].perceptualHash;
+}
+
+- (void)prefetchFingerprintsForImages:(NSArray *)images
+{
+    @synchronized(self) {
+        for (UIImage *image in images) {
+            [self fingerprintsForImage:image];
+        }
+    }
+}
+
+- (MPImageFingerprint *)fingerprintsForImage:(UIImage *)image
+{
+    CGImageRef cgImage = image.CGImage;
+    if (cgImage == NULL) {
+        return nil;
+    }
+
+    MPImageFingerprint *fingerprints = [_cache objectForKey:(__bridge id)cgImage];
+    if (fingerprints == nil) {
+        fingerprints = [[MPImageFingerprint alloc] init];
+        @synchronized(self) {
+            fingerprints.fingerprint = [self computeFingerprintForCGImage:cgImage];
+            fingerprints.perceptualHash = [self computePerceptualHashForCGImage:cgImage];
+        }
+        [_cache setObject:fingerprints forKey:(__bridge id)cgImage];
+    }
+
+    return fingerprints;
+}
+
+#pragma mark - Computation
+
+- (NSString *)computeFingerprintForCGImage:(CGImageRef)cgImage
+{
+    CGContextClearRect(_colorContext, CGRectMake(0, 0, 8, 8));
+    CGContextDrawImage(_colorContext, CGRectMake(0, 0, 8, 8), cgImage);
+
+    uint8_t data4[32];
+    uint32_t *data32 = _colorPixels;
+    for(int i = 0; i < 32; i++) {
+        int j = 2*i;
+        int k = 2*i + 1;
+        data4[i] = (((data32[j] & 0x80000000) >> 24) | ((data32[j] & 0x800000) >> 17) | ((data32[j] & 0x8000) >> 10) | ((data32[j] & 0x80) >> 3) |
+                    ((data32[k] & 0x80000000) >> 28) | ((data32[k] & 0x800000) >> 21) | ((data32[k] & 0x8000) >> 14) | ((data32[k] & 0x80) >> 7));
+    }
+    return [[NSData dataWithBytes:data4 length:32] base64EncodedStringWithOptions:0];
+}
+
+- (NSString *)computePerceptualHashForCGImage:(CGImageRef)cgImage
+{
+    CGContextSetGrayFillColor(_grayContext, 0, 1);
+    CGContextFillRect(_grayContext, CGRectMake(0, 0, 9, 8));
+    CGContextDrawImage(_grayContext, CGRectMake(0, 0, 9, 8), cgImage);
+
+    // One bit per horizontally adjacent pair: is the left pixel brighter?
+    uint64_t hash = 0;
+    for (int y = 0; y < 8; y++) {
+        const uint8_t *row = _grayPixels + y * 9;
+        for (int x = 0; x < 8; x++) {
+            hash = (hash << 1) | (row[x] > row[x + 1] ? 1 : 0);
+        }
+    }
+    return [NSString stringWithFormat:@"%016llx", hash];
+}
+
+#pragma mark - Matching
+
+static BOOL MPParsePerceptualHash(NSString *string, uint64_t *hash)
+{
+    if (![string isKindOfClass:[NSString class]] || [string length] != 16) {
+        return NO;
+    }
+    uint64_t value = 0;
+    for (NSUInteger i = 0; i < 16; i++) {
+        unichar c = [string characterAtIndex:i];
+        uint64_t nibble;
+        if (c >= '0' && c <= '9') {
+            nibble = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            nibble = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            nibble = c - 'A' + 10;
+        } else {
+            return NO;
+        }
+        value = (value << 4) | nibble;
+    }
+    *hash = value;
+    return YES;
+}
+
++ (NSUInteger)hammingDistanceBetweenPerceptualHash:(NSString *)hash andPerceptualHash:(NSString *)otherHash
+{
+    uint64_t a, b;
+    if (!MPParsePerceptualHash(hash, &a) || !MPParsePerceptualHash(otherHash, &b)) {
+        return NSNotFound;
+    }
+    return (NSUInteger)__builtin_popcountll(a ^ b);
+}
+
+@end
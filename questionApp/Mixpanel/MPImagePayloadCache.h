@@ -0,0 +1,28 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+
+#import <UIKit/UIKit.h>
+
+@interface MPImagePayload : NSObject
+
+@property (nonatomic, readonly, copy) NSString *contentHash;
+@property (nonatomic, readonly, copy) NSString *base64Data;
+
+@end
+
+/*!
+ Content-addressed cache of PNG/base64 encoded image payloads.
+
+ Images are looked up first by the identity of their backing CGImage and then
+ by a hash of their pixel data, so an unchanged image is only PNG encoded once
+ no matter how many snapshots it appears in. Both tables are bounded and are
+ emptied when the application receives a memory warning.
+ */
+@interface MPImagePayloadCache : NSObject
+
++ (instancetype)sharedCache;
+
+- (MPImagePayload *)payloadForImage:(UIImage *)image;
+- (void)removeAllPayloads;
+
+@end
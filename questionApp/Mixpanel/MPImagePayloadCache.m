@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2014 Mixpanel. All rights reserved.
+
+#if ! __has_feature(objc_arc)
+#error This file must be compiled with ARC. Either turn on ARC for the project or use -fobjc-arc flag on this file.
+#endif
+
+#import <CommonCrypto/CommonDigest.h>
+#import "MPImagePayloadCache.h"
+#import "NSData+MPBase64.h"
+
+static const NSUInteger kMPImageIdentityCountLimit = 512;
+static const NSUInteger kMPImagePayloadCostLimit = 8 * 1024 * 1024;
+
+@interface MPImagePayload ()
+
+- (instancetype)initWithContentHash:(NSString *)contentHash base64Data:(NSString *)base64Data;
+
+@end
+
+@implementation MPImagePayload
+
+- (instancetype)initWithContentHash:(NSString *)contentHash base64Data:(NSString *)base64Data
+{
+    self = [super init];
+    if (self) {
+        _contentHash = [contentHash copy];
+        _base64Data = [base64Data copy];
+    }
+
+    return self;
+}
+
+@end
+
+@implementation MPImagePayloadCache
+
+{
+    // CGImageRef -> content hash. NSCache retains its keys, so a cached CGImage
+    // cannot be freed and have its address reused by a different image.
+    NSCache *_identityCache;
+    // content hash -> MPImagePayload, costed by the size of the base64 string.
+    NSCache *_payloadCache;
+}
+
++ (instancetype)sharedCache
+{
+    static MPImagePayloadCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[self alloc] init];
+    });
+
+    return sharedCache;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _identityCache = [[NSCache alloc] init];
+        _identityCache.countLimit = kMPImageIdentityCountLimit;
+        _payloadCache = [[NSCache alloc] init];
+        _payloadCache.totalCostLimit = kMPImagePayloadCostLimit;
+
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(removeAllPayloads)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification
+                                                   object:nil];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (void)removeAllPayloads
+{
+    [_identityCache removeAllObjects];
+    [_payloadCache removeAllObjects];
+}
+
+- (MPImagePayload *)payloadForImage:(UIImage *)image
+{
+    if (image == nil) {
+        return nil;
+    }
+
+    CGImageRef cgImage = image.CGImage;
+    NSString *contentHash = nil;
+    if (cgImage) {
+        contentHash = [_identityCache objectForKey:(__bridge id)cgImage];
+        if (contentHash == nil) {
+            contentHash = [self contentHashForCGImage:cgImage];
+            if (contentHash) {
+                [_identityCache setObject:contentHash forKey:(__bridge id)cgImage];
+            }
+        }
+    }
+
+    MPImagePayload *payload = contentHash ? [_payloadCache objectForKey:contentHash] : nil;
+    if (payload == nil) {
+        NSData *imageRep = UIImagePNGRepresentation(image);
+        if (contentHash == nil) {
+            // Not backed by a bitmap we can read (e.g. CIImage based), fall back to hashing the encoded data.
+            contentHash = [self hexDigestForBytes:imageRep.bytes length:imageRep.length];
+        }
+        NSString *base64Data = imageRep ? [imageRep mp_base64EncodedString] : nil;
+        payload = [[MPImagePayload alloc] initWithContentHash:contentHash base64Data:base64Data];
+        if (contentHash) {
+            [_payloadCache setObject:payload forKey:contentHash cost:[base64Data length]];
+        }
+    }
+
+    return payload;
+}
+
+#pragma mark - Hashing
+
+- (NSString *)contentHashForCGImage:(CGImageRef)cgImage
+{
+    CGDataProviderRef provider = CGImageGetDataProvider(cgImage);
+    if (provider == NULL) {
+        return nil;
+    }
+    CFDataRef pixelData = CGDataProviderCopyData(provider);
+    if (pixelData == NULL) {
+        return nil;
+    }
+
+    // The layout is part of the identity: the same bytes with a different
+    // geometry or pixel format are a different image.
+    size_t layout[] = {
+        CGImageGetWidth(cgImage),
+        CGImageGetHeight(cgImage),
+        CGImageGetBytesPerRow(cgImage),
+        CGImageGetBitsPerPixel(cgImage),
+        (size_t)CGImageGetBitmapInfo(cgImage),
+    };
+
+    CC_SHA1_CTX ctx;
+    CC_SHA1_Init(&ctx);
+    CC_SHA1_Update(&ctx, layout, (CC_LONG)sizeof(layout));
+    CC_SHA1_Update(&ctx, CFDataGetBytePtr(pixelData), (CC_LONG)CFDataGetLength(pixelData));
+    uint8_t digest[CC_SHA1_DIGEST_LENGTH];
+    CC_SHA1_Final(digest, &ctx);
+    CFRelease(pixelData);
+
+    return [self hexStringForDigest:digest];
+}
+
+- (NSString *)hexDigestForBytes:(const void *)bytes length:(NSUInteger)length
+{
+    if (bytes == NULL) {
+        return nil;
+    }
+    uint8_t digest[CC_SHA1_DIGEST_LENGTH];
+    CC_SHA1(bytes, (CC_LONG)length, digest);
+    return [self hexStringForDigest:digest];
+}
+
+- (NSString *)hexStringForDigest:(const uint8_t *)digest
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    char hex[CC_SHA1_DIGEST_LENGTH * 2 + 1];
+    for (NSUInteger i = 0; i < CC_SHA1_DIGEST_LENGTH; i++) {
+        hex[2 * i] = hexDigits[digest[i] >> 4];
+        hex[2 * i + 1] = hexDigits[digest[i] & 0x0f];
+    }
+    hex[CC_SHA1_DIGEST_LENGTH * 2] = '\0';
+    return [NSString stringWithUTF8String:hex];
+}
+
+@end
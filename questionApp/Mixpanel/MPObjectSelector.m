@@ -8,6 +8,8 @@
 
 #import <objc/runtime.h>
 #import <UIKit/UIKit.h>
+#import "MPCategoryHelpers.h"
+#import "MPImageFingerprinter.h"
 #import "MPObjectSelector.h"
 #import "NSData+MPBase64.h"
 
@@ -18,6 +20,7 @@
 @property (nonatomic, strong) NSNumber *index;
 @property (nonatomic, assign) BOOL unique;
 @property (nonatomic, assign) BOOL nameOnly;
+@property (nonatomic, assign) BOOL usesImageFingerprints;
 
 - (NSArray *)apply:(NSArray *)views;
 - (NSArray *)applyReverse:(NSArray *)views;
@@ -167,6 +170,8 @@
                 filter.index = @((NSUInteger)index);
             } else {
                 [_scanner scanUpToCharactersFromSet:_predicateEndChar intoString:&predicateFormat];
+                filter.usesImageFingerprints = ([predicateFormat rangeOfString:@"mp_varC"].location != NSNotFound ||
+                                                [predicateFormat rangeOfString:@"mp_image"].location != NSNotFound);
                 @try {
                     NSPredicate *parsedPredicate = [NSPredicate predicateWithFormat:predicateFormat];
                     filter.predicate = [NSPredicate predicateWithBlock:^BOOL(id evaluatedObject, NSDictionary *bindings) {
@@ -247,12 +252,35 @@
         }
         // Filter any resulting views by predicate
         if (self.predicate) {
+            if (self.usesImageFingerprints) {
+                [self prefetchImageFingerprintsForViews:result];
+            }
             return [result filteredArrayUsingPredicate:self.predicate];
         }
     }
     return [result copy];
 }
 
+/*
+ Fingerprint every candidate's image in one batch before the predicate
+ asks for them one view at a time.
+ */
+- (void)prefetchImageFingerprintsForViews:(NSArray *)views
+{
+    NSMutableArray *images = [NSMutableArray array];
+    for (NSObject *view in views) {
+        if ([view isKindOfClass:[UIView class]]) {
+            UIImage *image = [(UIView *)view mp_fingerprintImage];
+            if (image) {
+                [images addObject:image];
+            }
+        }
+    }
+    if ([images count] > 0) {
+        [[MPImageFingerprinter sharedFingerprinter] prefetchFingerprintsForImages:images];
+    }
+}
+
 /*
  Apply this filter to the views. For any view that
  matches this filter's class / predicate pattern, return
@@ -2,12 +2,21 @@
 // Copyright (c) 2014 Mixpanel. All rights reserved.
 
 #import <ImageIO/ImageIO.h>
+#import "MPImagePayloadCache.h"
 #import "MPValueTransformers.h"
 #import "NSData+MPBase64.h"
 
 @implementation MPUIImageToNSDictionaryValueTransformer
 
 static NSMutableDictionary *imageCache;
+static NSMutableSet *deliveredImageHashes;
+
++ (void)setDeliveredImageHashes:(NSMutableSet *)hashes
+{
+    @synchronized(self) {
+        deliveredImageHashes = hashes;
+    }
+}
 
 + (void)load {
     imageCache = [NSMutableDictionary dictionary];
@@ -39,16 +48,35 @@ static NSMutableDictionary *imageCache;
 
         NSArray *images = image.images ?: @[ image ];
 
+        NSMutableSet *delivered = nil;
+        @synchronized([self class]) {
+            delivered = deliveredImageHashes;
+        }
+
         NSMutableArray *imageDictionaries = [[NSMutableArray alloc] init];
         for (UIImage *frame in images) {
-            NSData *imageRep = UIImagePNGRepresentation(frame);
-            NSDictionary *imageDictionary = @{
+            MPImagePayload *payload = [[MPImagePayloadCache sharedCache] payloadForImage:frame];
+            NSMutableDictionary *imageDictionary = [@{
                 @"scale": @(image.scale),
                 @"mime_type" : @"image/png",
-                @"data": ((imageRep != nil) ? [imageRep mp_base64EncodedString] : [NSNull null])
-            };
+            } mutableCopy];
+
+            if (payload.contentHash) {
+                imageDictionary[@"image_hash"] = payload.contentHash;
+            }
+
+            // The designer keeps every image it has received during this session,
+            // so after the first delivery only the hash needs to go over the wire.
+            if (payload.contentHash && payload.base64Data && [delivered containsObject:payload.contentHash]) {
+                imageDictionary[@"data"] = [NSNull null];
+            } else {
+                imageDictionary[@"data"] = payload.base64Data ?: [NSNull null];
+                if (payload.contentHash && payload.base64Data) {
+                    [delivered addObject:payload.contentHash];
+                }
+            }
 
-            [imageDictionaries addObject:imageDictionary];
+            [imageDictionaries addObject:[imageDictionary copy]];
         }
 
         NSInteger renderingMode = 0;
@@ -53,6 +53,13 @@
 
 @interface MPUIImageToNSDictionaryValueTransformer : NSValueTransformer
 
+/*!
+ Hashes of images the designer already holds. While set, images whose hash is
+ in the set are serialized as a reference (image_hash with null data) and newly
+ sent images are added to it. Pass nil to always send full image data.
+ */
++ (void)setDeliveredImageHashes:(NSMutableSet *)hashes;
+
 @end
 
 @interface MPNSNumberToCGFloatValueTransformer : NSValueTransformer
@@ -1,8 +1,15 @@
 #import <UIKit/UIKit.h>
+#import "MPDominantColor.h"
 
 @interface UIImage (MPAverageColor)
 
 - (UIColor *)mp_averageColor;
 - (UIColor *)mp_importantColor;
 
+// Dominant color of the given rect (in points), sampled from a downscaled copy.
+// Returns nil if every sampled pixel was filtered out (transparent, white, gray...).
+- (UIColor *)mp_dominantColorInRect:(CGRect)rect refinement:(mp_dominant_color_refinement)refinement;
+// Same as above on a background queue; completion is called on the main queue.
+- (void)mp_dominantColorInRect:(CGRect)rect refinement:(mp_dominant_color_refinement)refinement completion:(void (^)(UIColor *color))completion;
+
 @end
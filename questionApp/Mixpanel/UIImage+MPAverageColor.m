@@ -4,6 +4,9 @@
 
 #import "UIImage+MPAverageColor.h"
 
+static const CGFloat kMPDominantColorSampleSize = 64.0f;
+static const unsigned kMPDominantColorClusterCount = 5;
+
 @implementation UIImage (MPAverageColor)
 
 - (UIColor *)mp_averageColor
@@ -24,43 +27,74 @@
 
 - (UIColor *)mp_importantColor
 {
-    UIGraphicsBeginImageContext(self.size);
-    CGContextRef ctx = UIGraphicsGetCurrentContext();
+    // only attempt to quantize the header
+    CGRect header = CGRectMake(0.0f, 40.0f, self.size.width, 84.0f);
+    return [self mp_dominantColorInRect:header refinement:MP_DOMINANT_COLOR_HISTOGRAM];
+}
 
-    [self drawInRect:(CGRect){.size = self.size} blendMode:kCGBlendModeCopy alpha:1];
-    uint8_t *data = CGBitmapContextGetData(ctx);
+- (UIColor *)mp_dominantColorInRect:(CGRect)rect refinement:(mp_dominant_color_refinement)refinement
+{
+    CGRect bounds = (CGRect){.size = self.size};
+    rect = CGRectIntersection(CGRectStandardize(rect), bounds);
+    if (CGRectIsNull(rect) || CGRectIsEmpty(rect)) {
+        rect = bounds;
+    }
+    if (CGRectIsEmpty(rect)) {
+        return nil;
+    }
 
-    NSUInteger indexes = 262144;
-    char colorIndices[262144] = {0};
+    // A dominant color does not need every pixel; never sample more than 64x64.
+    CGFloat sampleScale = MIN(1.0f, MIN(kMPDominantColorSampleSize / rect.size.width, kMPDominantColorSampleSize / rect.size.height));
+    size_t width = MAX((size_t)1, (size_t)ceil(rect.size.width * sampleScale));
+    size_t height = MAX((size_t)1, (size_t)ceil(rect.size.height * sampleScale));
+    size_t rowBytes = width * 4;
+    uint8_t *pixels = calloc(height, rowBytes);
+    mp_color_histogram *histogram = malloc(sizeof(mp_color_histogram));
+    if (pixels == NULL || histogram == NULL) {
+        free(pixels);
+        free(histogram);
+        return nil;
+    }
 
-    // only attempt to quantize the header
-    NSUInteger l = (NSUInteger) ceil(self.size.width * 124.0f);
-    for (NSUInteger i = 40 * 640; i < l; i++) {
-        uint8_t red = data[i * 4 + 2];
-        uint8_t green = data[i * 4 + 1];
-        uint8_t blue = data[i * 4 + 0];
-        NSInteger hexColor = (red >> 2) + ((green >> 2) << 6) + ((blue >> 2) << 12);
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef ctx = CGBitmapContextCreate(pixels, width, height, 8, rowBytes, colorSpace, (CGBitmapInfo)kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little);
+    CGColorSpaceRelease(colorSpace);
+    CGContextSetInterpolationQuality(ctx, kCGInterpolationMedium);
+    CGContextTranslateCTM(ctx, 0.0f, height);
+    CGContextScaleCTM(ctx, width / rect.size.width, -(CGFloat)height / rect.size.height);
+    CGContextTranslateCTM(ctx, -rect.origin.x, -rect.origin.y);
+    UIGraphicsPushContext(ctx);
+    [self drawInRect:bounds blendMode:kCGBlendModeCopy alpha:1];
+    UIGraphicsPopContext();
+    CGContextRelease(ctx);
 
-        if (hexColor > 0 && hexColor < 2621443 && red + green + blue < 255 + 255 + 200 && red != blue && blue != green && green != red) {
-            colorIndices[hexColor]++;
-        }
-    }
+    mp_color_histogram_reset(histogram);
+    mp_color_histogram_add_pixels(histogram, pixels, width, height, rowBytes, MP_DOMINANT_COLOR_DEFAULT_FILTERS);
+    free(pixels);
 
-    NSUInteger index = 0;
-    char max = 0;
-    for (NSUInteger i = 0; i < indexes; i++) {
-        if (colorIndices[i] > max) {
-            max = colorIndices[i];
-            index = i;
-        }
+    mp_dominant_color dominant;
+    BOOL found = mp_color_histogram_dominant_color(histogram, refinement, kMPDominantColorClusterCount, &dominant) == 0;
+    free(histogram);
+    if (!found) {
+        return nil;
     }
 
-    UIColor *color = [UIColor colorWithRed:(((index & 63) << 2) + 3) / 255.0f
-									 green:(((index >> 4) & 252) + 3) / 255.0f
-									  blue:(((index >> 10) & 252) + 3) / 255.0f
-									 alpha:1];
-	UIGraphicsEndImageContext();
-	return color;
+    return [UIColor colorWithRed:dominant.red / 255.0f
+                           green:dominant.green / 255.0f
+                            blue:dominant.blue / 255.0f
+                           alpha:1];
+}
+
+- (void)mp_dominantColorInRect:(CGRect)rect refinement:(mp_dominant_color_refinement)refinement completion:(void (^)(UIColor *color))completion
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        UIColor *color = [self mp_dominantColorInRect:rect refinement:refinement];
+        if (completion) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                completion(color);
+            });
+        }
+    });
 }
 
 @end
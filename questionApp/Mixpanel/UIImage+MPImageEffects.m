@@ -97,12 +97,34 @@
 #error This file must be compiled with ARC. Either turn on ARC for the project or use -fobjc-arc flag on this file.
 #endif
 
-#import <Accelerate/Accelerate.h>
 #import <float.h>
+#import "MPBlurCore.h"
 #import "MPLogger.h"
 #import "UIColor+MPColor.h"
 #import "UIImage+MPImageEffects.h"
 
+// All blurs share one set of pixel buffers, so they are serialized on this queue.
+static mp_blur_pool *mp_imageEffectsPool;
+
+static dispatch_queue_t mp_imageEffectsQueue(void)
+{
+    static dispatch_queue_t queue;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        queue = dispatch_queue_create("com.mixpanel.imageEffects", DISPATCH_QUEUE_SERIAL);
+        mp_imageEffectsPool = mp_blur_pool_create();
+        [[NSNotificationCenter defaultCenter] addObserverForName:UIApplicationDidReceiveMemoryWarningNotification
+                                                          object:nil
+                                                           queue:nil
+                                                      usingBlock:^(NSNotification *note) {
+                                                          dispatch_async(queue, ^{
+                                                              mp_blur_pool_trim(mp_imageEffectsPool);
+                                                          });
+                                                      }];
+    });
+    return queue;
+}
+
 @implementation UIImage (MPImageEffects)
 
 
@@ -148,102 +170,122 @@
 
 
 - (UIImage *)mp_applyBlurWithRadius:(CGFloat)blurRadius tintColor:(UIColor *)tintColor saturationDeltaFactor:(CGFloat)saturationDeltaFactor maskImage:(UIImage *)maskImage
+{
+    if (![self mp_canApplyEffectWithMaskImage:maskImage]) {
+        return nil;
+    }
+
+    CGFloat scale = [[UIScreen mainScreen] scale];
+    __block UIImage *outputImage = nil;
+    dispatch_sync(mp_imageEffectsQueue(), ^{
+        outputImage = [self mp_effectImageWithRadius:blurRadius tintColor:tintColor saturationDeltaFactor:saturationDeltaFactor maskImage:maskImage scale:scale];
+    });
+    return outputImage;
+}
+
+
+- (void)mp_applyBlurWithRadius:(CGFloat)blurRadius tintColor:(UIColor *)tintColor saturationDeltaFactor:(CGFloat)saturationDeltaFactor maskImage:(UIImage *)maskImage completion:(void (^)(UIImage *image))completion
+{
+    if (![self mp_canApplyEffectWithMaskImage:maskImage]) {
+        if (completion) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                completion(nil);
+            });
+        }
+        return;
+    }
+
+    CGFloat scale = [[UIScreen mainScreen] scale];
+    dispatch_async(mp_imageEffectsQueue(), ^{
+        UIImage *outputImage = [self mp_effectImageWithRadius:blurRadius tintColor:tintColor saturationDeltaFactor:saturationDeltaFactor maskImage:maskImage scale:scale];
+        if (completion) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                completion(outputImage);
+            });
+        }
+    });
+}
+
+
+#pragma mark - Effect pipeline
+
+- (BOOL)mp_canApplyEffectWithMaskImage:(UIImage *)maskImage
 {
     // Check pre-conditions.
     if (self.size.width < 1 || self.size.height < 1) {
         MixpanelError(@"*** error: invalid size: (%.2f x %.2f). Both dimensions must be >= 1: %@", self.size.width, self.size.height, self);
-        return nil;
+        return NO;
     }
     if (!self.CGImage) {
         MixpanelError(@"*** error: image must be backed by a CGImage: %@", self);
-        return nil;
+        return NO;
     }
     if (maskImage && !maskImage.CGImage) {
         MixpanelError(@"*** error: maskImage must be backed by a CGImage: %@", maskImage);
-        return nil;
+        return NO;
     }
+    return YES;
+}
+
 
+// Must be called on mp_imageEffectsQueue.
+- (UIImage *)mp_effectImageWithRadius:(CGFloat)blurRadius tintColor:(UIColor *)tintColor saturationDeltaFactor:(CGFloat)saturationDeltaFactor maskImage:(UIImage *)maskImage scale:(CGFloat)scale
+{
     CGRect imageRect = { CGPointZero, self.size };
-    UIImage *effectImage = self;
+    CGImageRef effectImage = NULL;
 
+    // The saturation change only ever shows through the blurred layer, so
+    // without a blur there is nothing to compute.
     BOOL hasBlur = blurRadius > __FLT_EPSILON__;
     BOOL hasSaturationChange = fabs(saturationDeltaFactor - 1.) > __FLT_EPSILON__;
-    if (hasBlur || hasSaturationChange) {
-        UIGraphicsBeginImageContextWithOptions(self.size, NO, [[UIScreen mainScreen] scale]);
-        CGContextRef effectInContext = UIGraphicsGetCurrentContext();
-        CGContextScaleCTM(effectInContext, 1.0, -1.0);
-        CGContextTranslateCTM(effectInContext, 0, -self.size.height);
-        CGContextDrawImage(effectInContext, imageRect, self.CGImage);
-
-        vImage_Buffer effectInBuffer;
-        effectInBuffer.data     = CGBitmapContextGetData(effectInContext);
-        effectInBuffer.width    = CGBitmapContextGetWidth(effectInContext);
-        effectInBuffer.height   = CGBitmapContextGetHeight(effectInContext);
-        effectInBuffer.rowBytes = CGBitmapContextGetBytesPerRow(effectInContext);
-
-        UIGraphicsBeginImageContextWithOptions(self.size, NO, [[UIScreen mainScreen] scale]);
-        CGContextRef effectOutContext = UIGraphicsGetCurrentContext();
-        vImage_Buffer effectOutBuffer;
-        effectOutBuffer.data     = CGBitmapContextGetData(effectOutContext);
-        effectOutBuffer.width    = CGBitmapContextGetWidth(effectOutContext);
-        effectOutBuffer.height   = CGBitmapContextGetHeight(effectOutContext);
-        effectOutBuffer.rowBytes = CGBitmapContextGetBytesPerRow(effectOutContext);
-
-        if (hasBlur) {
-            // A description of how to compute the box kernel width from the Gaussian
-            // radius (aka standard deviation) appears in the SVG spec:
-            // http://www.w3.org/TR/SVG/filters.html#feGaussianBlurElement
-            //
-            // For larger values of 's' (s >= 2.0), an approximation can be used: Three
-            // successive box-blurs build a piece-wise quadratic convolution kernel, which
-            // approximates the Gaussian kernel to within roughly 3%.
-            //
-            // let d = floor(s * 3*sqrt(2*pi)/4 + 0.5)
-            //
-            // ... if d is odd, use three box-blurs of size 'd', centered on the output pixel.
-            //
-            CGFloat inputRadius = blurRadius * [[UIScreen mainScreen] scale];
-            uint32_t radius = (uint32_t)floor(inputRadius * 3. * sqrt(2 * M_PI) / 4 + 0.5);
-            if (radius % 2 != 1) {
-                radius += 1; // force radius to be odd so that the three box-blur methodology works.
-            }
-            vImageBoxConvolve_ARGB8888(&effectInBuffer, &effectOutBuffer, NULL, 0, 0, radius, radius, 0, kvImageEdgeExtend);
-            vImageBoxConvolve_ARGB8888(&effectOutBuffer, &effectInBuffer, NULL, 0, 0, radius, radius, 0, kvImageEdgeExtend);
-            vImageBoxConvolve_ARGB8888(&effectInBuffer, &effectOutBuffer, NULL, 0, 0, radius, radius, 0, kvImageEdgeExtend);
+    if (hasBlur) {
+        // The result is heavily blurred anyway, so work on a downsampled copy
+        // and let the final draw scale it back up.
+        uint32_t boxSize = mp_blur_box_size_for_radius(blurRadius * scale);
+        size_t factor = mp_blur_downsample_factor(boxSize);
+        size_t width = (size_t)ceil(self.size.width * scale / factor);
+        size_t height = (size_t)ceil(self.size.height * scale / factor);
+        size_t rowBytes = width * 4;
+
+        uint8_t *pixels = mp_blur_pool_buffer(mp_imageEffectsPool, MP_BLUR_POOL_SOURCE, rowBytes * height);
+        if (pixels == NULL) {
+            MixpanelError(@"*** error: could not allocate %zux%zu effect buffer", width, height);
+            return nil;
         }
-        BOOL effectImageBuffersAreSwapped = NO;
+
+        CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+        CGBitmapInfo bitmapInfo = (CGBitmapInfo)kCGImageAlphaPremultipliedFirst | kCGBitmapByteOrder32Little;
+        CGContextRef effectContext = CGBitmapContextCreate(pixels, width, height, 8, rowBytes, colorSpace, bitmapInfo);
+        CGContextSetInterpolationQuality(effectContext, kCGInterpolationMedium);
+        CGContextClearRect(effectContext, CGRectMake(0, 0, width, height));
+        CGContextDrawImage(effectContext, CGRectMake(0, 0, width, height), self.CGImage);
+        CGContextRelease(effectContext);
+
+        mp_blur_image buffer = { pixels, width, height, rowBytes };
+        if (mp_blur_box3(&buffer, mp_blur_box_size_for_radius(blurRadius * scale / factor), mp_imageEffectsPool) != 0) {
+            MixpanelError(@"*** error: could not allocate blur scratch buffer, returning the image unblurred");
+            CGColorSpaceRelease(colorSpace);
+            return self;
+        }
+
         if (hasSaturationChange) {
-            CGFloat s = saturationDeltaFactor;
-            CGFloat floatingPointSaturationMatrix[] = {
-                0.0722f + 0.9278f * s,  0.0722f - 0.0722f * s,  0.0722f - 0.0722f * s,  0,
-                0.7152f - 0.7152f * s,  0.7152f + 0.2848f * s,  0.7152f - 0.7152f * s,  0,
-                0.2126f - 0.2126f * s,  0.2126f - 0.2126f * s,  0.2126f + 0.7873f * s,  0,
-                0,                    0,                    0,  1,
-            };
             const int32_t divisor = 256;
-            NSUInteger matrixSize = sizeof(floatingPointSaturationMatrix)/sizeof(floatingPointSaturationMatrix[0]);
-            int16_t saturationMatrix[matrixSize];
-            for (NSUInteger i = 0; i < matrixSize; ++i) {
-                saturationMatrix[i] = (int16_t)round(floatingPointSaturationMatrix[i] * divisor);
-            }
-            if (hasBlur) {
-                vImageMatrixMultiply_ARGB8888(&effectOutBuffer, &effectInBuffer, saturationMatrix, divisor, NULL, NULL, kvImageNoFlags);
-                effectImageBuffersAreSwapped = YES;
-            } else {
-                vImageMatrixMultiply_ARGB8888(&effectInBuffer, &effectOutBuffer, saturationMatrix, divisor, NULL, NULL, kvImageNoFlags);
-            }
+            int16_t saturationMatrix[16];
+            mp_blur_saturation_matrix(saturationDeltaFactor, saturationMatrix, divisor);
+            mp_blur_color_matrix(&buffer, saturationMatrix, divisor);
         }
-        if (!effectImageBuffersAreSwapped)
-            effectImage = UIGraphicsGetImageFromCurrentImageContext();
-        UIGraphicsEndImageContext();
 
-        if (effectImageBuffersAreSwapped)
-            effectImage = UIGraphicsGetImageFromCurrentImageContext();
-        UIGraphicsEndImageContext();
+        // The pooled buffer is reused by the next call, so the image gets its own copy.
+        CFDataRef effectData = CFDataCreate(NULL, pixels, (CFIndex)(rowBytes * height));
+        CGDataProviderRef provider = CGDataProviderCreateWithCFData(effectData);
+        effectImage = CGImageCreate(width, height, 8, 32, rowBytes, colorSpace, bitmapInfo, provider, NULL, false, kCGRenderingIntentDefault);
+        CGDataProviderRelease(provider);
+        CFRelease(effectData);
+        CGColorSpaceRelease(colorSpace);
     }
 
     // Set up output context.
-    UIGraphicsBeginImageContextWithOptions(self.size, NO, [[UIScreen mainScreen] scale]);
+    UIGraphicsBeginImageContextWithOptions(self.size, NO, scale);
     CGContextRef outputContext = UIGraphicsGetCurrentContext();
     CGContextScaleCTM(outputContext, 1.0, -1.0);
     CGContextTranslateCTM(outputContext, 0, -self.size.height);
@@ -252,13 +294,15 @@
     CGContextDrawImage(outputContext, imageRect, self.CGImage);
 
     // Draw effect image.
-    if (hasBlur) {
+    if (effectImage) {
         CGContextSaveGState(outputContext);
         if (maskImage) {
             CGContextClipToMask(outputContext, imageRect, maskImage.CGImage);
         }
-        CGContextDrawImage(outputContext, imageRect, effectImage.CGImage);
+        CGContextSetInterpolationQuality(outputContext, kCGInterpolationHigh);
+        CGContextDrawImage(outputContext, imageRect, effectImage);
         CGContextRestoreGState(outputContext);
+        CGImageRelease(effectImage);
     }
 
     // Add in color tint.
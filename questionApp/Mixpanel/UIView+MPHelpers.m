@@ -6,9 +6,35 @@
 #import <QuartzCore/QuartzCore.h>
 #import <CommonCrypto/CommonDigest.h>
 #import "MPCategoryHelpers.h"
+#import "MPImageFingerprinter.h"
 
 // NB If you add any more fingerprint methods, increment this.
-#define MP_FINGERPRINT_VERSION 1
+#define MP_FINGERPRINT_VERSION 2
+
+/*
+ Per-view memo of the hashed identifiers below. Each digest is stored with the
+ input it was derived from and is only recomputed when that input changes, so
+ repeated selector evaluation over a view tree does not rehash anything.
+ */
+@interface MPViewIdentifierMemo : NSObject
+
+@property (nonatomic, copy) NSString *viewIdDigest;
+@property (nonatomic, weak) UIViewController *controller;
+@property (nonatomic, assign) Ivar controllerIvar;
+@property (nonatomic, copy) NSString *controllerVariable;
+@property (nonatomic, copy) NSString *controllerVariableDigest;
+@property (nonatomic, copy) NSString *imageFingerprint;
+@property (nonatomic, copy) NSString *imageFingerprintDigest;
+@property (nonatomic, copy) NSArray *targetActions;
+@property (nonatomic, copy) NSArray *targetActionDigests;
+@property (nonatomic, copy) NSString *text;
+@property (nonatomic, copy) NSString *textDigest;
+
+@end
+
+@implementation MPViewIdentifierMemo
+
+@end
 
 @implementation UIView (MPHelpers)
 
@@ -87,6 +113,7 @@
 - (void)setMixpanelViewId:(id)object
 {
     objc_setAssociatedObject(self, @selector(mixpanelViewId), [object copy], OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    [self mp_identifierMemo].viewIdDigest = nil;
 }
 
 - (NSString *)mp_viewId
@@ -119,6 +146,17 @@
     return result;
 }
 
+- (UIImage *)mp_fingerprintImage
+{
+    UIImage *image = nil;
+    if ([self isKindOfClass:[UIButton class]]) {
+        image = [((UIButton *)self) imageForState:UIControlStateNormal];
+    } else if ([NSStringFromClass([self class]) isEqual:@"UITabBarButton"] && [self.subviews count] > 0 && [self.subviews[0] respondsToSelector:NSSelectorFromString(@"image")]) {
+        image = [self.subviews[0] image];
+    }
+    return image;
+}
+
 /*
  Creates a short string which is a fingerprint of a UIButton's image property.
  It does this by downsampling the image to 8x8 and then downsampling the resulting
@@ -130,34 +168,28 @@
  */
 - (NSString *)mp_imageFingerprint
 {
-    NSString *result = nil;
-    UIImage *originalImage = nil;
-    if ([self isKindOfClass:[UIButton class]]) {
-        originalImage = [((UIButton *)self) imageForState:UIControlStateNormal];
-    } else if ([NSStringFromClass([self class]) isEqual:@"UITabBarButton"] && [self.subviews count] > 0 && [self.subviews[0] respondsToSelector:NSSelectorFromString(@"image")]) {
-        originalImage = [self.subviews[0] image];
-    }
-    
-    if (originalImage) {
-        CGColorSpaceRef space = CGColorSpaceCreateDeviceRGB();
-        uint32_t data32[64];
-        uint8_t data4[32];
-        CGContextRef context = CGBitmapContextCreate(data32, 8, 8, 8, 8*4, space, kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Little);
-        CGContextSetAllowsAntialiasing(context, NO);
-        CGContextClearRect(context, CGRectMake(0, 0, 8, 8));
-        CGContextSetInterpolationQuality(context, kCGInterpolationNone);
-        CGContextDrawImage(context, CGRectMake(0,0,8,8), [originalImage CGImage]);
-        CGColorSpaceRelease(space);
-        CGContextRelease(context);
-        for(int i = 0; i < 32; i++) {
-            int j = 2*i;
-            int k = 2*i + 1;
-            data4[i] = (((data32[j] & 0x80000000) >> 24) | ((data32[j] & 0x800000) >> 17) | ((data32[j] & 0x8000) >> 10) | ((data32[j] & 0x80) >> 3) |
-                        ((data32[k] & 0x80000000) >> 28) | ((data32[k] & 0x800000) >> 21) | ((data32[k] & 0x8000) >> 14) | ((data32[k] & 0x80) >> 7));
-        }
-        result = [[NSData dataWithBytes:data4 length:32] base64EncodedStringWithOptions:0];
-    }
-    return result;
+    return [[MPImageFingerprinter sharedFingerprinter] fingerprintForImage:[self mp_fingerprintImage]];
+}
+
+/*
+ Returns a 64 bit difference hash of the same image as 16 hex characters. Unlike
+ mp_imageFingerprint it is meant to be compared by Hamming distance, see
+ mp_imageHashDistance:.
+ */
+- (NSString *)mp_imagePerceptualHash
+{
+    return [[MPImageFingerprinter sharedFingerprinter] perceptualHashForImage:[self mp_fingerprintImage]];
+}
+
+/*
+ Hamming distance between this view's perceptual hash and the given one, for use in
+ selector predicates such as FUNCTION(SELF, 'mp_imageHashDistance:', 'c3c3e7ff00ff8181') <= 6.
+ Returns nil when there is no image or the hash is malformed.
+ */
+- (NSNumber *)mp_imageHashDistance:(NSString *)perceptualHash
+{
+    NSUInteger distance = [MPImageFingerprinter hammingDistanceBetweenPerceptualHash:[self mp_imagePerceptualHash] andPerceptualHash:perceptualHash];
+    return distance == NSNotFound ? nil : @(distance);
 }
 
 - (NSString *)mp_text
@@ -181,49 +213,126 @@
         
 static NSString* mp_encryptHelper(id input)
 {
+    static NSCache *digestCache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        digestCache = [[NSCache alloc] init];
+        digestCache.countLimit = 1024;
+    });
+
     NSString *SALT = @"1l0v3c4a8s4n018cl3d93kxled3kcle3j19384jdo2dk3";
-    NSMutableString *encryptedStuff = nil;
+    NSString *encryptedStuff = nil;
     if ([input isKindOfClass:[NSString class]]) {
+        encryptedStuff = [digestCache objectForKey:input];
+        if (encryptedStuff) {
+            return encryptedStuff;
+        }
+
         NSData *data = [[input stringByAppendingString:SALT]  dataUsingEncoding:NSASCIIStringEncoding];
         uint8_t digest[CC_SHA256_DIGEST_LENGTH];
         CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
-        encryptedStuff = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+
+        // Only the first 20 bytes of the digest have ever been sent, keep it that way.
+        static const char hexDigits[] = "0123456789abcdef";
+        char hex[CC_SHA1_DIGEST_LENGTH * 2];
         for (int i = 0; i < CC_SHA1_DIGEST_LENGTH; i++) {
-            [encryptedStuff appendFormat:@"%02x", digest[i]];
+            hex[2 * i] = hexDigits[digest[i] >> 4];
+            hex[2 * i + 1] = hexDigits[digest[i] & 0x0f];
         }
+        encryptedStuff = [[NSString alloc] initWithBytes:hex length:sizeof(hex) encoding:NSASCIIStringEncoding];
+        [digestCache setObject:encryptedStuff forKey:[input copy]];
     }
     return encryptedStuff;
 }
 
+- (MPViewIdentifierMemo *)mp_identifierMemo
+{
+    MPViewIdentifierMemo *memo = objc_getAssociatedObject(self, @selector(mp_identifierMemo));
+    if (memo == nil) {
+        memo = [[MPViewIdentifierMemo alloc] init];
+        objc_setAssociatedObject(self, @selector(mp_identifierMemo), memo, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    return memo;
+}
+
+static BOOL mp_isEqualOrBothNil(id a, id b)
+{
+    return a == b || [a isEqual:b];
+}
+
 #pragma mark - Aliases for compatibility
 - (NSString *)mp_varA
 {
-    return mp_encryptHelper([self mp_viewId]);
+    MPViewIdentifierMemo *memo = [self mp_identifierMemo];
+    if (memo.viewIdDigest == nil) {
+        // Cleared whenever the view id is set.
+        memo.viewIdDigest = mp_encryptHelper([self mp_viewId]);
+    }
+    return memo.viewIdDigest;
 }
 
 - (NSString *)mp_varB
 {
-    return mp_encryptHelper([self mp_controllerVariable]);
+    if (![self isKindOfClass:[UIControl class]]) {
+        return nil;
+    }
+    MPViewIdentifierMemo *memo = [self mp_identifierMemo];
+
+    // Walking the responder chain is cheap; scanning the controller's ivars is
+    // not. Reuse the last match as long as that ivar still points at us.
+    UIResponder *responder = [self nextResponder];
+    while (responder && ![responder isKindOfClass:[UIViewController class]]) {
+        responder = [responder nextResponder];
+    }
+    UIViewController *controller = (UIViewController *)responder;
+    if (controller == nil || controller != memo.controller || !memo.controllerIvar || object_getIvar(controller, memo.controllerIvar) != self) {
+        NSString *controllerVariable = [self mp_controllerVariable];
+        memo.controller = controller;
+        memo.controllerIvar = controllerVariable ? class_getInstanceVariable([controller class], [controllerVariable UTF8String]) : NULL;
+        if (!mp_isEqualOrBothNil(controllerVariable, memo.controllerVariable) || memo.controllerVariableDigest == nil) {
+            memo.controllerVariable = controllerVariable;
+            memo.controllerVariableDigest = mp_encryptHelper(controllerVariable);
+        }
+    }
+    return memo.controllerVariableDigest;
 }
 
 - (NSString *)mp_varC
 {
-    return mp_encryptHelper([self mp_imageFingerprint]);
+    MPViewIdentifierMemo *memo = [self mp_identifierMemo];
+    // Fingerprints are cached per image, so this is a lookup unless the image changed.
+    NSString *fingerprint = [self mp_imageFingerprint];
+    if (!mp_isEqualOrBothNil(fingerprint, memo.imageFingerprint) || (fingerprint && memo.imageFingerprintDigest == nil)) {
+        memo.imageFingerprint = fingerprint;
+        memo.imageFingerprintDigest = mp_encryptHelper(fingerprint);
+    }
+    return memo.imageFingerprintDigest;
 }
 
 - (NSArray *)mp_varSetD
 {
+    MPViewIdentifierMemo *memo = [self mp_identifierMemo];
     NSArray *targetActions = [self mp_targetActions];
-    NSMutableArray *encryptedActions = [NSMutableArray array];
-    for (NSUInteger i = 0 ; i < [targetActions count]; i++) {
-        [encryptedActions addObject:mp_encryptHelper(targetActions[i])];
+    if (![targetActions isEqualToArray:memo.targetActions] || memo.targetActionDigests == nil) {
+        NSMutableArray *encryptedActions = [NSMutableArray arrayWithCapacity:[targetActions count]];
+        for (NSUInteger i = 0 ; i < [targetActions count]; i++) {
+            [encryptedActions addObject:mp_encryptHelper(targetActions[i])];
+        }
+        memo.targetActions = targetActions;
+        memo.targetActionDigests = encryptedActions;
     }
-    return encryptedActions;
+    return memo.targetActionDigests;
 }
 
 - (NSString *)mp_varE
 {
-    return mp_encryptHelper([self mp_text]);
+    MPViewIdentifierMemo *memo = [self mp_identifierMemo];
+    NSString *text = [self mp_text];
+    if (!mp_isEqualOrBothNil(text, memo.text) || (text && memo.textDigest == nil)) {
+        memo.text = text;
+        memo.textDigest = mp_encryptHelper(text);
+    }
+    return memo.textDigest;
 }
 
 @end
@@ -9,13 +9,16 @@
 import Foundation
 import UIKit
 
+// NSUserDefaults keys of the Parent properties.
+private let kFullName = "FullName"
+private let kEmail = "Email"
+private let kBabyName = "BabyName"
+private let kBabyGender = "BabyGender"
+private let kBabyBirthday = "BabyBirthday"
+private let kImagePathRelative = "ImagePathRelative"
+private let kPhotoId = "PhotoId"
+
 class Parent {
-  let kFullName = "FullName"
-  let kEmail = "Email"
-  let kBabyName = "BabyName"
-  let kBabyGender = "BabyGender"
-  let kBabyBirthday = "BabyBirthday"
-  let kImagePathRelative = "ImagePathRelative"
   
   let store = NSUserDefaults.standardUserDefaults()
   
@@ -37,8 +40,18 @@ class Parent {
 	
   var babyGender: String?
   var babyBirthday: NSDate?
-  var imagePathRelative: String?
-  var image: UIImage?
+  var imagePathRelative: String?    // full-resolution photo written by earlier versions; migrated to ProfilePhotoStore on first use
+  var photoId: String?              // ProfilePhotoStore id of the baby's photo
+  
+  /* The header-sized photo of the baby. Decoded once and cached by ProfilePhotoStore. */
+  var image: UIImage? {
+    return photo(.Header)
+  }
+  
+  /* The avatar-sized photo of the baby, for the round profile image views. */
+  var avatarImage: UIImage? {
+    return photo(.Avatar)
+  }
   
   var ageInWeeks: Double {
     get {
@@ -55,9 +68,6 @@ class Parent {
       return self.ageInWeeks/4
       }
   }
-	
-	/* TestProfiles: A collection of test histories for each baby profile, where a baby profile is identified by a name: String. */
-	var testProfiles = TestProfiles()
   
   init() {
     // first get info from the defaults incase they already exist
@@ -67,19 +77,9 @@ class Parent {
     self.babyGender = store.objectForKey(kBabyGender) as? String
     self.babyBirthday = store.objectForKey(kBabyBirthday) as? NSDate
     
-    // Get image
+    // Get image references. The photo itself is only decoded when image or avatarImage is read.
+    self.photoId = store.objectForKey(kPhotoId) as? String
     self.imagePathRelative = store.objectForKey(kImagePathRelative) as? String
-    
-    if let oldImagePath = self.imagePathRelative {
-      let oldFullPath = self.documentsPathForFilename(oldImagePath)
-			if let oldFullPath = oldFullPath,
-				oldImageData = NSData(contentsOfFile: oldFullPath) {
-				self.image = UIImage(data: oldImageData)
-			}
-    }
-		
-		// Get test profiles from disk store.
-		getProfiles()
   }
 	
 	/*
@@ -117,16 +117,65 @@ class Parent {
 		saveProfiles()
   }
   
+  /*
+  @brief Store a new photo of the baby.
+  @discussion The new photo id is saved right away, so every Parent sees the new photo, while the avatar and header variants are resized and encoded on a background queue. Until that finishes image and avatarImage return the photo as passed in. A legacy full-resolution photo, and the files of the previous photo, are only deleted once the new one has been written; if writing fails the previous photo id is restored.
+  */
   func storeImage(image: UIImage) {
-    let imageData = UIImageJPEGRepresentation(image, 1)
-    let relativePath = "image_\(NSDate.timeIntervalSinceReferenceDate()).jpg"
-		if let path = self.documentsPathForFilename(relativePath) {
-			let didWrite = imageData?.writeToFile(path, atomically: true)
-			if didWrite == true {
-				self.imagePathRelative = relativePath
-				store.setObject(self.imagePathRelative, forKey: kImagePathRelative)
-			}
-		}
+    let previousPhotoId = store.objectForKey(kPhotoId) as? String
+    var newPhotoId = ""
+    newPhotoId = ProfilePhotoStore.sharedStore.storeImage(image) { photoId in
+      let defaults = NSUserDefaults.standardUserDefaults()
+      // a newer photo has been stored since; its own completion cleans up
+      if defaults.objectForKey(kPhotoId) as? String != newPhotoId {
+        return
+      }
+      if let photoId = photoId {
+        defaults.removeObjectForKey(kImagePathRelative)
+        ProfilePhotoStore.sharedStore.collectGarbage(keeping: [photoId])
+      } else {
+        defaults.setObject(previousPhotoId, forKey: kPhotoId)
+      }
+    }
+    photoId = newPhotoId
+    store.setObject(newPhotoId, forKey: kPhotoId)
+  }
+  
+  /*
+  @brief Get the avatar-sized photo of the baby, decoding it on a background queue if it is not cached.
+  @param completion (in) Called on the main queue with the photo, else nil if there is none.
+  */
+  func loadAvatarImage(completion: (UIImage?) -> Void) {
+    refreshPhotoReferences()
+    if let photoId = photoId {
+      ProfilePhotoStore.sharedStore.loadImage(photoId: photoId, variant: .Avatar) { image in
+        completion(image ?? self.photo(.Avatar))
+      }
+    } else {
+      completion(photo(.Avatar))
+    }
+  }
+  
+  /* Re-read the photo references, since another Parent may have stored or migrated a photo after this one was initialized. */
+  private func refreshPhotoReferences() {
+    photoId = store.objectForKey(kPhotoId) as? String
+    imagePathRelative = store.objectForKey(kImagePathRelative) as? String
+  }
+  
+  private func photo(variant: ProfilePhotoStore.Variant) -> UIImage? {
+    refreshPhotoReferences()
+    if let photoId = photoId, image = ProfilePhotoStore.sharedStore.image(photoId: photoId, variant: variant) {
+      return image
+    }
+    // Migrate a full-resolution photo saved by an earlier version of the app. It is kept until the variants
+    // have been written, so this also resumes a migration interrupted by the app being terminated.
+    if let oldImagePath = imagePathRelative,
+      oldFullPath = documentsPathForFilename(oldImagePath),
+      oldImage = UIImage(contentsOfFile: oldFullPath) {
+      storeImage(oldImage)
+      return oldImage
+    }
+    return nil
   }
   
   func documentsPathForFilename(name: String) -> String? {
@@ -137,29 +186,39 @@ class Parent {
   }
 	
 	// MARK: Test Profiles helper functions
-	
-	/* 
-	@brief Initialize this object's collection of profiles from the store on disk.
-	*/
-	func getProfiles() {
-		testProfiles.initProfilesFromPersistentStore()
-	}
+	// Test profiles live in the shared ProfileStore; a Parent only holds the names that identify the current profile.
 	
 	/*
-	@brief Write all profiles from this object's collection to the store on disk.
+	@brief Write pending changes to the shared ProfileStore to the store on disk.
 	*/
 	func saveProfiles() {
-		testProfiles.save()
+		ProfileStore.sharedStore.flush()
 	}
 
 	/*
-	@brief Create a new profile for baby in memory if one does not already exist.
+	@brief Create a new profile for baby in the shared ProfileStore if one does not already exist.
 	@discussion Creates profile by concatenating the parent's full name with the specified babyName. 
 	*/
 	func addProfile(baby: String?) {
 		if let parentName = self.fullName, let babyName = baby {
-			let profileName = testProfiles.makeProfileName(parentName: parentName, babyName: babyName)
-			testProfiles.addProfile(name: profileName)
+			let profileName = TestProfiles().makeProfileName(parentName: parentName, babyName: babyName)
+			ProfileStore.sharedStore.addProfile(profileName)
+		}
+	}
+	
+	/*
+	@brief Return the current profile name without constructing a Parent.
+	@discussion Reads only the parent and baby names from NSUserDefaults; unlike init() it does not read the other profile properties.
+	@return The profile name in the format "<parent_name>.<current_baby_name>", else the empty string if no parent name has been stored.
+	*/
+	class func currentProfileName() -> String {
+		let defaults = NSUserDefaults.standardUserDefaults()
+		// The baby name default must match the babyName getter.
+		if let parentName = defaults.objectForKey(kFullName) as? String {
+			let babyName = defaults.objectForKey(kBabyName) as? String ?? "my baby"
+			return TestProfiles().makeProfileName(parentName: parentName, babyName: babyName)
+		} else {
+			return String("")
 		}
 	}
 	
@@ -171,7 +230,7 @@ class Parent {
 	*/
 	func getCurrentProfileName() -> String {
 		if let parentName = self.fullName, let babyName = self.babyName {
-			let profileName = testProfiles.makeProfileName(parentName: parentName, babyName: babyName)
+			let profileName = TestProfiles().makeProfileName(parentName: parentName, babyName: babyName)
 			return profileName
 		} else {
 			return String("")
@@ -43,7 +43,7 @@ class PincerBadOutcomeViewController: UIViewController {
 		// Schedule a local notification to remind the user to rerun this test.
 		scheduleReminder()
 		
-		rangeChartView.config(startMonth: 0, endMonth: 20, successAgeInMonths: 12, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!)
+		rangeChartView.config(startMonth: 0, endMonth: 20, successAgeInMonths: 12, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!, resultLog: TestResultLog.logForProfile(Parent.currentProfileName()), testName: Test.TestNames.pincer, birthday: parent.babyBirthday)
 		// Schedule a local notification to remind the user to rerun this test.
 		scheduleReminder()
   }
@@ -11,7 +11,6 @@ import UIKit
 class PincerWhatDidYouSeeViewController: UIViewController {
 
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -27,11 +26,8 @@ class PincerWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.pincer)
+        test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.pincer)
     }
 
     override func didReceiveMemoryWarning() {
@@ -44,14 +40,12 @@ class PincerWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "pincerGoodOutcomeSegueID" {
             
             // Record the successful pincer test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
         
         } else if segue.identifier == "pincerBadOutcomeSegueID" || segue.identifier == "pincerBadOutcomeSegueID2" {
             
             // Record the failed pincer test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
             
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! PincerBadOutcomeViewController
@@ -0,0 +1,200 @@
+/*!
+@header ProfilePhotoStore.swift
+
+@brief This file contains the ProfilePhotoStore class which stores the baby's profile photo as a small set of pre-sized JPEG variants.
+@discussion Persistence: Each stored photo gets a new photo id and one file per Variant in Documents/ProfilePhotos, named "<photo id>_<variant>.jpg". Resizing and JPEG encoding happen on a background queue. Decoded variants are kept in an in-memory cache so views do not decode the file every time a profile screen loads. collectGarbage(keeping:) removes files of photos that are no longer referenced, including the full-resolution image_<timestamp>.jpg files written by earlier versions of the app.
+
+@copyright 2015 Qidza, Inc.
+*/
+
+import UIKit
+
+class ProfilePhotoStore {
+
+    /* The pre-sized versions of a photo that are written to disk. */
+    enum Variant: String {
+        case Avatar = "avatar"      // round profile picture
+        case Header = "header"      // larger picture for full width headers and sharing
+
+        /* Length of the longest side, in pixels. Photos are never scaled up. */
+        var maxPixelSize: CGFloat {
+            switch self {
+            case .Avatar: return 320
+            case .Header: return 1080
+            }
+        }
+
+        static let all: [Variant] = [.Avatar, .Header]
+    }
+
+    /* The shared store. */
+    static let sharedStore = ProfilePhotoStore()
+
+    // The name of the directory, in Documents, containing the photo variants.
+    static let directoryName = "ProfilePhotos"
+
+    // JPEG quality used for every variant.
+    static let jpegQuality: CGFloat = 0.8
+
+    /* Serializes encoding and garbage collection so a collection never races a photo being written. */
+    private let encodeQueue = dispatch_queue_create("com.qidza.profilePhotos.encode", DISPATCH_QUEUE_SERIAL)
+
+    /* Decoded variants keyed by file name. */
+    private let cache = NSCache()
+
+    /* Photos passed to storeImage() whose variants are still being written, keyed by photo id. Only accessed on the main queue. */
+    private var pendingImages = [String : UIImage]()
+
+    init() {
+        cache.countLimit = 2 * Variant.all.count
+    }
+
+    /** Computed property for the path to the directory containing the photo variants. */
+    var directoryPath: String {
+        let manager = NSFileManager.defaultManager()
+        let url = manager.URLsForDirectory(.DocumentDirectory, inDomains: .UserDomainMask).first as NSURL!
+        return url.URLByAppendingPathComponent(ProfilePhotoStore.directoryName).path!
+    }
+
+    private func filename(photoId photoId: String, variant: Variant) -> String {
+        return "\(photoId)_\(variant.rawValue).jpg"
+    }
+
+    private func path(photoId photoId: String, variant: Variant) -> String {
+        return (directoryPath as NSString).stringByAppendingPathComponent(filename(photoId: photoId, variant: variant))
+    }
+
+    // MARK: Storing
+
+    /*!
+    @brief Resize, encode and write every variant of image on a background queue.
+    @discussion Must be called on the main queue. The photo id is returned immediately so the caller can persist it right away; until the variants have been written, image() and loadImage() return image as passed in.
+    @param image (in) The photo, typically straight from UIImagePickerController. (cannot be nil)
+    @param completion (in) Called on the main queue with the new photo id, else nil if any variant could not be written.
+    @return The id the photo is stored under.
+    */
+    func storeImage(image: UIImage, completion: ((photoId: String?) -> Void)?) -> String {
+        let photoId = NSUUID().UUIDString
+        pendingImages[photoId] = image
+        dispatch_async(encodeQueue) {
+            var succeeded = true
+            do {
+                try NSFileManager.defaultManager().createDirectoryAtPath(self.directoryPath, withIntermediateDirectories: true, attributes: nil)
+                for variant in Variant.all {
+                    let resized = ProfilePhotoStore.resizedImage(image, maxPixelSize: variant.maxPixelSize)
+                    guard let data = UIImageJPEGRepresentation(resized, ProfilePhotoStore.jpegQuality) else {
+                        succeeded = false
+                        break
+                    }
+                    try data.writeToFile(self.path(photoId: photoId, variant: variant), options: .DataWritingAtomic)
+                    // the resized image is already decoded, so it can go straight into the cache
+                    self.cache.setObject(resized, forKey: self.filename(photoId: photoId, variant: variant))
+                }
+            } catch let error as NSError {
+                NSLog("ProfilePhotoStore: failed to store photo: \(error), \(error.userInfo)")
+                succeeded = false
+            }
+            dispatch_async(dispatch_get_main_queue()) {
+                self.pendingImages[photoId] = nil
+                completion?(photoId: succeeded ? photoId : nil)
+            }
+        }
+        return photoId
+    }
+
+    /*!
+    @brief Delete the files of every photo except those in photoIds, and any legacy full-resolution photos.
+    @discussion Must be called on the main queue. Runs on the encode queue after any photos still being stored; photos being stored are always kept. Only call once no profile refers to a legacy photo any more.
+    @param photoIds (in) The ids of photos that are still referenced.
+    */
+    func collectGarbage(keeping photoIds: Set<String>) {
+        let keptIds = photoIds.union(pendingImages.keys)
+        dispatch_async(encodeQueue) {
+            let manager = NSFileManager.defaultManager()
+
+            if let files = try? manager.contentsOfDirectoryAtPath(self.directoryPath) {
+                for file in files {
+                    let photoId = file.componentsSeparatedByString("_").first ?? ""
+                    if !keptIds.contains(photoId) {
+                        self.cache.removeObjectForKey(file)
+                        _ = try? manager.removeItemAtPath((self.directoryPath as NSString).stringByAppendingPathComponent(file))
+                    }
+                }
+            }
+
+            // Earlier versions wrote image_<timestamp>.jpg to Documents on every change and never removed them.
+            let documents = (self.directoryPath as NSString).stringByDeletingLastPathComponent
+            if let files = try? manager.contentsOfDirectoryAtPath(documents) {
+                for file in files where file.hasPrefix("image_") && file.hasSuffix(".jpg") {
+                    _ = try? manager.removeItemAtPath((documents as NSString).stringByAppendingPathComponent(file))
+                }
+            }
+        }
+    }
+
+    // MARK: Loading
+
+    /*!
+    @brief Get a decoded variant of a stored photo.
+    @discussion Must be called on the main queue. Returns the cached image if available, otherwise reads and decodes the file on the calling thread. Use loadImage() to keep decoding off the main thread.
+    @return The decoded image, the photo as passed to storeImage() while its variants are being written, else nil if the variant does not exist.
+    */
+    func image(photoId photoId: String, variant: Variant) -> UIImage? {
+        if let pending = pendingImages[photoId] {
+            return pending
+        }
+        let key = filename(photoId: photoId, variant: variant)
+        if let image = cache.objectForKey(key) as? UIImage {
+            return image
+        }
+        return decodeAndCache(photoId: photoId, variant: variant)
+    }
+
+    /*!
+    @brief Get a decoded variant of a stored photo, decoding it on a background queue if it is not cached.
+    @discussion Must be called on the main queue.
+    @param completion (in) Called on the main queue with the image, else nil if the variant does not exist. Called synchronously if the image is cached or still being written.
+    */
+    func loadImage(photoId photoId: String, variant: Variant, completion: (UIImage?) -> Void) {
+        if let pending = pendingImages[photoId] {
+            completion(pending)
+            return
+        }
+        let key = filename(photoId: photoId, variant: variant)
+        if let image = cache.objectForKey(key) as? UIImage {
+            completion(image)
+            return
+        }
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) {
+            let image = self.decodeAndCache(photoId: photoId, variant: variant)
+            dispatch_async(dispatch_get_main_queue()) {
+                completion(image)
+            }
+        }
+    }
+
+    private func decodeAndCache(photoId photoId: String, variant: Variant) -> UIImage? {
+        guard let image = UIImage(contentsOfFile: path(photoId: photoId, variant: variant)) else {
+            return nil
+        }
+        // UIImage(contentsOfFile:) decodes lazily at first draw; draw it once here so the cached copy is ready to display.
+        let decoded = ProfilePhotoStore.resizedImage(image, maxPixelSize: variant.maxPixelSize)
+        cache.setObject(decoded, forKey: filename(photoId: photoId, variant: variant))
+        return decoded
+    }
+
+    /* Draw image into an opaque bitmap no larger than maxPixelSize on its longest side. Also applies imageOrientation. */
+    private static func resizedImage(image: UIImage, maxPixelSize: CGFloat) -> UIImage {
+        let pixelWidth = image.size.width * image.scale
+        let pixelHeight = image.size.height * image.scale
+        let longest = max(pixelWidth, pixelHeight)
+        let factor = longest > maxPixelSize ? maxPixelSize / longest : 1
+        let size = CGSize(width: floor(pixelWidth * factor), height: floor(pixelHeight * factor))
+
+        UIGraphicsBeginImageContextWithOptions(size, true, 1)
+        image.drawInRect(CGRect(origin: CGPointZero, size: size))
+        let resized = UIGraphicsGetImageFromCurrentImageContext()
+        UIGraphicsEndImageContext()
+        return resized ?? image
+    }
+}
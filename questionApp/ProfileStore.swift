@@ -0,0 +1,199 @@
+/*!
+@header ProfileStore.swift
+
+@brief This file contains the ProfileStore class which owns the single in-memory copy of the TestProfiles collection.
+@discussion Persistence: The archive is read from disk once, on first access. Mutations are applied in memory and written back by a debounced background write-behind, so a burst of updates (e.g. several reminder notifications) results in a single archive write. Each changed file is replaced atomically so a crash mid-write never leaves a truncated store.
+
+@copyright 2015 Qidza, Inc.
+*/
+
+import Foundation
+
+class ProfileStore {
+
+    /* The shared store. All long lived observers (e.g. TestMonitor) should access profiles through this instance. */
+    static let sharedStore = ProfileStore()
+
+    /* Seconds to wait after the most recent mutation before the archive is written to disk. */
+    static let saveDelay: Double = 0.5
+
+    /* The in-memory profiles. Only accessed on stateQueue. */
+    private let profiles: TestProfiles
+
+    /* true once profiles has been read from the persistent store. */
+    private var loaded = false
+
+    /* true if profiles contains changes that have not yet been written to disk. */
+    private var dirty = false
+
+    /* Incremented on every mutation. A scheduled save only runs if no mutation has happened since it was scheduled. */
+    private var saveGeneration = 0
+
+    /* Serializes all access to the in-memory profiles. */
+    private let stateQueue = dispatch_queue_create("com.qidza.profileStore.state", DISPATCH_QUEUE_SERIAL)
+
+    /* Serializes file writes so they land on disk in the order they were encoded. */
+    private let writeQueue = dispatch_queue_create("com.qidza.profileStore.write", DISPATCH_QUEUE_SERIAL)
+
+    /* Queue-specific key set on stateQueue, used to catch re-entrant calls that would deadlock. */
+    private static var stateQueueKey = 0
+
+    /*!
+    @brief Create a store. The app uses sharedStore; tests pass their own directory.
+    @param documentsPath (in) The directory holding the persistent store. Pass nil (the default) for the app's Documents directory.
+    */
+    init(documentsPath: String? = nil) {
+        profiles = TestProfiles(documentsPath: documentsPath)
+        dispatch_queue_set_specific(stateQueue, &ProfileStore.stateQueueKey, &ProfileStore.stateQueueKey, nil)
+    }
+
+    /* true if the caller is running on stateQueue, i.e. inside a read() or update() block. */
+    private var isOnStateQueue: Bool {
+        return dispatch_get_specific(&ProfileStore.stateQueueKey) != nil
+    }
+
+    /*!
+    @brief Read from the in-memory profiles.
+    @discussion The block runs synchronously on the store's serial queue, so it must not call back into the store. Do not retain TestHistory objects obtained inside the block for later mutation; use update() instead.
+    @param block (in) Receives the loaded TestProfiles. Its return value is returned to the caller.
+    */
+    func read<T>(block: (TestProfiles) -> T) -> T {
+        assert(!isOnStateQueue, "ProfileStore.read() called from inside a read() or update() block")
+        var result: T?
+        dispatch_sync(stateQueue) {
+            self.loadIfNeeded()
+            result = block(self.profiles)
+        }
+        return result!
+    }
+
+    /*!
+    @brief Mutate the in-memory profiles and schedule a write-behind save.
+    @discussion The block runs synchronously on the store's serial queue, so it must not call back into the store. The archive is written ProfileStore.saveDelay seconds after the last call to update().
+    @param block (in) Receives the loaded TestProfiles to modify in place.
+    */
+    func update(block: (TestProfiles) -> Void) {
+        assert(!isOnStateQueue, "ProfileStore.update() called from inside a read() or update() block")
+        dispatch_sync(stateQueue) {
+            self.loadIfNeeded()
+            block(self.profiles)
+            self.dirty = true
+            self.scheduleSave()
+        }
+    }
+
+    /*!
+    @brief Write any pending changes to disk and wait for the write to complete.
+    @discussion Call when the app is about to be suspended or terminated, or before reading the archive file directly. Must not be called from inside a read() or update() block.
+    */
+    func flush() {
+        assert(!isOnStateQueue, "ProfileStore.flush() called from inside a read() or update() block")
+        dispatch_sync(stateQueue) {
+            self.encodeAndWrite()
+        }
+        dispatch_sync(writeQueue) {}
+    }
+
+    /*!
+    @brief Get a Test of a profile from the in-memory profiles.
+    @discussion Record attempts with addTestResult(_:testResult:) rather than through the returned Test, so the change is made on the store's queue and saved.
+    @param profileName (in) A profile name as returned by Parent.currentProfileName(). (cannot be nil)
+    @param testName (in) The name of the test. Must be of Test.TestNames. (cannot be nil)
+    @return The requested Test, else a default Test if the profile does not exist.
+    */
+    func getTest(profileName: String, testName: String) -> Test {
+        return read { profiles in
+            profiles.getTest(profileName, testName: testName)
+        }
+    }
+
+    /*!
+    @brief Record a test attempt in the test's profile and schedule a write-behind save.
+    @discussion The result is applied to the profile's current TestHistory in the store, which then becomes test.history, so the caller sees the updated counters even if the store was reloaded since the Test was read.
+    @param test (in) A Test returned by getTest(_:testName:). (cannot be nil)
+    @param testResult (in) The outcome of the attempt.
+    @return true if the result was recorded, else false if test does not belong to a profile in the store.
+    */
+    func addTestResult(test: Test, testResult result: Bool?) -> Bool {
+        guard let profileName = test.profileName else {
+            return false
+        }
+        let testName = test.history.testName
+        var added = false
+        update { profiles in
+            let current = profiles.getTest(profileName, testName: testName)
+            if current.profileName != nil {
+                added = current.addTestResult(testResult: result)
+                test.history = current.history
+            }
+        }
+        return added
+    }
+
+    /*!
+    @brief Add a profile to the store if it does not already exist, and schedule a write-behind save.
+    @param profileName (in) The profile to add. (cannot be nil)
+    */
+    func addProfile(profileName: String) {
+        update { profiles in
+            profiles.addProfile(name: profileName)
+        }
+    }
+
+    /*!
+    @brief Rebuild a profile's TestHistory aggregates from its TestResultLog and compact the log.
+    @discussion The rebuilt histories are persisted by the usual write-behind save.
+    @param profileName (in) The profile to rebuild. Does nothing if the profile does not exist.
+    */
+    func compactResultLog(profileName profileName: String) {
+        update { profiles in
+            if let histories = profiles.getTestHistories(profileName: profileName) {
+                TestResultLog.logForProfile(profileName).compact(histories: histories)
+            }
+        }
+    }
+
+    // MARK: Private helpers (must be called on stateQueue)
+
+    private func loadIfNeeded() {
+        if !loaded {
+            // only the active profile is decoded up front; others are decoded on first access
+            profiles.loadArchive(preloadProfileName: Parent.currentProfileName())
+            loaded = true
+        }
+    }
+
+    private func scheduleSave() {
+        saveGeneration += 1
+        let generation = saveGeneration
+        let when = dispatch_time(DISPATCH_TIME_NOW, Int64(ProfileStore.saveDelay * Double(NSEC_PER_SEC)))
+        dispatch_after(when, stateQueue) {
+            // A later mutation has rescheduled the save; let that one write.
+            if generation == self.saveGeneration {
+                self.encodeAndWrite()
+            }
+        }
+    }
+
+    /* Snapshot the profiles on the state queue, write the bytes on the write queue, then mark them as saved back on the state queue. */
+    private func encodeAndWrite() {
+        if !dirty {
+            return
+        }
+        dirty = false
+        // only the shards of changed profiles (and the manifest, if profiles were added or removed) are written
+        let pending = profiles.pendingWrites()
+        dispatch_async(writeQueue) {
+            let succeeded = TestProfiles.performWrites(pending)
+            // the changes only count as saved once they are on disk
+            dispatch_async(self.stateQueue) {
+                if succeeded {
+                    self.profiles.markWritten(pending)
+                } else {
+                    // still dirty, so the next save or flush collects the same changes again
+                    self.dirty = true
+                }
+            }
+        }
+    }
+}
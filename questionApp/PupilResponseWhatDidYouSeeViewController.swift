@@ -11,7 +11,6 @@ import UIKit
 class PupilResponseWhatDidYouSeeViewController: UIViewController {
 	
 	var parent = Parent()
-	var profiles = TestProfiles()
 	var test = Test()
 
   override func viewDidLoad() {
@@ -23,11 +22,8 @@ class PupilResponseWhatDidYouSeeViewController: UIViewController {
 		// Ensure current information for parent by reloading.
 		parent = Parent()
 		
-		// Ensure current information for test profiles by reloading.
-		profiles.initProfilesFromPersistentStore()
-		
 		// Get the test information.
-		test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.pupilResponse)
+		test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.pupilResponse)
   }
 	
   override func didReceiveMemoryWarning() {
@@ -40,14 +36,12 @@ class PupilResponseWhatDidYouSeeViewController: UIViewController {
 		if segue.identifier == "PupilResponseGoodOutcomeSegueID" {
 			
 			// Record the successful symmetry test result and save it to the persistent store on disk.
-			test.addTestResult(testResult: true)
-			profiles.save()
+			ProfileStore.sharedStore.addTestResult(test, testResult: true)
 			
 		} else if segue.identifier == "PupilResponseBadOutcomeSegueID" || segue.identifier == "PupilResponseBadOutcomeSegueID2" || segue.identifier == "PupilResponseBadOutcomeSegueID3" {
 			
 			// Record the failed symmetry test result and save it to the persistent store on disk.
-			test.addTestResult(testResult: false)
-			profiles.save()
+			ProfileStore.sharedStore.addTestResult(test, testResult: false)
 			
 			// Pass the test results history to the destination VC.
 			let controller = segue.destinationViewController as! PupilResponseBadOutcomeViewController
@@ -11,7 +11,6 @@ import UIKit
 class ReachingWhileSittingWhatDidYouSeeViewController: UIViewController {
 
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -23,11 +22,8 @@ class ReachingWhileSittingWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.reachingWhileSitting)
+        test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.reachingWhileSitting)
     }
 
     override func didReceiveMemoryWarning() {
@@ -40,14 +36,12 @@ class ReachingWhileSittingWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "ReachingWhileSittingGoodOutcomeSegueID" {
             
             // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
             
         } else if segue.identifier == "ReachingWhileSittingBadOutcomeSegueID" || segue.identifier == "ReachingWhileSittingBadOutcomeSegueID2" {
             
             // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
             
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! ReachingWhileSittingBadOutcomeViewController
@@ -10,7 +10,6 @@ import UIKit
 
 class ReachingforToyWhatDidYouSeeViewController: UIViewController {
   var parent = Parent()
-  var profiles = TestProfiles()
   var test = Test()
   
   override func viewDidLoad() {
@@ -22,11 +21,8 @@ class ReachingforToyWhatDidYouSeeViewController: UIViewController {
     // Ensure current information for parent by reloading.
     parent = Parent()
     
-    // Ensure current information for test profiles by reloading.
-    profiles.initProfilesFromPersistentStore()
-    
     // Get the test information.
-    test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.reachingForToy)
+    test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.reachingForToy)
   }
   
   override func didReceiveMemoryWarning() {
@@ -39,14 +35,12 @@ class ReachingforToyWhatDidYouSeeViewController: UIViewController {
     if segue.identifier == "ReachingForToyGoodOutcomeSegueID" {
       
       // Record the successful symmetry test result and save it to the persistent store on disk.
-      test.addTestResult(testResult: true)
-      profiles.save()
+      ProfileStore.sharedStore.addTestResult(test, testResult: true)
       
     } else if segue.identifier == "ReachingForToyBadOutcomeSegueID" {
       
       // Record the failed symmetry test result and save it to the persistent store on disk.
-      test.addTestResult(testResult: false)
-      profiles.save()
+      ProfileStore.sharedStore.addTestResult(test, testResult: false)
       
       // Pass the test results history to the destination VC.
       let controller = segue.destinationViewController as! ReachingforToyBadOutcomeViewController
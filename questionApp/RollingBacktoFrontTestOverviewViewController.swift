@@ -42,8 +42,8 @@ class RollingBacktoFrontTestOverviewViewController: UIViewController {
     if segue.identifier == "pointFollowingEmbeddedVideoSegue" {
       // set the playerVC as the destination
       playerVC = segue.destinationViewController as! AVPlayerViewController
-      let path = NSBundle.mainBundle().pathForResource("rolling back to front", ofType: "mp4")
-      let url = NSURL.fileURLWithPath(path!)
+      let video = BNVideoPlayer.videoForTest(Test.TestNames.rollingBackToFront)!
+      let url = NSBundle.mainBundle().URLForResource(video.file, withExtension: "mp4")!
       // let url = NSURL(string: "crawl.mp4") // for remote locations
       
       // hide player controls
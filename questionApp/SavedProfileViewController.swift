@@ -50,7 +50,9 @@ class SavedProfileViewController: UIViewController, UIImagePickerControllerDeleg
     babyImageView.layer.borderColor = kBlue.CGColor
     
     // replace image in baby view from NSUserDefaults
-    babyImageView.image = parent.image
+    parent.loadAvatarImage { [weak self] image in
+      self?.babyImageView.image = image
+    }
     
     // analytics
     Tracker.createEvent(.ProfileSaved, .Load)
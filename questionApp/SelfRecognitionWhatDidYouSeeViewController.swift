@@ -11,7 +11,6 @@ import UIKit
 class SelfRecognitionWhatDidYouSeeViewController: UIViewController {
 
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -27,11 +26,8 @@ class SelfRecognitionWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.selfRecognition)
+        test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.selfRecognition)
     }
 
     override func didReceiveMemoryWarning() {
@@ -44,14 +40,12 @@ class SelfRecognitionWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "selfRecognitionGoodOutcomeSegueID" {
             
             // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
         
         } else if segue.identifier == "selfRecognitionBadOutcomeSegueID" {
             
             // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
           
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! SelfRecognitionBadOutcomeViewController
@@ -34,6 +34,8 @@ class SensoryMotorMilestoneViewController: UIViewController {
   
   override func viewDidLoad() {
     super.viewDidLoad()
+    // load the preview thumbnails of this milestone's tests before one is opened
+    BNVideoThumbnailCache.sharedCache.prewarmThumbnails(testNames: Test.TestNamesByCategory.sensoryAndMotor)
       // analytics
       Tracker.createEvent(.SensoryMotorMilestone, .Load)
   
@@ -133,9 +135,9 @@ class SensoryMotorMilestoneViewController: UIViewController {
   }
   
   @IBAction func onHearingButtonTap(sender: AnyObject) {
-      let storyboard = UIStoryboard (name: "Hearing", bundle: nil)
-      let controller: WhyIsHearingViewController = storyboard.instantiateViewControllerWithIdentifier("WhyIsHearingStoryboardID") as! WhyIsHearingViewController
-      self.presentViewController(controller, animated: true, completion: nil);
+      // hearing runs on the generic test flow engine, see HearingFlow.plist. It has no storyboard to fall back to.
+      let started = TestFlowCoordinator.startTest(Test.TestNames.hearing, from: self)
+      assert(started, "HearingFlow.plist is missing or invalid")
   }
   
   @IBAction func onCrawlButtonTap(sender: AnyObject) {
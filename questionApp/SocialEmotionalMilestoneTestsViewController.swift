@@ -18,6 +18,8 @@ class SocialEmotionalMilestoneTestsViewController: UIViewController {
 	var numberOfShares = 0
   override func viewDidLoad() {
     super.viewDidLoad()
+    // load the preview thumbnails of this milestone's tests before one is opened
+    BNVideoThumbnailCache.sharedCache.prewarmThumbnails(testNames: Test.TestNamesByCategory.socialAndEmotional)
       // analytics
       Tracker.createEvent(.SocialEmotionalMilestone, .Load)
 		// see how many times we shared from front page
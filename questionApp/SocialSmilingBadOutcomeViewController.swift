@@ -33,7 +33,7 @@ class SocialSmilingBadOutcomeViewController: UIViewController {
       
       // configure chart
     // Do any additional setup after loading the view.
-      chartRange.config(startMonth: 0, endMonth: 12, successAgeInMonths: 4, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!)
+      chartRange.config(startMonth: 0, endMonth: 12, successAgeInMonths: 4, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName!, resultLog: TestResultLog.logForProfile(Parent.currentProfileName()), testName: Test.TestNames.socialSmiling, birthday: parent.babyBirthday)
       
       // font can't be set directly in storyboard for attributed string, set the label font here
       // make label's set attr string to a mutable so we can add attributes on
@@ -20,6 +20,9 @@ class Test: NSObject, NSCoding {
     /* Contains metadata describing the results of previous tests. */
     var history = TestHistory()
     
+    /* The profile this test belongs to. Set by TestProfiles.getTest(). Attempts are recorded in this profile's TestResultLog; a Test that was not obtained from a profile is not logged. */
+    var profileName: String? = nil
+    
     // Test names used to identify tests programmatically.
     struct TestNames {
         static var pupilResponse: String = "pupil response"
@@ -279,6 +282,11 @@ class Test: NSObject, NSCoding {
                 history.countOfFailedTests += 1
             }
             
+            // Record the individual attempt in the owning profile's append-only result log.
+            if let profileName = profileName {
+                TestResultLog.logForProfile(profileName).append(testName: history.testName, succeeded: result, date: testDate)
+            }
+            
             return true
         } else {
             return false
@@ -382,11 +390,21 @@ class Test: NSObject, NSCoding {
     // MARK: Direct archiving & unarchiving
     /* Use these methods to persist the Test Object in it's own archive (independent from the archive created when saving a TestProfiles object.) */
     
-    // The name of the file where the test history data is persisted
+    // The name of the file where the test history data is persisted, in the TestProfilesCodec format.
+    let storeFilename = "Test.bin"
+    
+    // The name of the NSKeyedArchiver file used by earlier versions of the app. Read only if storeFilename does not exist.
     let archiveFilename = "TestArchive"
     
     /** Computed property for the path to the file where the data is persisted. */
     var filePath : String {
+        let manager = NSFileManager.defaultManager()
+        let url = manager.URLsForDirectory(.DocumentDirectory, inDomains: .UserDomainMask).first as NSURL!
+        return url.URLByAppendingPathComponent(self.storeFilename).path!
+    }
+    
+    /** Computed property for the path to the legacy NSKeyedArchiver file. */
+    var legacyFilePath : String {
         let manager = NSFileManager.defaultManager()
         let url = manager.URLsForDirectory(.DocumentDirectory, inDomains: .UserDomainMask).first as NSURL!
         return url.URLByAppendingPathComponent(self.archiveFilename).path!
@@ -399,7 +417,12 @@ class Test: NSObject, NSCoding {
     */
     func initFromPersistentStore() -> Bool {
         
-        if let unarchivedHistory = NSKeyedUnarchiver.unarchiveObjectWithFile(self.filePath) as? TestHistory {
+        if let data = NSData(contentsOfFile: self.filePath),
+            records = TestProfilesCodec.decodeHistoryRecords(data),
+            decodedHistory = records.values.first {
+            self.history = decodedHistory
+            return true
+        } else if let unarchivedHistory = NSKeyedUnarchiver.unarchiveObjectWithFile(self.legacyFilePath) as? TestHistory {
             self.history = unarchivedHistory
             self.history.output()
             return true
@@ -413,6 +436,9 @@ class Test: NSObject, NSCoding {
     @return true if successfully persisted, else false if an error occurred.
     */
     func save() -> Bool {
-        return NSKeyedArchiver.archiveRootObject(self.history, toFile: self.filePath)
+        // Stored as a single-record TestHistories so it shares the TestProfilesCodec format.
+        let histories = TestHistories()
+        histories.histories = [self.history.testName : self.history]
+        return TestProfilesCodec.encodeHistories(histories).writeToFile(self.filePath, atomically: true)
     }
 }
\ No newline at end of file
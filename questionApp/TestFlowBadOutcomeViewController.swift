@@ -0,0 +1,56 @@
+//
+//  TestFlowBadOutcomeViewController.swift
+//  questionApp
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+
+/*
+The bad outcome step of a test that runs on the flow engine. Adds the age range chart and the copy chosen
+by the number of failed attempts. The reminder to retry the test is scheduled by the coordinator when the
+failed attempt is recorded, not here, since the content is rebuilt whenever the controller is reused.
+*/
+class TestFlowBadOutcomeViewController: TestFlowStepViewController {
+
+  static let chartHeight: CGFloat = 150
+
+  override func buildContent() {
+    let definition = coordinator.definition
+    let parent = Parent()
+
+    let chartView = BNTestRangeChartView(frame: CGRectZero)
+    chartView.config(startMonth: definition.chartStartMonth, endMonth: definition.chartEndMonth, successAgeInMonths: definition.successAgeInMonths, babyAgeInMonths: parent.ageInMonths, babyName: parent.babyName ?? "", resultLog: TestResultLog.logForProfile(Parent.currentProfileName()), testName: definition.testName, birthday: parent.babyBirthday)
+    addContentView(chartView)
+
+    let chartLabel = UILabel()
+    chartLabel.text = definition.chartTitle
+    chartLabel.textAlignment = .Center
+    chartLabel.font = UIFont(name: kOmnesFontMedium, size: 15)
+    chartLabel.textColor = kGrey
+    addContentView(chartLabel)
+
+    // Initialize text in the view based on the test history.
+    if let message = definition.badOutcomeMessage(failures: coordinator.test.failedTestsCount()) {
+      if let titleLabel = contentViews.first as? UILabel {
+        titleLabel.text = message.question
+      }
+      let length = (message.text as NSString).length
+      addContentView(makeParagraphLabel(message.text, boldRange: NSMakeRange(message.boldFrom, max(0, length - message.boldFrom))))
+    }
+
+    addContentView(makeNextButton("more info", action: "onMoreInfoButtonTap:"))
+  }
+
+  override func heightOfContentView(view: UIView, width: CGFloat) -> CGFloat {
+    if view is BNTestRangeChartView {
+      return TestFlowBadOutcomeViewController.chartHeight
+    }
+    return super.heightOfContentView(view, width: width)
+  }
+
+  func onMoreInfoButtonTap(sender: AnyObject) {
+    coordinator.showStep(.MoreInfo, from: self)
+  }
+}
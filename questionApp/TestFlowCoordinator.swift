@@ -0,0 +1,174 @@
+//
+//  TestFlowCoordinator.swift
+//  questionApp
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+
+/*
+Runs one attempt at a test described by a TestFlowDefinition. Each step is presented modally on top of the
+previous one, like the segues of the per-test storyboards, so the back button simply dismisses. The presented
+step view controllers keep the coordinator alive until the flow is dismissed.
+*/
+class TestFlowCoordinator {
+
+  // NSUserDefaults key set when the parent chooses "don't show again" on an IsReady step. Shared with the storyboard tests.
+  static let dontShowIsBabyReadyKey = "dontShowIsBabyReady"
+
+  let definition: TestFlowDefinition
+
+  private var testLoaded = false
+  private var loadedTest = Test()
+
+  init(definition: TestFlowDefinition) {
+    self.definition = definition
+  }
+
+  /*
+  @brief Present the first step of a test, if the test runs on the flow engine.
+  @param testName (in) A Test.TestNames value.
+  @param presenter (in) The view controller presenting the test. (cannot be nil)
+  @return false if the test has no flow definition; the caller should present its storyboard instead.
+  */
+  static func startTest(testName: String, from presenter: UIViewController) -> Bool {
+    guard let controller = firstViewControllerForTest(testName) else {
+      return false
+    }
+    presenter.presentViewController(controller, animated: true, completion: nil)
+    return true
+  }
+
+  /*
+  @brief Get the view controller of the first step of a test, with a new coordinator.
+  @return nil if the test has no flow definition.
+  */
+  static func firstViewControllerForTest(testName: String) -> UIViewController? {
+    guard let definition = TestFlowDefinition.definitionForTest(testName), first = definition.steps.first else {
+      return nil
+    }
+    return TestFlowCoordinator(definition: definition).viewControllerForStep(first)
+  }
+
+  /* The test's history for the current profile, read from the shared ProfileStore the first time it is needed. */
+  var test: Test {
+    if !testLoaded {
+      testLoaded = true
+      loadedTest = ProfileStore.sharedStore.getTest(Parent.currentProfileName(), testName: definition.testName)
+    }
+    return loadedTest
+  }
+
+  // MARK: Navigation
+
+  /* Get a configured view controller for step, reusing a cached one when possible. */
+  func viewControllerForStep(step: TestFlowDefinition.Step) -> TestFlowStepViewController {
+    let controller = TestFlowViewControllerCache.sharedCache.dequeueViewController(step.kind)
+    controller.configure(coordinator: self, step: step)
+    return controller
+  }
+
+  /* Present the step of the linear walk after controller's step. */
+  func showStepAfter(controller: TestFlowStepViewController) {
+    let skipIsReady = NSUserDefaults.standardUserDefaults().boolForKey(TestFlowCoordinator.dontShowIsBabyReadyKey)
+    if let next = definition.stepAfter(controller.step.kind, skipIsReady: skipIsReady) {
+      controller.presentViewController(viewControllerForStep(next), animated: true, completion: nil)
+    }
+  }
+
+  /* Present the first step of the given kind. */
+  func showStep(kind: TestFlowDefinition.StepKind, from controller: UIViewController) {
+    if let step = definition.step(kind) {
+      controller.presentViewController(viewControllerForStep(step), animated: true, completion: nil)
+    }
+  }
+
+  /*
+  @brief Record the result of the attempt, save it to the persistent store, and present the matching outcome step.
+  @discussion A failed attempt schedules a reminder to retry the test, once per attempt.
+  */
+  func recordResult(succeeded succeeded: Bool, from controller: UIViewController) {
+    ProfileStore.sharedStore.addTestResult(test, testResult: succeeded)
+
+    if succeeded {
+      // If a reminder notification had previously been scheduled, remove it now that the test has been passed.
+      BNLocalNotification.removeLocalNotification(definition.presentableName)
+    } else {
+      // Schedule a local notification to remind the user to rerun this test.
+      scheduleReminder()
+    }
+    showStep(succeeded ? .Good : .Bad, from: controller)
+  }
+
+  /*
+  @brief Schedule a local notification to remind the user to run the test again.
+  @discussion The local notification is scheduled if it does not currently exist.
+  */
+  func scheduleReminder() {
+    if BNLocalNotification.doesLocalNotificationExist(definition.presentableName) == false {
+      let localNotification = BNLocalNotification(nameOfTest: definition.presentableName, secondsBeforeDisplayingReminder: definition.reminderInterval)
+      localNotification.scheduleNotification()
+    }
+  }
+
+  func showHome(from controller: UIViewController) {
+    let storyboard = UIStoryboard (name: "Main", bundle: nil)
+    let milestones = storyboard.instantiateViewControllerWithIdentifier("MilestonesVCStoryboardID") as! MilestonesViewController
+    controller.presentViewController(milestones, animated: true, completion: nil)
+  }
+}
+
+/*
+Keeps dismissed step view controllers, and their view hierarchies, so the next step or test of the same kind
+does not build a new controller. At most maximumIdlePerKind controllers are kept per step kind, and all of them
+are released on a memory warning. Main thread only.
+*/
+class TestFlowViewControllerCache: NSObject {
+
+  static let sharedCache = TestFlowViewControllerCache()
+
+  static let maximumIdlePerKind = 1
+
+  private var idleControllers = [TestFlowDefinition.StepKind : [TestFlowStepViewController]]()
+
+  override init() {
+    super.init()
+    NSNotificationCenter.defaultCenter().addObserver(self, selector: "onMemoryWarning:", name: UIApplicationDidReceiveMemoryWarningNotification, object: nil)
+  }
+
+  deinit {
+    NSNotificationCenter.defaultCenter().removeObserver(self)
+  }
+
+  /* Get an unconfigured view controller able to show steps of kind. */
+  func dequeueViewController(kind: TestFlowDefinition.StepKind) -> TestFlowStepViewController {
+    if var idle = idleControllers[kind] where !idle.isEmpty {
+      let controller = idle.removeLast()
+      idleControllers[kind] = idle
+      return controller
+    }
+    return kind == .Bad ? TestFlowBadOutcomeViewController() : TestFlowStepViewController()
+  }
+
+  /* Keep a dismissed controller for reuse. Called by the controller itself. */
+  func recycle(controller: TestFlowStepViewController) {
+    guard let kind = controller.step?.kind else {
+      return
+    }
+    var idle = idleControllers[kind] ?? []
+    if idle.count < TestFlowViewControllerCache.maximumIdlePerKind && !idle.contains({ $0 === controller }) {
+      controller.prepareForReuse()
+      idle.append(controller)
+      idleControllers[kind] = idle
+    }
+  }
+
+  func removeAll() {
+    idleControllers.removeAll()
+  }
+
+  func onMemoryWarning(notification: NSNotification) {
+    removeAll()
+  }
+}
@@ -0,0 +1,222 @@
+/*!
+@header TestFlowDefinition.swift
+
+@brief This file contains the TestFlowDefinition struct which describes the screens of one test, as read from the test's flow definition file.
+@discussion Each test that runs on the generic flow engine (see TestFlowCoordinator) ships a "<Test>Flow.plist" resource listing its steps in order, the copy shown on each step, the preview video, the Tracker values reported as each step loads, and the copy shown after a failed attempt. Definitions are parsed on first use and cached for the life of the app.
+
+@copyright 2015 Qidza, Inc.
+*/
+
+import Foundation
+
+struct TestFlowDefinition {
+
+    /* The kinds of screen a test is made of. Each kind is shown by one of the reusable step view controllers. */
+    enum StepKind: String {
+        case Why = "why"
+        case Overview = "overview"
+        case WhatIsNeeded = "whatIsNeeded"
+        case IsReady = "isReady"
+        case TimeToTest = "timeToTest"
+        case WhatDidYouSee = "whatDidYouSee"
+        case Good = "good"
+        case Bad = "bad"
+        case MoreInfo = "moreInfo"
+
+        /* The Tracker.Progress reported when a step of this kind loads, unless the definition overrides it. */
+        var defaultProgress: Tracker.Progress {
+            switch self {
+            case .Why: return .Why
+            case .Overview: return .Overview
+            case .WhatIsNeeded: return .WhatIsNeeded
+            case .IsReady: return .IsReady
+            case .TimeToTest: return .TimeToTest
+            case .WhatDidYouSee: return .WhatDidSee
+            case .Good: return .Good
+            case .Bad: return .Bad
+            case .MoreInfo: return .MoreInfo
+            }
+        }
+
+        /* true if the step is part of the linear walk from the why screen to the question. */
+        var isLinear: Bool {
+            switch self {
+            case .Good, .Bad, .MoreInfo: return false
+            default: return true
+            }
+        }
+    }
+
+    /* One screen of a test. */
+    struct Step {
+        let kind: StepKind
+        let progress: Tracker.Progress
+        let title: String
+        /* Paragraph shown above text. */
+        let intro: String?
+        /* Number of leading characters of intro shown in the bold font. */
+        let boldPrefixLength: Int
+        /* Paragraphs, one label each. */
+        let text: [String]
+        /* Number of leading characters of each paragraph of text shown in orange, for bullets and step numbers. */
+        let markerLength: Int
+        let imageName: String?
+        /* Titles of the good and bad answers of a WhatDidYouSee step. */
+        let goodAnswer: String?
+        let badAnswer: String?
+    }
+
+    /* Copy shown on the bad outcome screen once the baby has failed the test up to maxFailures times. */
+    struct BadOutcomeMessage {
+        let maxFailures: Int
+        let question: String
+        let text: String
+        /* Index of the first character of text shown in the bold font. */
+        let boldFrom: Int
+    }
+
+    // The current version of the definition file format.
+    static let version = 1
+
+    let testName: String                    // a Test.TestNames value
+    let presentableName: String             // a Test.TestNamesPresentable value, used in reminders and sharing
+    let trackerName: Tracker.Name
+    let videoFile: String?
+    let videoTime: Int32
+    let steps: [Step]
+    let badOutcomeMessages: [BadOutcomeMessage]
+    let chartStartMonth: Double
+    let chartEndMonth: Double
+    let successAgeInMonths: Double
+    let chartTitle: String
+    let reminderInterval: Double
+
+    // MARK: Loading
+
+    /* Parsed definitions keyed by test name. Main thread only. */
+    private static var cache = [String : TestFlowDefinition]()
+
+    /* Resource names of the flow definition files keyed by test name. Add a test here once its definition file is in the bundle. */
+    static let resourceNames: [String : String] = [
+        Test.TestNames.hearing: "HearingFlow"
+    ]
+
+    /*!
+    @brief Get the flow definition of a test.
+    @discussion Tests still on their storyboards have no definition; that is not an error. A listed definition that is missing from the bundle or cannot be parsed is reported with NSLog.
+    @param testName (in) A Test.TestNames value.
+    @return The definition, else nil if the test does not run on the flow engine or its definition file is invalid.
+    */
+    static func definitionForTest(testName: String) -> TestFlowDefinition? {
+        if let definition = cache[testName] {
+            return definition
+        }
+        guard let resourceName = resourceNames[testName] else {
+            return nil
+        }
+        guard let path = NSBundle.mainBundle().pathForResource(resourceName, ofType: "plist"),
+            dictionary = NSDictionary(contentsOfFile: path) as? [String : AnyObject],
+            definition = TestFlowDefinition(dictionary: dictionary) else {
+                NSLog("TestFlowDefinition: \(resourceName).plist is missing or invalid, \(testName) falls back to its storyboard")
+                return nil
+        }
+        cache[testName] = definition
+        return definition
+    }
+
+    /*!
+    @brief Initialize a definition from the root dictionary of a definition file.
+    @return nil if a required key is missing or the file is a newer version.
+    */
+    init?(dictionary: [String : AnyObject]) {
+        guard let version = dictionary["version"] as? Int where version <= TestFlowDefinition.version,
+            let testName = dictionary["testName"] as? String,
+            presentableName = dictionary["presentableName"] as? String,
+            trackerValue = dictionary["tracker"] as? String,
+            trackerName = Tracker.Name(rawValue: trackerValue),
+            stepDictionaries = dictionary["steps"] as? [[String : AnyObject]] else {
+                return nil
+        }
+
+        var steps = [Step]()
+        for stepDictionary in stepDictionaries {
+            guard let kindValue = stepDictionary["kind"] as? String, kind = StepKind(rawValue: kindValue) else {
+                return nil
+            }
+            var progress = kind.defaultProgress
+            if let progressValue = stepDictionary["progress"] as? String {
+                guard let value = Tracker.Progress(rawValue: progressValue) else {
+                    return nil
+                }
+                progress = value
+            }
+            let answers = stepDictionary["answers"] as? [String : String]
+            steps.append(Step(kind: kind,
+                progress: progress,
+                title: stepDictionary["title"] as? String ?? "",
+                intro: stepDictionary["intro"] as? String,
+                boldPrefixLength: stepDictionary["boldPrefixLength"] as? Int ?? 0,
+                text: stepDictionary["text"] as? [String] ?? [],
+                markerLength: stepDictionary["markerLength"] as? Int ?? 0,
+                imageName: stepDictionary["image"] as? String,
+                goodAnswer: answers?["good"],
+                badAnswer: answers?["bad"]))
+        }
+
+        var messages = [BadOutcomeMessage]()
+        for messageDictionary in dictionary["badOutcomeMessages"] as? [[String : AnyObject]] ?? [] {
+            guard let maxFailures = messageDictionary["maxFailures"] as? Int,
+                question = messageDictionary["question"] as? String,
+                text = messageDictionary["text"] as? String else {
+                    return nil
+            }
+            messages.append(BadOutcomeMessage(maxFailures: maxFailures, question: question, text: text, boldFrom: messageDictionary["boldFrom"] as? Int ?? text.characters.count))
+        }
+
+        let video = dictionary["video"] as? [String : AnyObject]
+        let chart = dictionary["chart"] as? [String : AnyObject]
+
+        self.testName = testName
+        self.presentableName = presentableName
+        self.trackerName = trackerName
+        self.videoFile = video?["file"] as? String
+        self.videoTime = Int32(video?["time"] as? Int ?? 0)
+        self.steps = steps
+        self.badOutcomeMessages = messages.sort { $0.maxFailures < $1.maxFailures }
+        self.chartStartMonth = chart?["startMonth"] as? Double ?? 0
+        self.chartEndMonth = chart?["endMonth"] as? Double ?? 12
+        self.successAgeInMonths = chart?["successAgeInMonths"] as? Double ?? 0
+        self.chartTitle = chart?["title"] as? String ?? ""
+        self.reminderInterval = (dictionary["reminderIntervalDays"] as? Double ?? 14) * Test.SecondsInADay
+    }
+
+    // MARK: Queries
+
+    /* Get the first step of the given kind. */
+    func step(kind: StepKind) -> Step? {
+        return steps.filter { $0.kind == kind }.first
+    }
+
+    /*!
+    @brief Get the step shown after a step of the linear walk, skipping steps the parent has hidden.
+    @param skipIsReady (in) true if the parent chose "don't show again" on an IsReady step.
+    @return The next linear step, else nil if kind is the last linear step.
+    */
+    func stepAfter(kind: StepKind, skipIsReady: Bool) -> Step? {
+        guard let index = steps.indexOf({ $0.kind == kind }) else {
+            return nil
+        }
+        for step in steps[(index + 1)..<steps.count] where step.kind.isLinear {
+            if step.kind == .IsReady && skipIsReady {
+                continue
+            }
+            return step
+        }
+        return nil
+    }
+
+    /* Get the bad outcome copy for a baby who has failed the test failures times. */
+    func badOutcomeMessage(failures failures: Int) -> BadOutcomeMessage? {
+        return badOutcomeMessages.filter { failures <= $0.maxFailures }.first ?? badOutcomeMessages.last
+    }
+}
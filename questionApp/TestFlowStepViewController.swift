@@ -0,0 +1,304 @@
+//
+//  TestFlowStepViewController.swift
+//  questionApp
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+
+/*
+Shows one step of a test that runs on the flow engine. The same class is used for every step kind except
+the bad outcome (see TestFlowBadOutcomeViewController); the step's copy, image and video come from the test's
+TestFlowDefinition. Instances are reused through TestFlowViewControllerCache, so everything shown is rebuilt
+in reloadContent() whenever configure(coordinator:step:) is called.
+*/
+class TestFlowStepViewController: UIViewController {
+
+  private(set) var coordinator: TestFlowCoordinator!
+  private(set) var step: TestFlowDefinition.Step!
+
+  // The Tracker load event is sent once per configure, like the viewDidLoad events of the storyboard screens.
+  private var needsLoadEvent = false
+
+  let backgroundView = UIImageView(image: UIImage(named: "background"))
+  let backButton = BNBackButton(frame: CGRectZero)
+  let sectionLabel = BNSectionLabel(frame: CGRectZero)
+  let homeButton = BNButton(frame: CGRectZero)
+  let scrollView = UIScrollView()
+
+  // Views stacked top to bottom in scrollView. Rebuilt by reloadContent().
+  private(set) var contentViews = [UIView]()
+
+  // Layout constants, matching the 320pt wide storyboard screens.
+  static let margin: CGFloat = 24
+  static let spacing: CGFloat = 16
+  static let buttonHeight: CGFloat = 50
+  static let topBarHeight: CGFloat = 64
+
+  // MARK: Configuration
+
+  /*
+  @brief Show step of the coordinator's test.
+  @discussion Call before presenting the controller. Safe to call again on a reused controller.
+  */
+  func configure(coordinator coordinator: TestFlowCoordinator, step: TestFlowDefinition.Step) {
+    self.coordinator = coordinator
+    self.step = step
+    needsLoadEvent = true
+    if isViewLoaded() {
+      reloadContent()
+    }
+  }
+
+  override func viewDidLoad() {
+    super.viewDidLoad()
+
+    backgroundView.contentMode = .ScaleAspectFill
+    view.addSubview(backgroundView)
+    view.addSubview(scrollView)
+
+    backButton.addTarget(self, action: "onBackButtonTap:", forControlEvents: .TouchUpInside)
+    view.addSubview(backButton)
+    view.addSubview(sectionLabel)
+
+    homeButton.setTitle("home", forState: .Normal)
+    homeButton.addTarget(self, action: "onHomeButtonTap:", forControlEvents: .TouchUpInside)
+    view.addSubview(homeButton)
+
+    if step != nil {
+      reloadContent()
+    }
+  }
+
+  override func viewWillAppear(animated: Bool) {
+    super.viewWillAppear(animated)
+    if needsLoadEvent {
+      needsLoadEvent = false
+      // analytics
+      Tracker.createEvent(coordinator.definition.trackerName, .Load, step.progress)
+    }
+  }
+
+  override func viewDidDisappear(animated: Bool) {
+    super.viewDidDisappear(animated)
+    if isBeingDismissed() {
+      TestFlowViewControllerCache.sharedCache.recycle(self)
+    }
+  }
+
+  /* Drop the step so a recycled controller does not keep the coordinator, and its test, alive. */
+  func prepareForReuse() {
+    coordinator = nil
+    step = nil
+    needsLoadEvent = false
+    for view in contentViews {
+      view.removeFromSuperview()
+    }
+    contentViews.removeAll()
+  }
+
+  // MARK: Content
+
+  /* Remove the previous step's views and build the views of the current step. */
+  func reloadContent() {
+    for view in contentViews {
+      view.removeFromSuperview()
+    }
+    contentViews.removeAll()
+
+    sectionLabel.text = coordinator.definition.presentableName
+    homeButton.hidden = step.kind.isLinear
+
+    addContentView(makeTitleLabel(step.title))
+    buildContent()
+    scrollView.contentOffset = CGPointZero
+    view.setNeedsLayout()
+  }
+
+  /*
+  @brief Add the views of the current step below the title.
+  @discussion Subclasses override this to show more than the step's image, video, copy and buttons.
+  */
+  func buildContent() {
+    if let imageName = step.imageName, image = UIImage(named: imageName) {
+      let imageView = UIImageView(image: image)
+      imageView.contentMode = .Center
+      addContentView(imageView)
+    }
+
+    if let videoFile = coordinator.definition.videoFile where step.kind == .Overview {
+      let player = BNVideoPlayer(frame: CGRect(x: 0, y: 0, width: 320, height: 180))
+      player.videoFileName = videoFile
+      player.videoTime = coordinator.definition.videoTime
+      addContentView(player)
+    }
+
+    if let intro = step.intro {
+      addContentView(makeParagraphLabel(intro, boldRange: NSMakeRange(0, step.boldPrefixLength)))
+    }
+    for paragraph in step.text {
+      addContentView(makeParagraphLabel(paragraph, markerLength: step.markerLength))
+    }
+
+    switch step.kind {
+    case .WhatDidYouSee:
+      addContentView(makeAnswerButton(step.goodAnswer ?? "", action: "onGoodAnswerTap:"))
+      addContentView(makeAnswerButton(step.badAnswer ?? "", action: "onBadAnswerTap:"))
+    case .IsReady:
+      addContentView(makeNextButton("next step", action: "onNextStepButtonTap:"))
+      let dontShowButton = BNAuxiliaryButtonNext(frame: CGRectZero)
+      dontShowButton.setTitle("don't show again", forState: .Normal)
+      dontShowButton.addTarget(self, action: "onDontShowAgainButtonTap:", forControlEvents: .TouchUpInside)
+      addContentView(dontShowButton)
+    case .Good:
+      let shareButton = BNFacebookButton(frame: CGRectZero)
+      shareButton.setTitle("Share", forState: .Normal)
+      shareButton.addTarget(self, action: "onShareButtonTap:", forControlEvents: .TouchUpInside)
+      addContentView(shareButton)
+    case .Bad, .MoreInfo:
+      break
+    default:
+      addContentView(makeNextButton("next step", action: "onNextStepButtonTap:"))
+    }
+  }
+
+  func addContentView(view: UIView) {
+    contentViews.append(view)
+    scrollView.addSubview(view)
+  }
+
+  // MARK: Layout
+
+  override func viewDidLayoutSubviews() {
+    super.viewDidLayoutSubviews()
+    let bounds = view.bounds
+    let margin = TestFlowStepViewController.margin
+    let topBarHeight = TestFlowStepViewController.topBarHeight
+
+    backgroundView.frame = bounds
+    backButton.frame = CGRect(x: 0, y: 20, width: 52, height: 38)
+    sectionLabel.frame = CGRect(x: 52, y: 20, width: bounds.width - 104, height: 38)
+    homeButton.frame = CGRect(x: bounds.width - 72, y: 24, width: 64, height: 30)
+    scrollView.frame = CGRect(x: 0, y: topBarHeight, width: bounds.width, height: bounds.height - topBarHeight)
+
+    // stack the content views, full width images and videos, inset labels and buttons
+    var y = TestFlowStepViewController.spacing
+    for view in contentViews {
+      let fullWidth = view is UIImageView || view is BNVideoPlayer
+      let x = fullWidth ? 0 : margin
+      let width = bounds.width - 2 * x
+      view.frame = CGRect(x: x, y: y, width: width, height: heightOfContentView(view, width: width))
+      y = view.frame.maxY + TestFlowStepViewController.spacing
+    }
+    scrollView.contentSize = CGSize(width: bounds.width, height: y)
+  }
+
+  /*
+  @brief Get the height of a content view laid out at width.
+  @discussion Subclasses override this for content views that cannot size themselves.
+  */
+  func heightOfContentView(view: UIView, width: CGFloat) -> CGFloat {
+    if view is BNVideoPlayer {
+      return floor(width * 9 / 16)
+    }
+    if let imageView = view as? UIImageView {
+      return imageView.image?.size.height ?? 0
+    }
+    if let button = view as? UIButton {
+      // answer buttons wrap their title; other buttons are a single line
+      guard let label = button.titleLabel where label.numberOfLines != 1 else {
+        return TestFlowStepViewController.buttonHeight
+      }
+      let size = label.sizeThatFits(CGSize(width: width - 32, height: CGFloat.max))
+      return max(TestFlowStepViewController.buttonHeight, ceil(size.height) + 24)
+    }
+    return ceil(view.sizeThatFits(CGSize(width: width, height: CGFloat.max)).height)
+  }
+
+  // MARK: View factories
+
+  func makeTitleLabel(text: String) -> UILabel {
+    let label = UILabel()
+    label.text = text
+    label.textAlignment = .Center
+    label.numberOfLines = 0
+    label.font = UIFont(name: kOmnesFontSemiBold, size: 23)
+    label.textColor = kBlue
+    return label
+  }
+
+  /*
+  @brief Make a label for one paragraph of copy in the standard font.
+  @param boldRange (in) Characters shown in the bold font.
+  @param markerLength (in) Number of leading characters shown in orange, for bullets and step numbers.
+  */
+  func makeParagraphLabel(text: String, boldRange: NSRange = NSMakeRange(0, 0), markerLength: Int = 0) -> UILabel {
+    let standardAttributes = [NSForegroundColorAttributeName: kGrey, NSFontAttributeName: UIFont(name: kOmnesFontMedium, size: 22)!]
+    let boldAttributes = [NSForegroundColorAttributeName: kGrey, NSFontAttributeName: UIFont(name: kOmnesFontSemiBold, size: 22)!]
+    let orangeAttributes = [NSForegroundColorAttributeName: kOrange, NSFontAttributeName: UIFont(name: kOmnesFontSemiBold, size: 22)!]
+
+    let attributedString = NSMutableAttributedString(string: text, attributes: standardAttributes)
+    let length = attributedString.length
+    if boldRange.length > 0 && boldRange.location < length {
+      attributedString.addAttributes(boldAttributes, range: NSMakeRange(boldRange.location, min(boldRange.length, length - boldRange.location)))
+    }
+    if markerLength > 0 {
+      attributedString.addAttributes(orangeAttributes, range: NSMakeRange(0, min(markerLength, length)))
+    }
+
+    let label = UILabel()
+    label.numberOfLines = 0
+    label.attributedText = attributedString
+    return label
+  }
+
+  func makeNextButton(title: String, action: Selector) -> BNButtonNext {
+    let button = BNButtonNext(frame: CGRectZero)
+    button.setTitle(title, forState: .Normal)
+    button.addTarget(self, action: action, forControlEvents: .TouchUpInside)
+    return button
+  }
+
+  func makeAnswerButton(title: String, action: Selector) -> BNButton {
+    let button = BNButton(frame: CGRectZero)
+    button.setTitle(title, forState: .Normal)
+    button.titleLabel?.numberOfLines = 0
+    button.titleLabel?.textAlignment = .Center
+    button.contentHorizontalAlignment = .Center
+    button.addTarget(self, action: action, forControlEvents: .TouchUpInside)
+    return button
+  }
+
+  // MARK: Actions
+
+  func onBackButtonTap(sender: AnyObject) {
+    self.dismissViewControllerAnimated(true, completion: nil)
+  }
+
+  func onHomeButtonTap(sender: AnyObject) {
+    coordinator.showHome(from: self)
+  }
+
+  func onNextStepButtonTap(sender: AnyObject) {
+    coordinator.showStepAfter(self)
+  }
+
+  func onDontShowAgainButtonTap(sender: AnyObject) {
+    NSUserDefaults.standardUserDefaults().setBool(true, forKey: TestFlowCoordinator.dontShowIsBabyReadyKey)
+    coordinator.showStepAfter(self)
+  }
+
+  func onGoodAnswerTap(sender: AnyObject) {
+    coordinator.recordResult(succeeded: true, from: self)
+  }
+
+  func onBadAnswerTap(sender: AnyObject) {
+    coordinator.recordResult(succeeded: false, from: self)
+  }
+
+  func onShareButtonTap(sender: AnyObject) {
+    // Present post to facebook screen.
+    BNFacebook.postToFacebook(self, testName: coordinator.definition.presentableName)
+  }
+}
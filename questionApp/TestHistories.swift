@@ -51,11 +51,21 @@ class TestHistories : NSObject, NSCoding {
         ]
     */
     
-    // The name of the file where the test history data is persisted
+    // The name of the file where the test history data is persisted, in the TestProfilesCodec format.
+    let storeFilename = "TestHistory.bin"
+    
+    // The name of the NSKeyedArchiver file used by earlier versions of the app. Read only if storeFilename does not exist.
     let archiveFilename = "TestHistoryArchive"
     
     /** Computed property for the path to the file where the data is persisted. */
     var filePath : String {
+        let manager = NSFileManager.defaultManager()
+        let url = manager.URLsForDirectory(.DocumentDirectory, inDomains: .UserDomainMask).first as NSURL!
+        return url.URLByAppendingPathComponent(self.storeFilename).path!
+    }
+    
+    /** Computed property for the path to the legacy NSKeyedArchiver file. */
+    var legacyFilePath : String {
         let manager = NSFileManager.defaultManager()
         let url = manager.URLsForDirectory(.DocumentDirectory, inDomains: .UserDomainMask).first as NSURL!
         return url.URLByAppendingPathComponent(self.archiveFilename).path!
@@ -115,7 +125,13 @@ class TestHistories : NSObject, NSCoding {
     func initHistoriesFromPersistentStore() -> Bool {
         initHistories()
         
-        if let unarchivedTestHistories = NSKeyedUnarchiver.unarchiveObjectWithFile(self.filePath) as? [String: TestHistory] {
+        if let data = NSData(contentsOfFile: self.filePath),
+            records = TestProfilesCodec.decodeHistoryRecords(data) {
+            for (testName, history) in records {
+                self.histories[testName] = history
+            }
+            return true
+        } else if let unarchivedTestHistories = NSKeyedUnarchiver.unarchiveObjectWithFile(self.legacyFilePath) as? [String: TestHistory] {
             self.histories = unarchivedTestHistories
             // DEBUG: printHistories()
             return true
@@ -254,7 +270,7 @@ class TestHistories : NSObject, NSCoding {
         @return true if successfully persisted, else false if an error occurred.
     */
     func save() -> Bool {
-        return NSKeyedArchiver.archiveRootObject(self.histories, toFile: self.filePath)
+        return TestProfilesCodec.encodeHistories(self).writeToFile(self.filePath, atomically: true)
     }
     
     /*
@@ -479,11 +495,6 @@ class TestHistories : NSObject, NSCoding {
     }
     
     func testgetTestsWithReminders() {
-        // get histories for the current profile
-        let parent = Parent()
-        let profiles = TestProfiles()
-        profiles.initProfilesFromPersistentStore()
-        let histories = profiles.getTestHistories(profileName: parent.getCurrentProfileName())
         let reminderedTests = getTestsWithReminders()
         print("tests with reminders:")
         for test in reminderedTests {
@@ -45,16 +45,14 @@ class TestMonitor: NSObject {
     */
     func onTestReminderScheduled(notification: NSNotification) {
         if let testName = notification.userInfo![testNameUserInfoKey] as? String {
-            // get histories for the current profile
-            var parent = Parent()
-            var profiles = TestProfiles()
-            profiles.initProfilesFromPersistentStore()
-            var histories = profiles.getTestHistories(profileName: parent.getCurrentProfileName())
-            if let histories = histories {
-                let testHistory = histories.getTestHistory(testName: testName)
-                // set the reminder date
-                testHistory.reminderDate = NSDate()
-                profiles.save() // persist updated testHistory properties
+            // update histories for the current profile in the shared store; the store persists the change in the background
+            let profileName = Parent.currentProfileName()
+            ProfileStore.sharedStore.update { profiles in
+                if let histories = profiles.getTestHistories(profileName: profileName) {
+                    let testHistory = histories.getTestHistory(testName: testName)
+                    // set the reminder date
+                    testHistory.reminderDate = NSDate()
+                }
             }
         }
     }
@@ -64,16 +62,14 @@ class TestMonitor: NSObject {
     */
     func onTestReminderRemoved(notification: NSNotification) {
         if let testName = notification.userInfo![testNameUserInfoKey] as? String {
-            // get histories for the current profile
-            var parent = Parent()
-            var profiles = TestProfiles()
-            profiles.initProfilesFromPersistentStore()
-            var histories = profiles.getTestHistories(profileName: parent.getCurrentProfileName())
-            if let histories = histories {
-                let testHistory = histories.getTestHistory(testName: testName)
-                // set the reminder date
-                testHistory.reminderDate = nil
-                profiles.save() // persist updated testHistory properties
+            // update histories for the current profile in the shared store; the store persists the change in the background
+            let profileName = Parent.currentProfileName()
+            ProfileStore.sharedStore.update { profiles in
+                if let histories = profiles.getTestHistories(profileName: profileName) {
+                    let testHistory = histories.getTestHistory(testName: testName)
+                    // set the reminder date
+                    testHistory.reminderDate = nil
+                }
             }
         }
     }
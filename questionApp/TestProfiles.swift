@@ -67,38 +67,268 @@ class TestProfiles {
     */
     var testProfiles = [String : TestHistories]()
     
-    // The name of the file where the test profiles data is persisted.
+    /*
+    Persistent store layout
+    
+        Documents/TestProfiles/Manifest.plist     { "version" : 1, "profiles" : { <profile name> : <shard file name> } }
+        Documents/TestProfiles/<uuid>.bin         One TestProfilesCodec archive per profile.
+    
+        Only the manifest is read by loadArchive(). A shard is decoded the first time its profile is requested, and pendingWrites() only rewrites shards whose encoded contents changed.
+    */
+    
+    /* Writes and deletions produced by pendingWrites(), to be applied with performWrites(). */
+    struct PendingWrites {
+        var writes = [(path: String, data: NSData)]()
+        var deletions = [String]()
+        
+        // What the writes persist, recorded as saved by markWritten() once performWrites() succeeds.
+        var shardData = [String : NSData]()
+        var manifestChanges: Int? = nil
+        var deletedShardFilenames = [String]()
+    }
+    
+    // The directory, in Documents, containing the manifest and shard files.
+    let storeDirectoryName = "TestProfiles"
+    
+    // The name of the manifest file within the store directory.
+    let manifestFilename = "Manifest.plist"
+    static let manifestVersion = 1
+    
+    // The name of the single-file TestProfilesCodec store used before profiles were sharded. Migrated on first load.
+    let singleFileStoreFilename = "TestProfiles.bin"
+    
+    // The name of the NSKeyedArchiver file used by earlier versions of the app. Migrated on first load.
     let archiveFilename = "TestProfilesArchive"
     
-    /** Computed property for the path to the file where the data is persisted. */
-    var filePath : String {
+    /* Shard file name for every profile in the store, keyed by profile name. */
+    private var shardFilenames = [String : String]()
+    
+    /* Names of profiles in the manifest whose shard has not been decoded yet. */
+    private var undecodedProfileNames = Set<String>()
+    
+    /* The encoded contents of each decoded profile as of the last load or save. Used to find dirty shards. */
+    private var savedShardData = [String : NSData]()
+    
+    /* Shard files of removed profiles, deleted on the next save. */
+    private var removedShardFilenames = [String]()
+    
+    /* Incremented whenever profiles are added or removed. */
+    private var manifestChanges = 0
+    
+    /* manifestChanges as of the last manifest write that succeeded. */
+    private var writtenManifestChanges = 0
+    
+    /* true if profiles were added or removed since the manifest was last written. */
+    private var manifestDirty: Bool {
+        return manifestChanges != writtenManifestChanges
+    }
+    
+    /** Computed property for the path to the directory containing the manifest and shards. */
+    var storeDirectoryPath : String {
+        return documentsPathForFilename(self.storeDirectoryName)
+    }
+    
+    /** Computed property for the path to the manifest. */
+    var manifestPath : String {
+        return (storeDirectoryPath as NSString).stringByAppendingPathComponent(self.manifestFilename)
+    }
+    
+    /** Computed property for the path to the pre-sharding TestProfilesCodec store. */
+    var singleFileStorePath : String {
+        return documentsPathForFilename(self.singleFileStoreFilename)
+    }
+    
+    /** Computed property for the path to the legacy NSKeyedArchiver file. */
+    var legacyFilePath : String {
+        return documentsPathForFilename(self.archiveFilename)
+    }
+    
+    /* The directory the store lives in. nil for the app's Documents directory. */
+    private let documentsPath: String?
+    
+    /*!
+    @brief Create an empty collection. Call loadArchive() to read the persistent store.
+    @param documentsPath (in) The directory holding the store and the files migrated from earlier versions. Pass nil (the default) for the app's Documents directory.
+    */
+    init(documentsPath: String? = nil) {
+        self.documentsPath = documentsPath
+    }
+    
+    private func documentsPathForFilename(filename: String) -> String {
+        if let path = documentsPath {
+            return (path as NSString).stringByAppendingPathComponent(filename)
+        }
         let manager = NSFileManager.defaultManager()
         let url = manager.URLsForDirectory(.DocumentDirectory, inDomains: .UserDomainMask).first as NSURL!
-        return url.URLByAppendingPathComponent(self.archiveFilename).path!
+        return url.URLByAppendingPathComponent(filename).path!
+    }
+    
+    private func shardPath(filename: String) -> String {
+        return (storeDirectoryPath as NSString).stringByAppendingPathComponent(filename)
     }
 
     /*!
-    @brief Persists all profiles to disk.
+    @brief Write changed profiles to the store without coordinating with the shared ProfileStore.
+    @discussion The app reads and writes profiles only through ProfileStore.sharedStore; this is used by the store's migration path and by tests.
     @return true if successfully persisted, else false if an error occurred.
     */
-    func save() -> Bool {
-        return NSKeyedArchiver.archiveRootObject(self.testProfiles, toFile: self.filePath)
+    func writeArchive() -> Bool {
+        let pending = pendingWrites()
+        if !TestProfiles.performWrites(pending) {
+            return false
+        }
+        markWritten(pending)
+        return true
     }
     
     /*!
-    @brief Initialize the TestProfiles instance from the persistent store at filePath.
-    @dicsussion Returns a valid object initialized to default values if no previous persisted instance exists.
+    @brief Read the manifest without coordinating with the shared ProfileStore.
+    @discussion Profiles are decoded from their shards the first time they are requested; pass preloadProfileName to decode the active profile immediately. If only a pre-sharding store exists it is decoded, rewritten as shards, and removed.
+    @param preloadProfileName (in) The profile to decode now, typically Parent.currentProfileName(). Pass nil to defer all decoding.
     @return true if successfully initialized from a previously persisted instance, else false if no previous instance existed.
     */
-    func initProfilesFromPersistentStore() -> Bool {
-        if let unarchivedTestProfiles = NSKeyedUnarchiver.unarchiveObjectWithFile(self.filePath) as? [String:TestHistories] /*[TestProfile]*/ {
+    func loadArchive(preloadProfileName preloadProfileName: String? = nil) -> Bool {
+        self.testProfiles.removeAll(keepCapacity: false)
+        self.shardFilenames.removeAll(keepCapacity: false)
+        self.undecodedProfileNames.removeAll(keepCapacity: false)
+        self.savedShardData.removeAll(keepCapacity: false)
+        self.removedShardFilenames.removeAll(keepCapacity: false)
+        self.manifestChanges = 0
+        self.writtenManifestChanges = 0
+        
+        if let manifest = NSDictionary(contentsOfFile: self.manifestPath),
+            version = manifest["version"] as? Int,
+            profiles = manifest["profiles"] as? [String : String] where version == TestProfiles.manifestVersion {
+            self.shardFilenames = profiles
+            self.undecodedProfileNames = Set(profiles.keys)
+            if let name = preloadProfileName {
+                getTestHistories(profileName: name)
+            }
+            return true
+        }
+        
+        // No manifest yet: migrate from an earlier store format, if any.
+        var migratedFrom: String? = nil
+        if let data = try? NSData(contentsOfFile: self.singleFileStorePath, options: .DataReadingMappedIfSafe),
+            archive = TestProfilesCodec.Archive(data: data) {
+            for name in archive.profileNames {
+                self.testProfiles[name] = archive.decodeHistories(profileName: name)
+            }
+            migratedFrom = self.singleFileStorePath
+        } else if let unarchivedTestProfiles = NSKeyedUnarchiver.unarchiveObjectWithFile(self.legacyFilePath) as? [String:TestHistories] /*[TestProfile]*/ {
             self.testProfiles = unarchivedTestProfiles
             //printProfiles()
+            migratedFrom = self.legacyFilePath
+        }
+        
+        if let oldPath = migratedFrom {
+            // Every profile is new to the sharded store. The old file is only removed once the shards have been written.
+            self.manifestChanges += 1
+            if writeArchive() {
+                do {
+                    try NSFileManager.defaultManager().removeItemAtPath(oldPath)
+                } catch let error as NSError {
+                    NSLog("TestProfiles: failed to remove migrated store \(oldPath): \(error), \(error.userInfo)")
+                }
+            }
             return true
         } else {
             return false
         }
     }
+    
+    /*!
+    @brief Collect the file writes needed to persist changes since the last successful save.
+    @discussion Each decoded profile is re-encoded and compared with its last saved contents, so profiles changed by mutating their TestHistory objects directly are found too. The manifest is written last so it never refers to a shard that does not exist yet. Nothing is marked as saved here; pass the result to markWritten() once performWrites() has succeeded, so a failed write is collected again by the next save.
+    @return The writes and deletions to apply with TestProfiles.performWrites().
+    */
+    func pendingWrites() -> PendingWrites {
+        var pending = PendingWrites()
+        
+        for name in testProfiles.keys.sort() {
+            let data = TestProfilesCodec.encode([name : testProfiles[name]!])
+            if let saved = savedShardData[name] where saved.isEqualToData(data) {
+                continue
+            }
+            let filename: String
+            if let existing = shardFilenames[name] {
+                filename = existing
+            } else {
+                filename = NSUUID().UUIDString + ".bin"
+                shardFilenames[name] = filename
+                manifestChanges += 1
+            }
+            pending.writes.append((path: shardPath(filename), data: data))
+            pending.shardData[name] = data
+        }
+        
+        if manifestDirty {
+            let manifest: [String : AnyObject] = ["version" : TestProfiles.manifestVersion, "profiles" : shardFilenames]
+            do {
+                let data = try NSPropertyListSerialization.dataWithPropertyList(manifest, format: .BinaryFormat_v1_0, options: 0)
+                pending.writes.append((path: manifestPath, data: data))
+                pending.manifestChanges = manifestChanges
+            } catch let error as NSError {
+                NSLog("TestProfiles: failed to encode manifest: \(error), \(error.userInfo)")
+            }
+        }
+        
+        pending.deletions = removedShardFilenames.map { self.shardPath($0) }
+        pending.deletedShardFilenames = removedShardFilenames
+        return pending
+    }
+    
+    /*!
+    @brief Record writes collected by pendingWrites() as saved, once TestProfiles.performWrites() has applied them.
+    @discussion Changes made since the writes were collected stay dirty: a shard is only clean while it encodes to the saved data, and the manifest while no profile has been added or removed since.
+    */
+    func markWritten(pending: PendingWrites) {
+        for (name, data) in pending.shardData where shardFilenames[name] != nil {
+            savedShardData[name] = data
+        }
+        if let changes = pending.manifestChanges {
+            writtenManifestChanges = max(writtenManifestChanges, changes)
+        }
+        removedShardFilenames = removedShardFilenames.filter { !pending.deletedShardFilenames.contains($0) }
+    }
+    
+    /*!
+    @brief Apply writes collected by pendingWrites().
+    @discussion Safe to call from any thread. Each file is replaced atomically.
+    @return true if every write succeeded, else false.
+    */
+    static func performWrites(pending: PendingWrites) -> Bool {
+        if pending.writes.isEmpty && pending.deletions.isEmpty {
+            return true
+        }
+        let manager = NSFileManager.defaultManager()
+        var succeeded = true
+        for write in pending.writes {
+            do {
+                let directory = (write.path as NSString).stringByDeletingLastPathComponent
+                try manager.createDirectoryAtPath(directory, withIntermediateDirectories: true, attributes: nil)
+                try write.data.writeToFile(write.path, options: .DataWritingAtomic)
+            } catch let error as NSError {
+                NSLog("TestProfiles: failed to write \(write.path): \(error), \(error.userInfo)")
+                succeeded = false
+            }
+        }
+        for path in pending.deletions {
+            do {
+                try manager.removeItemAtPath(path)
+            } catch {
+                // already gone
+            }
+        }
+        return succeeded
+    }
+    
+    /* Decode every profile still held only in its shard into testProfiles. */
+    private func decodeAllProfiles() {
+        for name in undecodedProfileNames {
+            getTestHistories(profileName: name)
+        }
+    }
 
     /*
     @brief Get a Test for the named profile and test.
@@ -108,8 +338,9 @@ class TestProfiles {
     */
     func getTest(profileName: String, testName: String) -> Test {
         // Get the test histories for the profile with the specified name.
-        if let testHistories = testProfiles[profileName] {
+        if let testHistories = getTestHistories(profileName: profileName) {
             let test = testHistories.getTest(testName)
+            test.profileName = profileName
             return test
         } else {
             return Test()
@@ -130,10 +361,10 @@ class TestProfiles {
     
     /*
     @brief create a TestProfile and add it to the testProfiles collection
-    @discussion Creates a profile for name if it doesn't already exist. If it exists this function does nothing.
+    @discussion Creates a profile for name if it doesn't already exist. If it exists this function does nothing, including when its shard could not be read: an empty profile would overwrite it.
     */
     func addProfile(name name: String) {
-        if testProfiles[name] == nil {
+        if getTestHistories(profileName: name) == nil && shardFilenames[name] == nil {
             // testProfiles doesn't contain a key by that name yet so add it.
             testProfiles[name] = TestHistories()
         }
@@ -142,19 +373,44 @@ class TestProfiles {
     // remove the TestProfile of the given name from the testProfiles collection
     func removeProfile(name: String) {
         testProfiles[name] = nil
+        undecodedProfileNames.remove(name)
+        savedShardData[name] = nil
+        if let filename = shardFilenames.removeValueForKey(name) {
+            removedShardFilenames.append(filename)
+            manifestChanges += 1
+        }
     }
     
     // remove all profiles
     func removeAllProfiles() {
-        testProfiles.removeAll(keepCapacity: false)
+        for name in Array(testProfiles.keys) + Array(shardFilenames.keys) {
+            removeProfile(name)
+        }
     }
     
     /*!
     @brief Get the TestHistories for a specified profile name.
-    @return The TestHistories object for name. nil If no match is found.
+    @return The TestHistories object for name. nil If no match is found, or if the profile's shard could not be read.
     */
     func getTestHistories(profileName profileName: String) -> TestHistories? {
-        return testProfiles[profileName]
+        if let histories = testProfiles[profileName] {
+            return histories
+        }
+        // Decode the profile from its shard on first access.
+        if undecodedProfileNames.contains(profileName) {
+            if let filename = shardFilenames[profileName],
+                data = NSData(contentsOfFile: shardPath(filename)),
+                histories = TestProfilesCodec.Archive(data: data)?.decodeHistories(profileName: profileName) {
+                undecodedProfileNames.remove(profileName)
+                testProfiles[profileName] = histories
+                // Remember the re-encoded form so an unchanged profile is not rewritten on save.
+                savedShardData[profileName] = TestProfilesCodec.encode([profileName : histories])
+                return histories
+            }
+            // The profile stays undecoded, so its shard is never overwritten and the next access tries again.
+            NSLog("TestProfiles: could not read shard for profile \(profileName)")
+        }
+        return nil
     }
     
     /*!
@@ -162,6 +418,7 @@ class TestProfiles {
     @return The TestProfile whose profileName property == name. If no match is found then returns nil.
     */
     func printProfiles() {
+        decodeAllProfiles()
         for (profileName, testHistories) in testProfiles {
             print("{ ")
             print("\t\(profileName) : {")
@@ -0,0 +1,318 @@
+/*!
+@header TestProfilesCodec.swift
+
+@brief This file contains TestProfilesCodec, a compact versioned binary encoding for test profiles, and its lazily decoding Archive reader.
+@discussion NSKeyedArchiver stores class names and key strings for every TestHistory and must decode the whole object graph before any profile can be used. This format stores each test name once in a string table, each TestHistory as a fixed-size record, and a directory so a single profile can be decoded without touching the others.
+
+    Header (16 bytes):      "BNTP" | version: UInt16 | recordSize: UInt16 | stringCount: UInt32 | profileCount: UInt32
+    String table:           stringCount x ( length: UInt16 | UTF-8 bytes )
+    Profile directory:      profileCount x ( nameIndex: UInt32 | recordOffset: UInt32 | recordCount: UInt32 )
+    Records (48 bytes):     testNameIndex: UInt32 | flags: UInt8 | reserved: 3 bytes
+                            | countOfFailedTests: UInt32 | countOfSuccessfulTests: UInt32 | countOfCompletedTests: UInt32 | reserved: UInt32
+                            | mostRecentTestDate: Float64 | succeededTestDate: Float64 | reminderDate: Float64
+
+    All values are little-endian. Dates are seconds since the NSDate reference date. recordOffset is relative to the start of the data.
+
+@copyright 2015 Qidza, Inc.
+*/
+
+import Foundation
+
+class TestProfilesCodec {
+
+    // File layout constants.
+    static let magic: [UInt8] = [0x42, 0x4E, 0x54, 0x50] // "BNTP"
+    static let version: UInt16 = 1
+    static let headerSize = 16
+    static let directoryEntrySize = 12
+    static let recordSize = 48
+
+    // Record flag bits.
+    struct Flags {
+        static let mostRecentTestResult: UInt8 = 1 << 0
+        static let hasSucceededTestDate: UInt8 = 1 << 1
+        static let hasReminderDate: UInt8 = 1 << 2
+    }
+
+    // MARK: Encoding
+
+    /*!
+    @brief Encode a collection of profiles.
+    @param profiles (in) A dictionary where key is a profile name and value is the TestHistories for that profile.
+    @return The encoded data.
+    */
+    static func encode(profiles: [String : TestHistories]) -> NSData {
+        // Seed the string table with the known test names so they get small, stable indexes.
+        var strings = [String]()
+        var stringIndexes = [String : UInt32]()
+        func indexForString(string: String) -> UInt32 {
+            if let index = stringIndexes[string] {
+                return index
+            }
+            let index = UInt32(strings.count)
+            strings.append(string)
+            stringIndexes[string] = index
+            return index
+        }
+        for testName in TestResultLog.testIds {
+            indexForString(testName)
+        }
+
+        let profileNames = profiles.keys.sort()
+        var nameIndexes = [UInt32]()
+        var recordCounts = [Int]()
+        for name in profileNames {
+            nameIndexes.append(indexForString(name))
+            let histories = profiles[name]!.histories
+            for testName in histories.keys {
+                indexForString(testName)
+            }
+            recordCounts.append(histories.count)
+        }
+
+        let data = NSMutableData()
+        data.appendBytes(magic, length: magic.count)
+        appendUInt16(version, to: data)
+        appendUInt16(UInt16(recordSize), to: data)
+        appendUInt32(UInt32(strings.count), to: data)
+        appendUInt32(UInt32(profileNames.count), to: data)
+
+        for string in strings {
+            let bytes = Array(string.utf8)
+            appendUInt16(UInt16(bytes.count), to: data)
+            data.appendBytes(bytes, length: bytes.count)
+        }
+
+        // Records follow the directory, so their offsets are known before they are written.
+        var recordOffset = data.length + profileNames.count * directoryEntrySize
+        for i in 0..<profileNames.count {
+            appendUInt32(nameIndexes[i], to: data)
+            appendUInt32(UInt32(recordOffset), to: data)
+            appendUInt32(UInt32(recordCounts[i]), to: data)
+            recordOffset += recordCounts[i] * recordSize
+        }
+
+        for name in profileNames {
+            // sorted so that encoding the same histories always produces the same bytes
+            let histories = profiles[name]!.histories
+            for testName in histories.keys.sort() {
+                appendRecord(histories[testName]!, nameIndex: stringIndexes[testName]!, to: data)
+            }
+        }
+        return data
+    }
+
+    /*!
+    @brief Encode the histories of a single profile.
+    @discussion Used by TestHistories and Test for their stand-alone archives.
+    */
+    static func encodeHistories(histories: TestHistories) -> NSData {
+        return encode(["" : histories])
+    }
+
+    /*!
+    @brief Decode data written by encodeHistories().
+    @return The decoded TestHistory objects keyed by test name, else nil if data is not a valid archive.
+    */
+    static func decodeHistoryRecords(data: NSData) -> [String : TestHistory]? {
+        return Archive(data: data)?.decodeHistoryRecords(profileName: "")
+    }
+
+    private static func appendRecord(history: TestHistory, nameIndex: UInt32, to data: NSMutableData) {
+        var flags: UInt8 = 0
+        if history.mostRecentTestResult {
+            flags |= Flags.mostRecentTestResult
+        }
+        if history.succeededTestDate != nil {
+            flags |= Flags.hasSucceededTestDate
+        }
+        if history.reminderDate != nil {
+            flags |= Flags.hasReminderDate
+        }
+        appendUInt32(nameIndex, to: data)
+        var flagBytes: [UInt8] = [flags, 0, 0, 0]
+        data.appendBytes(&flagBytes, length: 4)
+        appendUInt32(clampedUInt32(history.countOfFailedTests), to: data)
+        appendUInt32(clampedUInt32(history.countOfSuccessfulTests), to: data)
+        appendUInt32(clampedUInt32(history.countOfCompletedTests), to: data)
+        appendUInt32(0, to: data)
+        appendDouble(history.mostRecentTestDate.timeIntervalSinceReferenceDate, to: data)
+        appendDouble(history.succeededTestDate?.timeIntervalSinceReferenceDate ?? 0, to: data)
+        appendDouble(history.reminderDate?.timeIntervalSinceReferenceDate ?? 0, to: data)
+    }
+
+    private static func clampedUInt32(value: Int) -> UInt32 {
+        return UInt32(max(0, min(value, Int(UInt32.max))))
+    }
+
+    private static func appendUInt16(value: UInt16, to data: NSMutableData) {
+        var le = value.littleEndian
+        data.appendBytes(&le, length: 2)
+    }
+
+    private static func appendUInt32(value: UInt32, to data: NSMutableData) {
+        var le = value.littleEndian
+        data.appendBytes(&le, length: 4)
+    }
+
+    private static func appendDouble(value: Double, to data: NSMutableData) {
+        var le = unsafeBitCast(value, UInt64.self).littleEndian
+        data.appendBytes(&le, length: 8)
+    }
+
+    // MARK: Decoding
+
+    /*
+    @brief A read-only view of encoded profiles that decodes individual profiles on request.
+    @discussion Construction only reads the header, string table and directory. The data may be memory-mapped.
+    */
+    class Archive {
+
+        let data: NSData
+
+        /* Decoded string table. */
+        private var strings = [String]()
+
+        /* Directory entries keyed by profile name. */
+        private var directory = [String : (offset: Int, count: Int)]()
+
+        /* The names of all profiles in the archive. */
+        var profileNames: [String] {
+            return Array(directory.keys)
+        }
+
+        /*!
+        @brief Parse the header, string table and directory of data.
+        @return nil if data is not a valid archive of a supported version.
+        */
+        init?(data: NSData) {
+            self.data = data
+            if !parse() {
+                return nil
+            }
+        }
+
+        func containsProfile(profileName: String) -> Bool {
+            return directory[profileName] != nil
+        }
+
+        /*!
+        @brief Decode the test histories of one profile.
+        @discussion Tests missing from the archive keep the default TestHistory created by TestHistories().
+        @return The decoded TestHistories, else nil if the profile is not in the archive.
+        */
+        func decodeHistories(profileName profileName: String) -> TestHistories? {
+            guard let records = decodeHistoryRecords(profileName: profileName) else {
+                return nil
+            }
+            let histories = TestHistories()
+            for (testName, history) in records {
+                histories.histories[testName] = history
+            }
+            return histories
+        }
+
+        /*!
+        @brief Decode only the TestHistory records stored for one profile.
+        @return The decoded TestHistory objects keyed by test name, else nil if the profile is not in the archive.
+        */
+        func decodeHistoryRecords(profileName profileName: String) -> [String : TestHistory]? {
+            guard let entry = directory[profileName] else {
+                return nil
+            }
+            var records = [String : TestHistory]()
+            for i in 0..<entry.count {
+                let offset = entry.offset + i * TestProfilesCodec.recordSize
+                let nameIndex = Int(readUInt32(offset))
+                if nameIndex >= strings.count {
+                    continue
+                }
+                var flags: UInt8 = 0
+                data.getBytes(&flags, range: NSRange(location: offset + 4, length: 1))
+
+                let history = TestHistory(nameOfTest: strings[nameIndex])
+                history.mostRecentTestResult = (flags & Flags.mostRecentTestResult) != 0
+                history.countOfFailedTests = Int(readUInt32(offset + 8))
+                history.countOfSuccessfulTests = Int(readUInt32(offset + 12))
+                history.countOfCompletedTests = Int(readUInt32(offset + 16))
+                history.mostRecentTestDate = NSDate(timeIntervalSinceReferenceDate: readDouble(offset + 24))
+                if (flags & Flags.hasSucceededTestDate) != 0 {
+                    history.succeededTestDate = NSDate(timeIntervalSinceReferenceDate: readDouble(offset + 32))
+                }
+                if (flags & Flags.hasReminderDate) != 0 {
+                    history.reminderDate = NSDate(timeIntervalSinceReferenceDate: readDouble(offset + 40))
+                }
+                records[history.testName] = history
+            }
+            return records
+        }
+
+        private func parse() -> Bool {
+            if data.length < TestProfilesCodec.headerSize {
+                return false
+            }
+            var magic = [UInt8](count: 4, repeatedValue: 0)
+            data.getBytes(&magic, length: 4)
+            if magic != TestProfilesCodec.magic
+                || readUInt16(4) != TestProfilesCodec.version
+                || Int(readUInt16(6)) != TestProfilesCodec.recordSize {
+                return false
+            }
+            let stringCount = Int(readUInt32(8))
+            let profileCount = Int(readUInt32(12))
+
+            var offset = TestProfilesCodec.headerSize
+            strings.reserveCapacity(stringCount)
+            for _ in 0..<stringCount {
+                if offset + 2 > data.length {
+                    return false
+                }
+                let length = Int(readUInt16(offset))
+                offset += 2
+                if offset + length > data.length {
+                    return false
+                }
+                let bytes = UnsafePointer<UInt8>(data.bytes) + offset
+                let buffer = UnsafeBufferPointer(start: bytes, count: length)
+                guard let string = String(bytes: buffer, encoding: NSUTF8StringEncoding) else {
+                    return false
+                }
+                strings.append(string)
+                offset += length
+            }
+
+            if offset + profileCount * TestProfilesCodec.directoryEntrySize > data.length {
+                return false
+            }
+            for _ in 0..<profileCount {
+                let nameIndex = Int(readUInt32(offset))
+                let recordOffset = Int(readUInt32(offset + 4))
+                let recordCount = Int(readUInt32(offset + 8))
+                offset += TestProfilesCodec.directoryEntrySize
+                if nameIndex >= strings.count || recordOffset + recordCount * TestProfilesCodec.recordSize > data.length {
+                    return false
+                }
+                directory[strings[nameIndex]] = (recordOffset, recordCount)
+            }
+            return true
+        }
+
+        private func readUInt16(offset: Int) -> UInt16 {
+            var value: UInt16 = 0
+            data.getBytes(&value, range: NSRange(location: offset, length: 2))
+            return UInt16(littleEndian: value)
+        }
+
+        private func readUInt32(offset: Int) -> UInt32 {
+            var value: UInt32 = 0
+            data.getBytes(&value, range: NSRange(location: offset, length: 4))
+            return UInt32(littleEndian: value)
+        }
+
+        private func readDouble(offset: Int) -> Double {
+            var bits: UInt64 = 0
+            data.getBytes(&bits, range: NSRange(location: offset, length: 8))
+            return unsafeBitCast(UInt64(littleEndian: bits), Double.self)
+        }
+    }
+}
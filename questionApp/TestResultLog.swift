@@ -0,0 +1,515 @@
+/*!
+@header TestResultLog.swift
+
+@brief This file contains the TestResultLog class, an append-only binary log of every test attempt for one child profile.
+@discussion Persistence: Each profile has its own file in Documents/TestResultLogs. The file is an 8 byte header followed by fixed-size 16 byte records, one per attempt, in the order they were recorded. Appending a result writes one record at the end of the file; nothing else is rewritten. Queries memory-map the file, so opening a log costs the same regardless of how many years of attempts it holds.
+
+    Header (8 bytes):   "BNRL" | version: UInt16 | recordSize: UInt16
+    Record (16 bytes):  timestamp: Float64 | testId: UInt16 | outcome: UInt8 | reserved: UInt8 | reserved: UInt32
+
+    All values are little-endian. timestamp is seconds since the NSDate reference date. testId is the 1-based index of the test name in TestResultLog.testIds.
+
+@copyright 2015 Qidza, Inc.
+*/
+
+import Foundation
+
+class TestResultLog {
+
+    /* A single test attempt read from the log. */
+    struct Record {
+        let testName: String
+        let date: NSDate
+        let succeeded: Bool
+    }
+
+    /*
+    Stable test identifiers. The position of a name in this list (plus one) is the testId written to disk.
+    IMPORTANT: only append to this list. Reordering or removing entries changes the meaning of existing logs.
+    */
+    static let testIds: [String] = [
+        Test.TestNames.pupilResponse,
+        Test.TestNames.fallingToy,
+        Test.TestNames.letsCrawl,
+        Test.TestNames.pointFollowing,
+        Test.TestNames.hearing,
+        Test.TestNames.crossingEyes,
+        Test.TestNames.attentionAtDistance,
+        Test.TestNames.symmetry,
+        Test.TestNames.pincer,
+        Test.TestNames.completelyCoveredToy,
+        Test.TestNames.partiallyCoveredToy,
+        Test.TestNames.selfRecognition,
+        Test.TestNames.socialSmiling,
+        Test.TestNames.facialMimic,
+        Test.TestNames.unassistedSitting,
+        Test.TestNames.reachingWhileSitting,
+        Test.TestNames.plasticJar,
+        Test.TestNames.jointAttention,
+        Test.TestNames.rollingBackToFront,
+        Test.TestNames.emotionalAttachment,
+        Test.TestNames.emotionalSecurity,
+        Test.TestNames.receptiveLanguage,
+        Test.TestNames.visualTracking,
+        Test.TestNames.reachingForToy
+        // Append-only: a test's position in this list is its id in every log already on disk.
+    ]
+
+    // File layout constants.
+    static let magic: [UInt8] = [0x42, 0x4E, 0x52, 0x4C] // "BNRL"
+    static let version: UInt16 = 1
+    static let headerSize = 8
+    static let recordSize = 16
+
+    /* Length of a month in seconds, matching Parent.ageInMonths (4 weeks per month). */
+    static let SecondsInAMonth: Double = 4 * 7 * Test.SecondsInADay
+
+    // The name of the directory, in Documents, containing one log file per profile.
+    static let directoryName = "TestResultLogs"
+
+    /* The profile this log belongs to. */
+    let profileName: String
+
+    /* Full path of the log file. */
+    let filePath: String
+
+    /* Serializes all file access and index updates. */
+    private let queue = dispatch_queue_create("com.qidza.testResultLog", DISPATCH_QUEUE_SERIAL)
+
+    /* Memory-mapped contents of the log. nil until the first query, and reset after every append. */
+    private var mappedData: NSData?
+
+    /* Number of complete records in the file. -1 until the file has been opened. */
+    private var recordCount = -1
+
+    /* Timestamp of the last record. Appended timestamps are clamped to be >= this so the log stays sorted by time. */
+    private var lastTimestamp: Double = -Double.infinity
+
+    /* Per-test record positions, built by one pass over the file on the first per-test query and extended on append. */
+    private var testIndex: [UInt16 : [Int]]?
+
+    /* Open logs, keyed by profile name. Guarded by logsQueue. */
+    private static var logs = [String : TestResultLog]()
+    private static let logsQueue = dispatch_queue_create("com.qidza.testResultLog.logs", DISPATCH_QUEUE_SERIAL)
+
+    /*!
+    @brief Get the shared log for a profile.
+    @param profileName (in) A profile name as returned by Parent.getCurrentProfileName(). (cannot be nil)
+    @return The TestResultLog for the profile. The file is created on first append.
+    */
+    static func logForProfile(profileName: String) -> TestResultLog {
+        var log: TestResultLog!
+        dispatch_sync(logsQueue) {
+            if let existing = logs[profileName] {
+                log = existing
+            } else {
+                log = TestResultLog(profileName: profileName)
+                logs[profileName] = log
+            }
+        }
+        return log
+    }
+
+    /*
+    Initialize a log for profileName. Use logForProfile() so all callers share one instance per profile.
+    directoryPath is the directory holding the log files; nil (the default) for Documents/TestResultLogs.
+    */
+    init(profileName: String, directoryPath: String? = nil) {
+        self.profileName = profileName
+        let directory: NSURL
+        if let path = directoryPath {
+            directory = NSURL(fileURLWithPath: path, isDirectory: true)
+        } else {
+            let documents = NSFileManager.defaultManager().URLsForDirectory(.DocumentDirectory, inDomains: .UserDomainMask).first as NSURL!
+            directory = documents.URLByAppendingPathComponent(TestResultLog.directoryName)
+        }
+        // profile names are "<parent>.<baby>"; keep them readable but strip path separators
+        let fileName = profileName.stringByReplacingOccurrencesOfString("/", withString: "_") + ".log"
+        filePath = directory.URLByAppendingPathComponent(fileName).path!
+    }
+
+    /*!
+    @brief Get the numeric identifier used on disk for a test name.
+    @return The testId, else nil if testName is not in TestResultLog.testIds.
+    */
+    static func testIdForName(testName: String) -> UInt16? {
+        if let index = testIds.indexOf(testName) {
+            return UInt16(index + 1)
+        }
+        return nil
+    }
+
+    // MARK: Writing
+
+    /*!
+    @brief Append one test attempt to the log.
+    @discussion Writes a single 16 byte record at the end of the file. Results for tests not listed in TestResultLog.testIds are ignored.
+    @param testName (in) The name of the test. Must be of Test.TestNames. (cannot be nil)
+    @param succeeded (in) The outcome of the attempt.
+    @param date (in) When the attempt happened. Defaults to now.
+    @return true if the record was written, else false.
+    */
+    func append(testName testName: String, succeeded: Bool, date: NSDate = NSDate()) -> Bool {
+        guard let testId = TestResultLog.testIdForName(testName) else {
+            return false
+        }
+        var written = false
+        dispatch_sync(queue) {
+            self.openIfNeeded()
+            let timestamp = max(date.timeIntervalSinceReferenceDate, self.lastTimestamp)
+            let record = TestResultLog.encodeRecord(timestamp: timestamp, testId: testId, succeeded: succeeded)
+
+            if let handle = self.fileHandleForAppending() {
+                handle.writeData(record)
+                handle.closeFile()
+
+                // extend the in-memory state instead of rescanning the file
+                if var positions = self.testIndex?[testId] {
+                    positions.append(self.recordCount)
+                    self.testIndex![testId] = positions
+                } else if self.testIndex != nil {
+                    self.testIndex![testId] = [self.recordCount]
+                }
+                self.recordCount += 1
+                self.lastTimestamp = timestamp
+                self.mappedData = nil
+                written = true
+            }
+        }
+        return written
+    }
+
+    // MARK: Queries
+
+    /*!
+    @brief Get attempts recorded within a date window, optionally for a single test.
+    @discussion Uses binary search on the time-ordered records, so the cost depends on the size of the result, not the size of the log.
+    @param testName (in) Restrict results to this test. Pass nil for all tests.
+    @param from (in) Earliest date to include. Pass nil for no lower bound.
+    @param to (in) Date to stop before (exclusive). Pass nil for no upper bound.
+    @return The matching records in the order they were recorded.
+    */
+    func records(testName testName: String?, from: NSDate?, to: NSDate?) -> [Record] {
+        let lower = from?.timeIntervalSinceReferenceDate ?? -Double.infinity
+        let upper = to?.timeIntervalSinceReferenceDate ?? Double.infinity
+        var result = [Record]()
+
+        dispatch_sync(queue) {
+            guard let data = self.mappedLog() else {
+                return
+            }
+            if let testName = testName {
+                guard let testId = TestResultLog.testIdForName(testName) else {
+                    return
+                }
+                let positions = self.positionsForTestId(testId, data: data)
+                let start = TestResultLog.lowerBound(positions.count) { TestResultLog.timestampAt(positions[$0], data: data) < lower }
+                let end = TestResultLog.lowerBound(positions.count) { TestResultLog.timestampAt(positions[$0], data: data) < upper }
+                for i in start..<max(start, end) {
+                    result.append(TestResultLog.recordAt(positions[i], data: data))
+                }
+            } else {
+                let start = TestResultLog.lowerBound(self.recordCount) { TestResultLog.timestampAt($0, data: data) < lower }
+                let end = TestResultLog.lowerBound(self.recordCount) { TestResultLog.timestampAt($0, data: data) < upper }
+                for i in start..<max(start, end) {
+                    result.append(TestResultLog.recordAt(i, data: data))
+                }
+            }
+        }
+        return result
+    }
+
+    /*!
+    @brief Get attempts recorded while the child's age was within a window.
+    @param testName (in) Restrict results to this test. Pass nil for all tests.
+    @param birthday (in) The child's birth date. (cannot be nil)
+    @param fromMonth (in) Start of the age window in months (inclusive).
+    @param toMonth (in) End of the age window in months (exclusive).
+    @return The matching records in the order they were recorded.
+    */
+    func records(testName testName: String?, birthday: NSDate, fromMonth: Double, toMonth: Double) -> [Record] {
+        let from = birthday.dateByAddingTimeInterval(fromMonth * TestResultLog.SecondsInAMonth)
+        let to = birthday.dateByAddingTimeInterval(toMonth * TestResultLog.SecondsInAMonth)
+        return records(testName: testName, from: from, to: to)
+    }
+
+    /*!
+    @brief Get the child's age, in months, at the first successful attempt of a test.
+    @return The age in months, else nil if the test has never been passed.
+    */
+    func ageInMonthsOfFirstSuccess(testName testName: String, birthday: NSDate) -> Double? {
+        for record in records(testName: testName, from: birthday, to: nil) where record.succeeded {
+            return record.date.timeIntervalSinceDate(birthday) / TestResultLog.SecondsInAMonth
+        }
+        return nil
+    }
+
+    /*!
+    @brief Count passed and failed attempts within a date window.
+    @param testNames (in) The tests to include. Pass nil for all tests.
+    @return A tuple of the number of passed and failed attempts.
+    */
+    func outcomeCounts(testNames testNames: [String]?, from: NSDate?, to: NSDate?) -> (passed: Int, failed: Int) {
+        var counts: (passed: Int, failed: Int) = (0, 0)
+        let included = testNames.map { Set($0) }
+        for record in records(testName: nil, from: from, to: to) {
+            if let included = included where !included.contains(record.testName) {
+                continue
+            }
+            if record.succeeded {
+                counts.passed += 1
+            } else {
+                counts.failed += 1
+            }
+        }
+        return counts
+    }
+
+    // MARK: Compaction
+
+    /*!
+    @brief Rebuild the aggregate TestHistory values from the log, and rewrite the log without unreadable records.
+    @discussion Counters, most recent result/date and succeeded date are recomputed for every test whose log holds at least as many attempts as its TestHistory counts. That repairs histories whose write-behind save was lost (the log is appended synchronously), while tests with attempts from before the log existed keep their counters. reminderDate is left untouched. The log file is only rewritten (atomically) if it contains records for unknown tests or a partially written trailing record.
+    @param histories (in) The TestHistories of this log's profile. Missing TestHistory entries are created.
+    @return true if the aggregates were rebuilt, else false if the log could not be read.
+    */
+    func compact(histories histories: TestHistories) -> Bool {
+        var rebuilt = false
+        dispatch_sync(queue) {
+            self.openIfNeeded()
+            guard let data = self.mappedLog() else {
+                // an empty log is valid: nothing to rebuild
+                rebuilt = self.recordCount == 0
+                return
+            }
+
+            var aggregates = [String : TestHistory]()
+            let kept = NSMutableData(capacity: TestResultLog.headerSize + self.recordCount * TestResultLog.recordSize)!
+            kept.appendData(TestResultLog.encodeHeader())
+            var dropped = data.length != TestResultLog.headerSize + self.recordCount * TestResultLog.recordSize
+
+            for i in 0..<self.recordCount {
+                let testId = TestResultLog.testIdAt(i, data: data)
+                if testId == 0 || Int(testId) > TestResultLog.testIds.count {
+                    dropped = true
+                    continue
+                }
+                kept.appendData(data.subdataWithRange(NSRange(location: TestResultLog.headerSize + i * TestResultLog.recordSize, length: TestResultLog.recordSize)))
+
+                let record = TestResultLog.recordAt(i, data: data)
+                let history = aggregates[record.testName] ?? TestHistory(nameOfTest: record.testName)
+                aggregates[record.testName] = history
+                history.countOfCompletedTests += 1
+                if record.succeeded {
+                    history.countOfSuccessfulTests += 1
+                    history.succeededTestDate = record.date
+                } else {
+                    history.countOfFailedTests += 1
+                }
+                // records are time-ordered, so the last one seen is the most recent
+                history.mostRecentTestDate = record.date
+                history.mostRecentTestResult = record.succeeded
+            }
+
+            for (testName, aggregate) in aggregates {
+                let history = histories.histories[testName] ?? TestHistory(nameOfTest: testName)
+                if aggregate.countOfCompletedTests < history.countOfCompletedTests {
+                    // the history predates the log, so the log is missing some of its attempts
+                    continue
+                }
+                history.countOfCompletedTests = aggregate.countOfCompletedTests
+                history.countOfSuccessfulTests = aggregate.countOfSuccessfulTests
+                history.countOfFailedTests = aggregate.countOfFailedTests
+                history.mostRecentTestDate = aggregate.mostRecentTestDate
+                history.mostRecentTestResult = aggregate.mostRecentTestResult
+                history.succeededTestDate = aggregate.succeededTestDate
+                histories.histories[testName] = history
+            }
+
+            if dropped {
+                do {
+                    try kept.writeToFile(self.filePath, options: .DataWritingAtomic)
+                } catch let error as NSError {
+                    NSLog("TestResultLog: failed to compact \(self.filePath): \(error), \(error.userInfo)")
+                }
+                // force the counts and index to be rebuilt from the new file
+                self.recordCount = -1
+                self.testIndex = nil
+                self.mappedData = nil
+                self.openIfNeeded()
+            }
+            rebuilt = true
+        }
+        return rebuilt
+    }
+
+    // MARK: Private helpers (must be called on queue)
+
+    /* Read the record count and last timestamp from the file, if not already known. */
+    private func openIfNeeded() {
+        if recordCount >= 0 {
+            return
+        }
+        recordCount = 0
+        lastTimestamp = -Double.infinity
+        if let data = mappedLog() {
+            if recordCount > 0 {
+                lastTimestamp = TestResultLog.timestampAt(recordCount - 1, data: data)
+            }
+        }
+    }
+
+    /* Map the log file. Sets recordCount from the file length. Returns nil if the file is missing or not a valid log; an invalid log is moved aside so the next append starts a new one. */
+    private func mappedLog() -> NSData? {
+        if let data = mappedData {
+            return data
+        }
+        guard let data = try? NSData(contentsOfFile: filePath, options: .DataReadingMappedIfSafe) else {
+            return nil
+        }
+        guard TestResultLog.isValidHeader(data) else {
+            moveAsideUnrecognizedLog()
+            return nil
+        }
+        // a trailing partial record (from an interrupted write) is ignored
+        recordCount = (data.length - TestResultLog.headerSize) / TestResultLog.recordSize
+        mappedData = data
+        return data
+    }
+
+    /*
+    Rename a log with an unrecognized header (e.g. written by a newer version of the app) to "<profile>.log.unrecognized", replacing any earlier one, so it is kept for recovery instead of being truncated by the next append.
+    */
+    private func moveAsideUnrecognizedLog() {
+        let manager = NSFileManager.defaultManager()
+        let asidePath = filePath + ".unrecognized"
+        do {
+            if manager.fileExistsAtPath(asidePath) {
+                try manager.removeItemAtPath(asidePath)
+            }
+            try manager.moveItemAtPath(filePath, toPath: asidePath)
+            NSLog("TestResultLog: moved \(filePath) with an unrecognized header to \(asidePath)")
+        } catch let error as NSError {
+            NSLog("TestResultLog: failed to move aside \(filePath) with an unrecognized header: \(error), \(error.userInfo)")
+        }
+        recordCount = 0
+        lastTimestamp = -Double.infinity
+        testIndex = nil
+    }
+
+    /* Positions of all records for testId, building the per-test index on first use. */
+    private func positionsForTestId(testId: UInt16, data: NSData) -> [Int] {
+        if testIndex == nil {
+            var index = [UInt16 : [Int]]()
+            for i in 0..<recordCount {
+                let id = TestResultLog.testIdAt(i, data: data)
+                if index[id] == nil {
+                    index[id] = [i]
+                } else {
+                    index[id]!.append(i)
+                }
+            }
+            testIndex = index
+        }
+        return testIndex![testId] ?? []
+    }
+
+    /* Open the log for appending, creating it with a header or trimming a partial trailing record as needed. Returns nil if the file exists but is not a valid log and could not be moved aside. */
+    private func fileHandleForAppending() -> NSFileHandle? {
+        let manager = NSFileManager.defaultManager()
+        if manager.fileExistsAtPath(filePath) && mappedLog() == nil {
+            // the header is unrecognized and the file could not be moved aside: never truncate it
+            return nil
+        }
+        if !manager.fileExistsAtPath(filePath) {
+            let directory = (filePath as NSString).stringByDeletingLastPathComponent
+            do {
+                try manager.createDirectoryAtPath(directory, withIntermediateDirectories: true, attributes: nil)
+            } catch {
+                return nil
+            }
+            if !manager.createFileAtPath(filePath, contents: TestResultLog.encodeHeader(), attributes: nil) {
+                return nil
+            }
+            recordCount = 0
+        }
+        guard let handle = NSFileHandle(forUpdatingAtPath: filePath) else {
+            return nil
+        }
+        handle.truncateFileAtOffset(UInt64(TestResultLog.headerSize + recordCount * TestResultLog.recordSize))
+        return handle
+    }
+
+    // MARK: Encoding
+
+    private static func encodeHeader() -> NSData {
+        let data = NSMutableData(bytes: magic, length: magic.count)
+        var version = TestResultLog.version.littleEndian
+        var size = UInt16(recordSize).littleEndian
+        data.appendBytes(&version, length: 2)
+        data.appendBytes(&size, length: 2)
+        return data
+    }
+
+    private static func isValidHeader(data: NSData) -> Bool {
+        if data.length < headerSize {
+            return false
+        }
+        var bytes = [UInt8](count: headerSize, repeatedValue: 0)
+        data.getBytes(&bytes, length: headerSize)
+        let version = UInt16(bytes[4]) | UInt16(bytes[5]) << 8
+        let size = Int(UInt16(bytes[6]) | UInt16(bytes[7]) << 8)
+        return Array(bytes[0..<4]) == magic && version == TestResultLog.version && size == recordSize
+    }
+
+    private static func encodeRecord(timestamp timestamp: Double, testId: UInt16, succeeded: Bool) -> NSData {
+        let data = NSMutableData(capacity: recordSize)!
+        var bits = unsafeBitCast(timestamp, UInt64.self).littleEndian
+        var id = testId.littleEndian
+        var outcome: UInt8 = succeeded ? 1 : 0
+        var reserved8: UInt8 = 0
+        var reserved32: UInt32 = 0
+        data.appendBytes(&bits, length: 8)
+        data.appendBytes(&id, length: 2)
+        data.appendBytes(&outcome, length: 1)
+        data.appendBytes(&reserved8, length: 1)
+        data.appendBytes(&reserved32, length: 4)
+        return data
+    }
+
+    private static func timestampAt(index: Int, data: NSData) -> Double {
+        var bits: UInt64 = 0
+        data.getBytes(&bits, range: NSRange(location: headerSize + index * recordSize, length: 8))
+        return unsafeBitCast(UInt64(littleEndian: bits), Double.self)
+    }
+
+    private static func testIdAt(index: Int, data: NSData) -> UInt16 {
+        var id: UInt16 = 0
+        data.getBytes(&id, range: NSRange(location: headerSize + index * recordSize + 8, length: 2))
+        return UInt16(littleEndian: id)
+    }
+
+    private static func recordAt(index: Int, data: NSData) -> Record {
+        let testId = testIdAt(index, data: data)
+        var outcome: UInt8 = 0
+        data.getBytes(&outcome, range: NSRange(location: headerSize + index * recordSize + 10, length: 1))
+        let name = (testId > 0 && Int(testId) <= testIds.count) ? testIds[Int(testId) - 1] : ""
+        let date = NSDate(timeIntervalSinceReferenceDate: timestampAt(index, data: data))
+        return Record(testName: name, date: date, succeeded: outcome != 0)
+    }
+
+    /* Index of the first position in 0..<count for which isBefore is false. isBefore must be true for a prefix of the range. */
+    private static func lowerBound(count: Int, isBefore: (Int) -> Bool) -> Int {
+        var low = 0
+        var high = count
+        while low < high {
+            let mid = (low + high) / 2
+            if isBefore(mid) {
+                low = mid + 1
+            } else {
+                high = mid
+            }
+        }
+        return low
+    }
+}
@@ -91,14 +91,105 @@ struct Tracker {
 	}
 	
   /**
-    creates an event in the underlying analytics framework
+    a screen or control event, typed by the enums above. Hashable so its SDK payload is built once per distinct event
+  */
+  struct Event: Hashable {
+    let name: Name
+    let action: Action
+    let progress: Progress
+    
+    var hashValue: Int {
+      return name.hashValue ^ (action.hashValue << 8) ^ (progress.hashValue << 16)
+    }
+  }
+  
+  /**
+    an event waiting in the batch, with the time it happened
+  */
+  struct Record {
+    let event: Event
+    let time: NSTimeInterval
+  }
+  
+  /**
+    the interned SDK payload of an event: the sentence used as the Mixpanel event name and its properties
+  */
+  struct Payload {
+    let sentence: String
+    let properties: [String: AnyObject]
+  }
+  
+  // number of events that are handed to the SDK together
+  static let batchSize = 20
+  
+  // longest time an event waits in the batch, in seconds
+  static let batchDelay: NSTimeInterval = 2
+  
+  // payloads by event, built on first use. main thread only
+  private static var payloads = [Event: Payload]()
   
+  // events not yet handed to the SDK. main thread only
+  private static var pendingRecords = [Record]()
+  private static var flushScheduled = false
+  
+  // the SDK is called off the main thread, in order
+  private static let deliveryQueue = dispatch_queue_create("com.qidza.tracker", DISPATCH_QUEUE_SERIAL)
+  
+  // receives each batch on deliveryQueue. replaceable so tests and benchmarks do not send events
+  static var deliver: ([Payload], [NSTimeInterval]) -> Void = { payloads, times in
+    for (index, payload) in payloads.enumerate() {
+      var properties = payload.properties
+      // the event happened up to batchDelay earlier than it is tracked
+      properties["time"] = NSNumber(longLong: Int64(times[index]))
+      mixpanel.track(payload.sentence, properties: properties)
+    }
+  }
+  
+  /**
+    get the interned payload of an event, building it the first time the event is seen
+  */
+  static func payload(event: Event) -> Payload {
+    if let payload = payloads[event] {
+      return payload
+    }
+    let sentence = "\(event.name.rawValue) \(event.action.rawValue) in \(event.progress.rawValue)"
+    let payload = Payload(sentence: sentence, properties: ["name": event.name.rawValue, "action": event.action.rawValue, "progress": event.progress.rawValue])
+    payloads[event] = payload
+    return payload
+  }
+  
+  /**
+    creates an event in the underlying analytics framework
+    events are batched and handed to the SDK off the main thread, see flush()
   */
   static func createEvent(name:Name, _ action:Action, _ progress:Progress = .NA) {
-    let event = (name: name.rawValue, action: action.rawValue, progress: progress.rawValue)
-    let sentence = "\(event.name) \(event.action) in \(event.progress)"
-    
-    mixpanel.track(sentence, properties: ["name": event.name, "action": event.action, "progress": event.progress])
+    pendingRecords.append(Record(event: Event(name: name, action: action, progress: progress), time: NSDate().timeIntervalSince1970))
+    if pendingRecords.count >= batchSize {
+      flush()
+    } else if !flushScheduled {
+      flushScheduled = true
+      dispatch_after(dispatch_time(DISPATCH_TIME_NOW, Int64(batchDelay * Double(NSEC_PER_SEC))), dispatch_get_main_queue()) {
+        flush()
+      }
+    }
+  }
+  
+  /**
+    hand all pending events to the SDK. called when a batch fills, after batchDelay, and when the app leaves the foreground
+  */
+  static func flush() {
+    flushScheduled = false
+    if pendingRecords.isEmpty {
+      return
+    }
+    let records = pendingRecords
+    pendingRecords.removeAll(keepCapacity: true)
+    let batch = records.map { payload($0.event) }
+    let times = records.map { $0.time }
+    let deliver = self.deliver
+    dispatch_async(deliveryQueue) {
+      deliver(batch, times)
+    }
   }
 	
 	// allows us to track the number of times someone has shared as well as their share method
@@ -108,36 +199,50 @@ struct Tracker {
 	
 	// save the feedback rating, text, and whether or not they finished the submission (vs just canceling)
 	static func setFeedbackInfo(rating:Int, text:String, finishedSubmit:Bool) {
-		mixpanel.people.set([
+		let properties: [String: AnyObject] = [
 			"feedBackRating": rating,
 			"feedBackText": text,
 			"feedBackDidFinishSubmission": finishedSubmit
-		])
-    mixpanel.track("Feedback Dialog Data Entered", properties: ["feedBackRating": rating, "feedBackText": text, "feedBackDidFinishSubmission": finishedSubmit])
+		]
+		// keep the feedback event after the screen events that led to it
+		flush()
+		dispatch_async(deliveryQueue) {
+			mixpanel.people.set(properties)
+			mixpanel.track("Feedback Dialog Data Entered", properties: properties)
+		}
 	}
   
-  static func registerUser(parentName parentName:String, parentEmail:String, babyName:String, babyDOB: NSDate, babyGender: String) {
+  // formatting a date is cheap; creating the formatter is not
+  private static let birthdayFormatter: NSDateFormatter = {
     let dateFormatter = NSDateFormatter()
     dateFormatter.dateStyle = .ShortStyle
-		
-		// set distinct id before saving any people properties
-		mixpanel.identify(mixpanel.distinctId)
+    return dateFormatter
+  }()
+  
+  static func registerUser(parentName parentName:String, parentEmail:String, babyName:String, babyDOB: NSDate, babyGender: String) {
+    // events tracked before registration keep the previous super properties
+    flush()
     
-    mixpanel.registerSuperProperties([
+    let superProperties: [String: AnyObject] = [
       "parentName": parentName,
       "parentEmail": parentEmail,
       "babyName": babyName,
-      "babyDOB": dateFormatter.stringFromDate(babyDOB),
+      "babyDOB": birthdayFormatter.stringFromDate(babyDOB),
       "babyGender": babyGender
-    ]);
+    ]
+    var peopleProperties = superProperties
+    peopleProperties["numShares"] = 0
 		
-		mixpanel.people.set([
-      "parentName": parentName,
-      "parentEmail": parentEmail,
-      "babyName": babyName,
-      "babyDOB": dateFormatter.stringFromDate(babyDOB),
-      "babyGender": babyGender,
-			"numShares": 0
-		])
+    dispatch_async(deliveryQueue) {
+      // set distinct id before saving any people properties
+      mixpanel.identify(mixpanel.distinctId)
+      
+      mixpanel.registerSuperProperties(superProperties)
+      mixpanel.people.set(peopleProperties)
+    }
   }
 }
+
+func ==(lhs: Tracker.Event, rhs: Tracker.Event) -> Bool {
+  return lhs.name == rhs.name && lhs.action == rhs.action && lhs.progress == rhs.progress
+}
@@ -11,7 +11,6 @@ import UIKit
 class UnassistedSittingWhatDidYouSeeViewController: UIViewController {
 
     var parent = Parent()
-    var profiles = TestProfiles()
     var test = Test()
     
     override func viewDidLoad() {
@@ -23,11 +22,8 @@ class UnassistedSittingWhatDidYouSeeViewController: UIViewController {
         // Ensure current information for parent by reloading.
         parent = Parent()
         
-        // Ensure current information for test profiles by reloading.
-        profiles.initProfilesFromPersistentStore()
-        
         // Get the test information.
-        test = profiles.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.unassistedSitting)
+        test = ProfileStore.sharedStore.getTest(parent.getCurrentProfileName(), testName: Test.TestNames.unassistedSitting)
     }
 
     override func didReceiveMemoryWarning() {
@@ -40,14 +36,12 @@ class UnassistedSittingWhatDidYouSeeViewController: UIViewController {
         if segue.identifier == "UnassistedSittingGoodOutcomeSegueID" {
             
             // Record the successful symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: true)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: true)
             
         } else if segue.identifier == "UnassistedSittingBadOutcomeSegueID" || segue.identifier == "UnassistedSittingBadOutcomeSegueID2" {
             
             // Record the failed symmetry test result and save it to the persistent store on disk.
-            test.addTestResult(testResult: false)
-            profiles.save()
+            ProfileStore.sharedStore.addTestResult(test, testResult: false)
             
             // Pass the test results history to the destination VC.
             let controller = segue.destinationViewController as! UnassistedSittingBadOutcomeViewController
@@ -1,47 +0,0 @@
-//
-//  WhyIsHearingViewController.swift
-//  questionApp
-//
-//  Created by john bateman on 7/15/15.
-//  Copyright (c) 2015 codeHatcher. All rights reserved.
-//
-
-import UIKit
-
-class WhyIsHearingViewController: UIViewController {
-
-    @IBOutlet weak var descriptionLabel: UILabel!
-    
-    override func viewDidLoad() {
-        super.viewDidLoad()
-      // analytics
-      Tracker.createEvent(.Hearing, .Load, .Why)
-        applyTextAttributesToLabel()
-    }
-    
-    override func didReceiveMemoryWarning() {
-        super.didReceiveMemoryWarning()
-        // Dispose of any resources that can be recreated.
-    }
-    
-    @IBAction func onBackButtonTap(sender: AnyObject) {
-        self.dismissViewControllerAnimated(true, completion: nil)
-    }
-    
-    // Helper function formats text attributes for multiple substrings in label.
-    func applyTextAttributesToLabel() {
-        
-        let string = "It's important to screen your baby's hearing. Catching hearing loss early can give a child a better chance of keeping up with other children in their age group."
-        
-        var attributedString = NSMutableAttributedString(string: string)
-        
-        let boldAttributes = [NSForegroundColorAttributeName: kGrey, NSFontAttributeName: UIFont(name: kOmnesFontSemiBold, size: 22)!]
-        let standardAttributes = [NSForegroundColorAttributeName: kGrey, NSFontAttributeName: UIFont(name: kOmnesFontMedium, size: 22)!]
-        
-        attributedString.addAttributes(boldAttributes, range: NSMakeRange(0, 44))
-        attributedString.addAttributes(standardAttributes, range: NSMakeRange(45, 115))
-        
-        descriptionLabel.attributedText = attributedString
-    }
-
-}
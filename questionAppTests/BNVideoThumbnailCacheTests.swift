@@ -0,0 +1,102 @@
+//
+//  BNVideoThumbnailCacheTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+
+class BNVideoThumbnailCacheTests: XCTestCase {
+
+    // A video bundled with the app.
+    let file = "crossing eyes"
+
+    var directory: String!
+
+    override func setUp() {
+        super.setUp()
+        directory = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent(NSUUID().UUIDString)
+    }
+
+    override func tearDown() {
+        _ = try? NSFileManager.defaultManager().removeItemAtPath(directory)
+        super.tearDown()
+    }
+
+    func makeCache() -> BNVideoThumbnailCache {
+        let cache = BNVideoThumbnailCache()
+        cache.directoryPath = directory
+        return cache
+    }
+
+    /* Requests a thumbnail and waits for it. */
+    func loadThumbnail(cache: BNVideoThumbnailCache, time: Int32) -> UIImage? {
+        var result: UIImage?
+        let expectation = expectationWithDescription("thumbnail")
+        cache.thumbnail(file: file, ext: "mp4", time: time) { image in
+            result = image
+            expectation.fulfill()
+        }
+        waitForExpectationsWithTimeout(10, handler: nil)
+        return result
+    }
+
+    func testKeysIncludeFileExtensionAndTime() {
+        let cache = makeCache()
+        let key = cache.cacheKey(file: file, ext: "mp4", time: 2)
+        XCTAssertNotEqual(key, cache.cacheKey(file: file, ext: "mp4", time: 3))
+        XCTAssertNotEqual(key, cache.cacheKey(file: file, ext: "mov", time: 2))
+        XCTAssertNotEqual(key, cache.cacheKey(file: "hearing", ext: "mp4", time: 2))
+    }
+
+    func testGeneratedThumbnailIsReadBackFromDisk() {
+        let image = loadThumbnail(makeCache(), time: 1)
+        XCTAssertNotNil(image)
+        XCTAssertTrue(image!.size.width <= BNVideoThumbnailCache.maximumSize.width)
+        let files = try! NSFileManager.defaultManager().contentsOfDirectoryAtPath(directory)
+        XCTAssertEqual(files.count, 1)
+
+        // replace the file on disk: a new cache (an app relaunch) must show it instead of generating the thumbnail again
+        UIGraphicsBeginImageContextWithOptions(CGSize(width: 3, height: 2), true, 1)
+        let marker = UIGraphicsGetImageFromCurrentImageContext()
+        UIGraphicsEndImageContext()
+        UIImageJPEGRepresentation(marker, 1)!.writeToFile((directory as NSString).stringByAppendingPathComponent(files[0]), atomically: true)
+
+        let cache = makeCache()
+        XCTAssertNil(cache.cachedThumbnail(file: file, ext: "mp4", time: 1))
+        XCTAssertEqual(loadThumbnail(cache, time: 1)?.size, CGSize(width: 3, height: 2))
+        XCTAssertNotNil(cache.cachedThumbnail(file: file, ext: "mp4", time: 1))
+    }
+
+    func testConcurrentRequestsAreCoalesced() {
+        let cache = makeCache()
+        var images = [UIImage?]()
+        let expectation = expectationWithDescription("both thumbnails")
+        for _ in 0..<2 {
+            cache.thumbnail(file: file, ext: "mp4", time: 1) { image in
+                images.append(image)
+                if images.count == 2 {
+                    expectation.fulfill()
+                }
+            }
+        }
+        waitForExpectationsWithTimeout(10, handler: nil)
+
+        // one generation served both requests
+        XCTAssertNotNil(images[0])
+        XCTAssertTrue(images[0] === images[1])
+    }
+
+    func testMissingVideoHasNoThumbnail() {
+        let cache = makeCache()
+        let expectation = expectationWithDescription("thumbnail")
+        cache.thumbnail(file: "no such video", ext: "mp4", time: 1) { image in
+            XCTAssertNil(image)
+            expectation.fulfill()
+        }
+        waitForExpectationsWithTimeout(10, handler: nil)
+    }
+}
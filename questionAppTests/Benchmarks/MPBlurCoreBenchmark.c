@@ -0,0 +1,100 @@
+//
+//  MPBlurCoreBenchmark.c
+//  questionAppTests
+//
+//  Standalone benchmark for the portable blur kernels in MPBlurCore. It has no
+//  Apple dependencies and runs anywhere with a C99 compiler:
+//
+//    cc -std=c99 -O2 -I../../questionApp/Mixpanel MPBlurCoreBenchmark.c ../../questionApp/Mixpanel/MPBlurCore.c -lm -o blurbench
+//    ./blurbench
+//
+//  For each image size and radius it times the full resolution blur against
+//  downsample-then-blur. mp_applyBlurWithRadius: downsamples by drawing into a
+//  smaller CGBitmapContext; mp_blur_downsample stands in for that step here, so
+//  the downsample share of the timings is only an approximation of the app's.
+//
+
+// clock_gettime and CLOCK_MONOTONIC are POSIX, not C99.
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "MPBlurCore.h"
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1.0e6;
+}
+
+static void fill_noise(mp_blur_image *image, unsigned seed)
+{
+    srand(seed);
+    for (size_t y = 0; y < image->height; y++) {
+        uint8_t *row = image->data + y * image->rowBytes;
+        for (size_t x = 0; x < image->width * 4; x++) {
+            row[x] = (uint8_t)(rand() & 0xff);
+        }
+    }
+}
+
+int main(void)
+{
+    // Point sizes of the screens we snapshot, at 2x.
+    const size_t sizes[][2] = { { 640, 960 }, { 640, 1136 }, { 750, 1334 }, { 1536, 2048 } };
+    const double radii[] = { 10.0, 20.0, 30.0 };
+    const int iterations = 5;
+    const int32_t divisor = 256;
+    int16_t saturation[16];
+    mp_blur_saturation_matrix(1.8, saturation, divisor);
+
+    mp_blur_pool *pool = mp_blur_pool_create();
+    printf("%-11s %6s %4s %6s %12s %12s %8s\n", "size", "radius", "box", "factor", "full (ms)", "pipeline (ms)", "speedup");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t width = sizes[s][0], height = sizes[s][1];
+        mp_blur_image source = { malloc(width * height * 4), width, height, width * 4 };
+        mp_blur_image work = { malloc(width * height * 4), width, height, width * 4 };
+        fill_noise(&source, (unsigned)s);
+
+        for (size_t r = 0; r < sizeof(radii) / sizeof(radii[0]); r++) {
+            // The effects ask for the radius in points, the kernels work in pixels.
+            uint32_t boxSize = mp_blur_box_size_for_radius(radii[r] * 2.0);
+            size_t factor = mp_blur_downsample_factor(boxSize);
+
+            double start = now_ms();
+            for (int i = 0; i < iterations; i++) {
+                memcpy(work.data, source.data, width * height * 4);
+                mp_blur_box3(&work, boxSize, pool);
+                mp_blur_color_matrix(&work, saturation, divisor);
+            }
+            double full = (now_ms() - start) / iterations;
+
+            size_t smallWidth = (width + factor - 1) / factor;
+            size_t smallHeight = (height + factor - 1) / factor;
+            mp_blur_image small = { mp_blur_pool_buffer(pool, MP_BLUR_POOL_SOURCE, smallWidth * smallHeight * 4), smallWidth, smallHeight, smallWidth * 4 };
+            uint32_t smallBoxSize = mp_blur_box_size_for_radius(radii[r] * 2.0 / factor);
+
+            start = now_ms();
+            for (int i = 0; i < iterations; i++) {
+                mp_blur_downsample(&source, &small, factor);
+                mp_blur_box3(&small, smallBoxSize, pool);
+                mp_blur_color_matrix(&small, saturation, divisor);
+            }
+            double pipeline = (now_ms() - start) / iterations;
+
+            char label[32];
+            snprintf(label, sizeof(label), "%zux%zu", width, height);
+            printf("%-11s %6.0f %4u %6zu %12.2f %12.2f %7.1fx\n", label, radii[r], boxSize, factor, full, pipeline, full / pipeline);
+        }
+
+        free(source.data);
+        free(work.data);
+    }
+
+    mp_blur_pool_destroy(pool);
+    return 0;
+}
@@ -0,0 +1,147 @@
+//
+//  ChartAnimatorTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class ChartAnimatorTests: XCTestCase {
+
+    /* Collects the dropped frames an animator reports. */
+    class DroppedFramesRecorder: NSObject, ChartAnimatorDelegate {
+        var reports = [Int]()
+
+        func chartAnimatorUpdated(chartAnimator: ChartAnimator) {}
+        func chartAnimatorStopped(chartAnimator: ChartAnimator) {}
+
+        func chartAnimator(chartAnimator: ChartAnimator, droppedFrames count: Int) {
+            reports.append(count)
+        }
+    }
+
+    func makeLineChart(count: Int) -> LineChartView {
+        var entries = [ChartDataEntry]()
+        var xVals = [String?]()
+        for i in 0..<count {
+            entries.append(ChartDataEntry(value: sin(Double(i) / 50) * 100 + 120, xIndex: i))
+            xVals.append("\(i)")
+        }
+
+        let dataSet = LineChartDataSet(yVals: entries, label: "Score")
+        dataSet.drawCirclesEnabled = false
+        dataSet.drawValuesEnabled = false
+
+        let chart = LineChartView(frame: CGRect(x: 0, y: 0, width: 640, height: 480))
+        chart.data = LineChartData(xVals: xVals, dataSets: [dataSet])
+        return chart
+    }
+
+    func testInterpolationMatchesTransformAtPhase() {
+        let chart = makeLineChart(100)
+        let trans = chart.getTransformer(.Left)
+        let values = (0..<100).map { CGPoint(x: CGFloat($0), y: CGFloat(sin(Double($0)) * 50)) }
+
+        var start = values, end = values
+        trans.pointValuesToPixel(&start, count: values.count, phaseY: 0.0)
+        trans.pointValuesToPixel(&end, count: values.count, phaseY: 1.0)
+
+        for phase: CGFloat in [0.0, 0.25, 0.5, 0.9, 1.0] {
+            var expected = values
+            trans.pointValuesToPixel(&expected, count: values.count, phaseY: phase)
+
+            var interpolated = [CGPoint](count: values.count, repeatedValue: CGPoint())
+            ChartTransformer.interpolatePoints(start, to: end, t: phase, result: &interpolated, count: values.count)
+
+            for i in 0..<values.count {
+                XCTAssertEqualWithAccuracy(interpolated[i].x, expected[i].x, accuracy: 0.001)
+                XCTAssertEqualWithAccuracy(interpolated[i].y, expected[i].y, accuracy: 0.001)
+            }
+        }
+    }
+
+    func testPacingSlowsDownOnDroppedFramesAndRecovers() {
+        let animator = ChartAnimator()
+        let recorder = DroppedFramesRecorder()
+        animator.delegate = recorder
+        let refresh = 1.0 / 60.0
+
+        var time = 1.0
+        animator.paceFrame(timestamp: time, refreshDuration: refresh)
+        time += refresh
+        animator.paceFrame(timestamp: time, refreshDuration: refresh)
+        XCTAssertEqual(animator.droppedFrameCount, 0)
+
+        // a step that took three refreshes dropped two frames
+        time += refresh * 3
+        animator.paceFrame(timestamp: time, refreshDuration: refresh)
+        XCTAssertEqual(animator.droppedFrameCount, 2)
+        XCTAssertEqual(recorder.reports, [2])
+        XCTAssertEqual(animator.frameInterval, 2)
+
+        // on time at the slower rate for a while, then back to every refresh
+        for _ in 0..<ChartAnimator.recoveryFrames {
+            time += refresh * 2
+            animator.paceFrame(timestamp: time, refreshDuration: refresh)
+        }
+        XCTAssertEqual(animator.frameInterval, 1)
+        XCTAssertEqual(animator.droppedFrameCount, 2)
+
+        // never slower than the maximum interval
+        for _ in 0..<10 {
+            time += refresh * Double(animator.frameInterval + 2)
+            animator.paceFrame(timestamp: time, refreshDuration: refresh)
+        }
+        XCTAssertEqual(animator.frameInterval, animator.maximumFrameInterval)
+    }
+
+    func testPacingOnlyWhileAnimating() {
+        let chart = makeLineChart(10)
+        chart.animator.pacedAnimationEnabled = true
+        XCTAssertFalse(chart.animator.isPacing)
+
+        chart.animate(yAxisDuration: 10)
+        XCTAssertTrue(chart.animator.isPacing)
+
+        chart.animator.stop()
+        XCTAssertFalse(chart.animator.isPacing)
+    }
+
+    // MARK: Frame time of a y-axis animation of a long line: transforming every entry each frame, or interpolating paced frames.
+
+    static let frameCount = 30
+    static let entryCount = 20000
+
+    /* Draws the data layer of every frame of the animation. */
+    func drawAnimationFrames(chart: LineChartView, paced: Bool) {
+        chart.animator.pacedAnimationEnabled = paced
+        chart.animate(yAxisDuration: 60)
+
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        chart.drawRect(chart.bounds)
+        for frame in 0..<ChartAnimatorTests.frameCount {
+            chart.animator.phaseY = CGFloat(frame + 1) / CGFloat(ChartAnimatorTests.frameCount)
+            chart.renderer!.drawData(context: UIGraphicsGetCurrentContext())
+        }
+        UIGraphicsEndImageContext()
+
+        chart.animator.stop()
+    }
+
+    func testPerformanceAnimationTransformed() {
+        let chart = makeLineChart(ChartAnimatorTests.entryCount)
+        self.measureBlock() {
+            self.drawAnimationFrames(chart, paced: false)
+        }
+    }
+
+    func testPerformanceAnimationPaced() {
+        let chart = makeLineChart(ChartAnimatorTests.entryCount)
+        self.measureBlock() {
+            self.drawAnimationFrames(chart, paced: true)
+        }
+    }
+}
@@ -0,0 +1,228 @@
+//
+//  ChartDataApproximatorTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class ChartDataApproximatorTests: XCTestCase {
+
+    static let columns = 640
+
+    func makeEntries(count: Int) -> [ChartDataEntry] {
+        var entries = [ChartDataEntry]()
+        entries.reserveCapacity(count)
+        for i in 0..<count {
+            entries.append(ChartDataEntry(value: sin(Double(i) / 1000) * 100 + Double(arc4random_uniform(1000)) / 100, xIndex: i))
+        }
+        return entries
+    }
+
+    func assertAscending(indices: [Int]) {
+        for k in 1..<indices.count {
+            XCTAssertLessThan(indices[k - 1], indices[k])
+        }
+    }
+
+    func testMinMaxPerPixelKeepsAtMostFourEntriesPerColumn() {
+        let entries = makeEntries(1_000_000)
+        let filter = ChartDataApproximatorFilter(type: .MinMaxPerPixel, tolerance: 0)
+        guard let indices = filter.reducedIndices(entries, from: 0, to: entries.count, columns: ChartDataApproximatorTests.columns) else {
+            XCTFail("a million entries should be reduced")
+            return
+        }
+
+        XCTAssertLessThanOrEqual(indices.count, 4 * ChartDataApproximatorTests.columns)
+        XCTAssertEqual(indices.first, 0)
+        XCTAssertEqual(indices.last, entries.count - 1)
+        assertAscending(indices)
+
+        // the extremes always survive
+        let values = entries.map { $0.value }
+        XCTAssertEqual(indices.map { values[$0] }.minElement(), values.minElement())
+        XCTAssertEqual(indices.map { values[$0] }.maxElement(), values.maxElement())
+    }
+
+    func testLargestTriangleThreeBucketsKeepsOneEntryPerBucket() {
+        let entries = makeEntries(100_000)
+        let filter = ChartDataApproximatorFilter(type: .LargestTriangleThreeBuckets, tolerance: 0)
+        let indices = filter.reducedIndices(entries, from: 1000, to: 90_000, columns: ChartDataApproximatorTests.columns)!
+
+        XCTAssertEqual(indices.count, ChartDataApproximatorTests.columns)
+        XCTAssertEqual(indices.first, 1000)
+        XCTAssertEqual(indices.last, 90_000 - 1)
+        assertAscending(indices)
+    }
+
+    func testSmallRangesAreNotReduced() {
+        let entries = makeEntries(1000)
+        let filter = ChartDataApproximatorFilter(type: .MinMaxPerPixel, tolerance: 0)
+        XCTAssertNil(filter.reducedIndices(entries, from: 0, to: entries.count, columns: ChartDataApproximatorTests.columns))
+
+        filter.type = .RamerDouglasPeucker
+        XCTAssertNil(filter.reducedIndices(entries, from: 0, to: entries.count, columns: 100))
+    }
+
+    func testReductionIsCachedUntilInvalidated() {
+        let entries = makeEntries(10_000)
+        let filter = ChartDataApproximatorFilter(type: .MinMaxPerPixel, tolerance: 0)
+        let before = filter.reducedIndices(entries, from: 0, to: entries.count, columns: 100)!
+
+        // a changed value is not seen until the DataSet is notified
+        let top = entries.count / 2
+        entries[top].value = 1_000_000
+        XCTAssertEqual(filter.reducedIndices(entries, from: 0, to: entries.count, columns: 100)!, before)
+        filter.invalidate()
+        XCTAssertTrue(filter.reducedIndices(entries, from: 0, to: entries.count, columns: 100)!.contains(top))
+    }
+
+    // MARK: Douglas-Peucker.
+    // LegacyDouglasPeucker is the recursive implementation the filter had before it went iterative.
+
+    class LegacyDouglasPeucker {
+        let deltaRatio: Double
+        let scaleRatio: Double
+
+        init(deltaRatio: Double, scaleRatio: Double) {
+            self.deltaRatio = deltaRatio
+            self.scaleRatio = scaleRatio
+        }
+
+        func reduce(entries: [ChartDataEntry], epsilon: Double) -> [ChartDataEntry] {
+            if epsilon <= 0 || entries.count < 3 {
+                return entries
+            }
+            var keep = [Bool](count: entries.count, repeatedValue: false)
+            keep[0] = true
+            keep[entries.count - 1] = true
+            algorithm(entries, epsilon: epsilon, start: 0, end: entries.count - 1, keep: &keep)
+
+            var reduced = [ChartDataEntry]()
+            for i in 0..<entries.count where keep[i] {
+                reduced.append(ChartDataEntry(value: entries[i].value, xIndex: entries[i].xIndex))
+            }
+            return reduced
+        }
+
+        func algorithm(entries: [ChartDataEntry], epsilon: Double, start: Int, end: Int, inout keep: [Bool]) {
+            if end <= start + 1 {
+                return
+            }
+            var maxDistIndex = 0
+            var distMax = 0.0
+            for i in (start + 1)..<end {
+                let dist = fabs(angle(entries[start], entries[end]) - angle(entries[start], entries[i]))
+                if dist > distMax {
+                    distMax = dist
+                    maxDistIndex = i
+                }
+            }
+            if distMax > epsilon {
+                keep[maxDistIndex] = true
+                algorithm(entries, epsilon: epsilon, start: start, end: maxDistIndex, keep: &keep)
+                algorithm(entries, epsilon: epsilon, start: maxDistIndex, end: end, keep: &keep)
+            }
+        }
+
+        func angle(p1: ChartDataEntry, _ p2: ChartDataEntry) -> Double {
+            let dx = Double(p2.xIndex) * deltaRatio - Double(p1.xIndex) * deltaRatio
+            let dy = p2.value * scaleRatio - p1.value * scaleRatio
+            return atan2(dy, dx) * ChartUtils.Math.RAD2DEG
+        }
+    }
+
+    /* A random walk with occasional spikes and flat runs, the shapes Douglas-Peucker treats differently. */
+    func makeWalk(count: Int) -> [ChartDataEntry] {
+        var entries = [ChartDataEntry]()
+        entries.reserveCapacity(count)
+        var value = 0.0
+        for i in 0..<count {
+            switch arc4random_uniform(20) {
+            case 0:
+                value += Double(arc4random_uniform(200)) - 100
+            case 1, 2:
+                break
+            default:
+                value += Double(arc4random_uniform(200)) / 100 - 1
+            }
+            entries.append(ChartDataEntry(value: value, xIndex: i * 2))
+        }
+        return entries
+    }
+
+    func assertMatchesLegacy(entries: [ChartDataEntry], epsilon: Double, deltaRatio: Double = 1, scaleRatio: Double = 1, parallelThreshold: Int = Int.max) {
+        let filter = ChartDataApproximatorFilter(type: .RamerDouglasPeucker, tolerance: epsilon)
+        filter.setRatios(deltaRatio, scaleRatio: scaleRatio)
+        filter.parallelThreshold = parallelThreshold
+        let legacy = LegacyDouglasPeucker(deltaRatio: deltaRatio, scaleRatio: scaleRatio).reduce(entries, epsilon: epsilon)
+
+        let reduced = filter.filter(entries)
+        XCTAssertEqual(reduced.map { $0.xIndex }, legacy.map { $0.xIndex })
+        XCTAssertEqual(reduced.map { $0.value }, legacy.map { $0.value })
+        XCTAssertEqual(filter.douglasPeuckerIndices(entries, epsilon: epsilon).map { entries[$0].xIndex }, legacy.map { $0.xIndex })
+    }
+
+    func testDouglasPeuckerMatchesLegacyOutput() {
+        let walk = makeWalk(20_000)
+        for epsilon in [0.5, 2, 10, 45] {
+            assertMatchesLegacy(walk, epsilon: epsilon)
+        }
+        assertMatchesLegacy(walk, epsilon: 5, deltaRatio: 0.25, scaleRatio: 3)
+        assertMatchesLegacy(makeEntries(20_000), epsilon: 1)
+        assertMatchesLegacy(Array(walk[0..<3]), epsilon: 1)
+    }
+
+    func testParallelDouglasPeuckerMatchesLegacyOutput() {
+        let walk = makeWalk(50_000)
+        assertMatchesLegacy(walk, epsilon: 1, parallelThreshold: 1000)
+        assertMatchesLegacy(walk, epsilon: 20, parallelThreshold: 1000)
+    }
+
+    func testDouglasPeuckerKeepsOriginalEntries() {
+        let walk = makeWalk(1000)
+        let filter = ChartDataApproximatorFilter(type: .RamerDouglasPeucker, tolerance: 2)
+        for entry in filter.filter(walk) {
+            XCTAssertTrue(walk[entry.xIndex / 2] === entry)
+        }
+    }
+
+    func testPerformanceDouglasPeucker1M() {
+        let walk = makeWalk(1_000_000)
+        let filter = ChartDataApproximatorFilter(type: .RamerDouglasPeucker, tolerance: 1)
+        self.measureBlock() {
+            XCTAssertFalse(filter.douglasPeuckerIndices(walk, epsilon: 1).isEmpty)
+        }
+    }
+
+    func testPerformanceLegacyDouglasPeucker1M() {
+        let walk = makeWalk(1_000_000)
+        let legacy = LegacyDouglasPeucker(deltaRatio: 1, scaleRatio: 1)
+        self.measureBlock() {
+            XCTAssertFalse(legacy.reduce(walk, epsilon: 1).isEmpty)
+        }
+    }
+
+    // MARK: Pixel based reduction cost for a million entries, done once per zoom or pan.
+
+    func testPerformanceMinMaxPerPixel1M() {
+        let entries = makeEntries(1_000_000)
+        let filter = ChartDataApproximatorFilter(type: .MinMaxPerPixel, tolerance: 0)
+        self.measureBlock() {
+            filter.invalidate()
+            XCTAssertNotNil(filter.reducedIndices(entries, from: 0, to: entries.count, columns: ChartDataApproximatorTests.columns))
+        }
+    }
+
+    func testPerformanceLargestTriangleThreeBuckets1M() {
+        let entries = makeEntries(1_000_000)
+        let filter = ChartDataApproximatorFilter(type: .LargestTriangleThreeBuckets, tolerance: 0)
+        self.measureBlock() {
+            filter.invalidate()
+            XCTAssertNotNil(filter.reducedIndices(entries, from: 0, to: entries.count, columns: ChartDataApproximatorTests.columns))
+        }
+    }
+}
@@ -0,0 +1,221 @@
+//
+//  ChartDataColumnsTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class ChartDataColumnsTests: XCTestCase {
+
+    func makeColumns(count: Int) -> (xIndices: [Int], values: [Double]) {
+        var xIndices = [Int]()
+        var values = [Double]()
+        xIndices.reserveCapacity(count)
+        values.reserveCapacity(count)
+        for i in 0..<count {
+            // every third x-index is missing
+            xIndices.append(i + i / 2)
+            values.append(sin(Double(i) / 100) * 50 + Double(arc4random_uniform(100)) / 10)
+        }
+        return (xIndices, values)
+    }
+
+    func makeEntries(columns: (xIndices: [Int], values: [Double])) -> [ChartDataEntry] {
+        var entries = [ChartDataEntry]()
+        entries.reserveCapacity(columns.xIndices.count)
+        for i in 0..<columns.xIndices.count {
+            entries.append(ChartDataEntry(value: columns.values[i], xIndex: columns.xIndices[i]))
+        }
+        return entries
+    }
+
+    func testColumnarDataSetMatchesObjectDataSet() {
+        let columns = makeColumns(5000)
+        let columnar = LineChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+        let objects = LineChartDataSet(yVals: makeEntries(columns), label: nil)
+
+        XCTAssertTrue(columnar.isColumnar)
+        XCTAssertEqual(columnar.entryCount, objects.entryCount)
+        XCTAssertEqual(columnar.yMin, objects.yMin)
+        XCTAssertEqual(columnar.yMax, objects.yMax)
+        XCTAssertEqualWithAccuracy(columnar.yValueSum, objects.yValueSum, accuracy: 0.0001)
+
+        for x in [-1, 0, 1, 2, 3, 700, 4000, 7497, 7498, 9000] {
+            XCTAssertEqual(columnar.entryIndex(xIndex: x), objects.entryIndex(xIndex: x))
+            let columnarValue = columnar.yValForXIndex(x), objectValue = objects.yValForXIndex(x)
+            XCTAssertTrue(columnarValue == objectValue || (columnarValue.isNaN && objectValue.isNaN))
+            if let entry = columnar.entryForXIndex(x) {
+                XCTAssertTrue(entry.isEqual(objects.entryForXIndex(x)))
+                XCTAssertEqual(columnar.entryIndex(entry: entry, isEqual: true), objects.entryIndex(entry: entry, isEqual: true))
+            }
+        }
+
+        columnar.calcMinMax(start: 100, end: 200)
+        objects.calcMinMax(start: 100, end: 200)
+        XCTAssertEqual(columnar.yMin, objects.yMin)
+        XCTAssertEqual(columnar.yMax, objects.yMax)
+
+        // none of the above needed entry objects
+        XCTAssertTrue(columnar.isColumnar)
+    }
+
+    func testColumnarDataSetMutations() {
+        let columns = makeColumns(100)
+        let dataSet = LineChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+
+        dataSet.addEntry(ChartDataEntry(value: 1000, xIndex: 500))
+        XCTAssertTrue(dataSet.isColumnar)
+        XCTAssertEqual(dataSet.entryCount, 101)
+        XCTAssertEqual(dataSet.yMax, 1000)
+
+        XCTAssertTrue(dataSet.removeEntry(xIndex: 500))
+        XCTAssertEqual(dataSet.entryCount, 100)
+        XCTAssertEqual(dataSet.yMax, columns.values.maxElement())
+
+        // entries with data need objects
+        dataSet.addEntry(ChartDataEntry(value: 1, xIndex: 501, data: "note"))
+        XCTAssertFalse(dataSet.isColumnar)
+        XCTAssertEqual(dataSet.yVals.count, 101)
+        XCTAssertEqual(dataSet.yVals.map { $0.xIndex }, columns.xIndices + [501])
+    }
+
+    func testReadingEntriesMaterializesOnce() {
+        let columns = makeColumns(10)
+        let dataSet = ChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+        let entries = dataSet.yVals
+        XCTAssertFalse(dataSet.isColumnar)
+        XCTAssertTrue(dataSet.yVals[3] === entries[3])
+        XCTAssertEqual(entries.map { $0.value }, columns.values)
+    }
+
+    func testColumnarBarAndCandleDataSets() {
+        let columns = makeColumns(100)
+
+        let bars = BarChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+        XCTAssertTrue(bars.isColumnar)
+        XCTAssertFalse(bars.isStacked)
+        XCTAssertEqual(bars.entryCountStacks, 100)
+        XCTAssertEqual(bars.yMax, columns.values.maxElement())
+        XCTAssertTrue(bars.entryForXIndex(columns.xIndices[5]) is BarChartDataEntry)
+
+        // stacked bars need objects, and the materialized entries are bar entries
+        bars.addEntry(BarChartDataEntry(values: [1, 2], xIndex: 1000))
+        XCTAssertFalse(bars.isColumnar)
+        XCTAssertEqual(bars.yVals.filter { !($0 is BarChartDataEntry) }.count, 0)
+
+        let candles = CandleChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+        XCTAssertTrue(candles.isColumnar)
+        XCTAssertEqual(candles.yMin, columns.values.minElement())
+        XCTAssertEqual(candles.yMax, columns.values.maxElement())
+        let candle = candles.entryForXIndex(columns.xIndices[5]) as! CandleChartDataEntry
+        XCTAssertEqual(candle.high, columns.values[5])
+        XCTAssertEqual(candle.low, columns.values[5])
+
+        // a candle with a range needs objects, and min/max follow its low and high
+        candles.addEntry(CandleChartDataEntry(xIndex: 1000, shadowH: 900, shadowL: -900, open: 0, close: 1))
+        XCTAssertFalse(candles.isColumnar)
+        XCTAssertEqual(candles.yMax, 900)
+        XCTAssertEqual(candles.yMin, -900)
+        XCTAssertEqual(candles.yVals.filter { !($0 is CandleChartDataEntry) }.count, 0)
+    }
+
+    func testColumnarBarAndCandleChartsDraw() {
+        let columns = makeColumns(100)
+        var xVals = [String?]()
+        for i in 0...columns.xIndices.last! {
+            xVals.append("\(i)")
+        }
+
+        let barChart = BarChartView(frame: CGRect(x: 0, y: 0, width: 320, height: 240))
+        barChart.data = BarChartData(xVals: xVals, dataSets: [BarChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)])
+
+        let candleChart = CandleStickChartView(frame: CGRect(x: 0, y: 0, width: 320, height: 240))
+        candleChart.data = CandleChartData(xVals: xVals, dataSets: [CandleChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)])
+
+        for chart in [barChart, candleChart] as [BarLineChartViewBase] {
+            chart.highlightValue(xIndex: columns.xIndices[5], dataSetIndex: 0, callDelegate: false)
+            UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+            chart.drawRect(chart.bounds)
+            XCTAssertNotNil(UIGraphicsGetImageFromCurrentImageContext())
+            UIGraphicsEndImageContext()
+        }
+    }
+
+    // MARK: Memory and scan speed, against the object per point layout.
+
+    static let benchmarkCount = 1_000_000
+
+    /* Resident memory of the test process, in bytes. */
+    func residentMemory() -> UInt64 {
+        var info = mach_task_basic_info()
+        var count = mach_msg_type_number_t(sizeofValue(info) / sizeof(integer_t))
+        let result = withUnsafeMutablePointer(&info) {
+            task_info(mach_task_self_, task_flavor_t(MACH_TASK_BASIC_INFO), task_info_t($0), &count)
+        }
+        return result == KERN_SUCCESS ? UInt64(info.resident_size) : 0
+    }
+
+    /* Growth of resident memory since before, in bytes. */
+    func residentMemoryGrowth(since before: UInt64) -> UInt64 {
+        let now = residentMemory()
+        return now > before ? now - before : 0
+    }
+
+    func testMemoryColumnarVersusObjects() {
+        let columns = makeColumns(ChartDataColumnsTests.benchmarkCount)
+
+        var before = residentMemory()
+        let columnar = LineChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+        let columnarMemory = residentMemoryGrowth(since: before)
+
+        before = residentMemory()
+        let objects = LineChartDataSet(yVals: makeEntries(columns), label: nil)
+        let objectMemory = residentMemoryGrowth(since: before)
+
+        XCTAssertEqual(columnar.entryCount, objects.entryCount)
+        // Resident memory deltas are too noisy to assert on; the numbers are reported for comparison between runs.
+        NSLog("ChartDataColumnsTests: \(ChartDataColumnsTests.benchmarkCount) entries: columnar \(columnarMemory / 1024) KB, objects \(objectMemory / 1024) KB")
+    }
+
+    /* notifyDataSetChanged rescans every value for the sum and the min/max index. */
+    func testPerformanceRescanColumnar() {
+        let columns = makeColumns(ChartDataColumnsTests.benchmarkCount)
+        let dataSet = LineChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+        self.measureBlock() {
+            dataSet.notifyDataSetChanged()
+        }
+    }
+
+    func testPerformanceRescanObjects() {
+        let dataSet = LineChartDataSet(yVals: makeEntries(makeColumns(ChartDataColumnsTests.benchmarkCount)), label: nil)
+        self.measureBlock() {
+            dataSet.notifyDataSetChanged()
+        }
+    }
+
+    /* The lookups a frame of a zoomed line chart makes to find its visible range. */
+    func testPerformanceVisibleRangeLookupColumnar() {
+        let columns = makeColumns(ChartDataColumnsTests.benchmarkCount)
+        let dataSet = LineChartDataSet(xIndices: columns.xIndices, values: columns.values, label: nil)
+        self.measureBlock() {
+            for x in 0..<100 {
+                let entry = dataSet.entryForXIndex(x * 10_000)!
+                XCTAssertGreaterThanOrEqual(dataSet.entryIndex(entry: entry, isEqual: true), 0)
+            }
+        }
+    }
+
+    func testPerformanceVisibleRangeLookupObjects() {
+        let dataSet = LineChartDataSet(yVals: makeEntries(makeColumns(ChartDataColumnsTests.benchmarkCount)), label: nil)
+        self.measureBlock() {
+            for x in 0..<100 {
+                let entry = dataSet.entryForXIndex(x * 10_000)!
+                XCTAssertGreaterThanOrEqual(dataSet.entryIndex(entry: entry, isEqual: true), 0)
+            }
+        }
+    }
+}
@@ -0,0 +1,117 @@
+//
+//  ChartHighlighterTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class ChartHighlighterTests: XCTestCase {
+
+    /* Combined chart of lineCount lines, every other one on the right axis, and one bar DataSet. Lines 0 and 2 are equal, for ties. */
+    func makeCombinedChart(xCount: Int, lineCount: Int) -> CombinedChartView {
+        var xVals = [String?]()
+        for i in 0..<xCount {
+            xVals.append("\(i)")
+        }
+
+        var lineSets = [ChartDataSet]()
+        for l in 0..<lineCount {
+            var entries = [ChartDataEntry]()
+            for i in 0..<xCount where (i + l) % 7 != 0 {
+                entries.append(ChartDataEntry(value: sin(Double(i) / 10 + Double(l % 2 == 0 ? 0 : l)) * 50 + 60, xIndex: i))
+            }
+            let dataSet = LineChartDataSet(yVals: entries, label: "Line \(l)")
+            dataSet.axisDependency = l % 2 == 0 ? .Left : .Right
+            lineSets.append(dataSet)
+        }
+
+        var bars = [BarChartDataEntry]()
+        for i in 0..<xCount {
+            bars.append(BarChartDataEntry(value: Double(i % 13) * 8, xIndex: i))
+        }
+
+        let data = CombinedChartData(xVals: xVals)
+        data.lineData = LineChartData(xVals: xVals, dataSets: lineSets)
+        data.barData = BarChartData(xVals: xVals, dataSets: [BarChartDataSet(yVals: bars, label: "Bars")])
+
+        let chart = CombinedChartView(frame: CGRect(x: 0, y: 0, width: 640, height: 480))
+        chart.data = data
+        return chart
+    }
+
+    /* The DataSet index found by visiting every DataSet at the x-index. */
+    func scannedDataSetIndex(highlighter: ChartHighlighter, xIndex: Int, y: Double) -> Int {
+        let vals = highlighter.getSelectionDetailsAtIndex(xIndex)
+        let leftdist = ChartUtils.getMinimumDistance(vals, val: y, axis: .Left)
+        let rightdist = ChartUtils.getMinimumDistance(vals, val: y, axis: .Right)
+        return ChartUtils.closestDataSetIndex(vals, value: y, axis: leftdist < rightdist ? .Left : .Right)
+    }
+
+    func testIndexPicksTheSameDataSetAsTheScan() {
+        let chart = makeCombinedChart(60, lineCount: 5)
+        chart.zoom(1.5, scaleY: 1, x: 320, y: 240)
+        let highlighter = chart._highlighter!
+        let content = chart.viewPortHandler.contentRect
+
+        for var x = content.minX; x <= content.maxX; x += 3 {
+            let xIndex = highlighter.getXIndex(Double(x))
+            for var y = content.minY - 20; y <= content.maxY + 20; y += 2 {
+                XCTAssertEqual(highlighter.getDataSetIndex(xIndex: xIndex, x: Double(x), y: Double(y)),
+                    scannedDataSetIndex(highlighter, xIndex: xIndex, y: Double(y)), "x \(x), y \(y)")
+            }
+        }
+    }
+
+    func testIndexIsRebuiltForNewViewportOrData() {
+        let chart = makeCombinedChart(60, lineCount: 3)
+        let highlighter = chart._highlighter!
+
+        let index = highlighter.selectionIndex()
+        XCTAssertTrue(highlighter.selectionIndex() === index)
+
+        chart.zoom(2, scaleY: 1, x: 320, y: 240)
+        let zoomed = highlighter.selectionIndex()
+        XCTAssertFalse(zoomed === index)
+
+        chart.data!.getDataSetByIndex(0).yVals[10].value = 500
+        chart.notifyDataSetChanged()
+        XCTAssertFalse(highlighter.selectionIndex() === zoomed)
+    }
+
+    // MARK: Dragging across a dense combined chart: visiting every DataSet on each touch, or looking values up in the index.
+
+    static let touchCount = 2000
+
+    /* Finds the highlight of every touch of a drag across the content rect. */
+    func dragAcross(chart: CombinedChartView, indexed: Bool) {
+        let highlighter = chart._highlighter!
+        let content = chart.viewPortHandler.contentRect
+        for t in 0..<ChartHighlighterTests.touchCount {
+            let x = Double(content.minX + content.width * CGFloat(t) / CGFloat(ChartHighlighterTests.touchCount))
+            let y = Double(content.minY + content.height * CGFloat(t % 50) / 50)
+            if indexed {
+                highlighter.getHighlight(x: x, y: y)
+            } else {
+                scannedDataSetIndex(highlighter, xIndex: highlighter.getXIndex(x), y: y)
+            }
+        }
+    }
+
+    func testPerformanceDragScanned() {
+        let chart = makeCombinedChart(300, lineCount: 40)
+        self.measureBlock() {
+            self.dragAcross(chart, indexed: false)
+        }
+    }
+
+    func testPerformanceDragIndexed() {
+        let chart = makeCombinedChart(300, lineCount: 40)
+        self.measureBlock() {
+            self.dragAcross(chart, indexed: true)
+        }
+    }
+}
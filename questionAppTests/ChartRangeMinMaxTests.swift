@@ -0,0 +1,146 @@
+//
+//  ChartRangeMinMaxTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class ChartRangeMinMaxTests: XCTestCase {
+
+    func makeEntries(count: Int, from xIndex: Int = 0) -> [ChartDataEntry] {
+        var entries = [ChartDataEntry]()
+        entries.reserveCapacity(count)
+        for i in xIndex..<(xIndex + count) {
+            // a slow wave plus noise, with the occasional missing value
+            let value = i % 97 == 0 ? Double.NaN : sin(Double(i) / 500) * 100 + Double(arc4random_uniform(1000)) / 100
+            entries.append(ChartDataEntry(value: value, xIndex: i))
+        }
+        return entries
+    }
+
+    /* The rescan calcMinMax did before the range index, without NaN values. */
+    func linearMinMax(entries: [ChartDataEntry], start: Int, end: Int) -> (min: Double, max: Double) {
+        var yMin = DBL_MAX
+        var yMax = -DBL_MAX
+        for i in start...end where !entries[i].value.isNaN {
+            yMin = min(yMin, entries[i].value)
+            yMax = max(yMax, entries[i].value)
+        }
+        return yMin == DBL_MAX ? (0, 0) : (yMin, yMax)
+    }
+
+    func testRangeQueriesMatchLinearScan() {
+        let dataSet = ChartDataSet(yVals: makeEntries(1000), label: nil)
+        // appends after the index is built go through ChartRangeMinMax.append
+        for entry in makeEntries(537, from: 1000) {
+            dataSet.addEntry(entry)
+        }
+
+        for _ in 0..<500 {
+            let start = Int(arc4random_uniform(UInt32(dataSet.entryCount)))
+            let end = start + Int(arc4random_uniform(UInt32(dataSet.entryCount - start)))
+            dataSet.calcMinMax(start: start, end: end)
+            let expected = linearMinMax(dataSet.yVals, start: start, end: end)
+            XCTAssertEqual(dataSet.yMin, expected.min)
+            XCTAssertEqual(dataSet.yMax, expected.max)
+        }
+    }
+
+    func testIndexIsRebuiltAfterOutOfOrderInsertAndRemove() {
+        let dataSet = ChartDataSet(yVals: makeEntries(100, from: 10), label: nil)
+        dataSet.addEntryOrdered(ChartDataEntry(value: 1000, xIndex: 0))
+        dataSet.calcMinMax(start: 0, end: 5)
+        XCTAssertEqual(dataSet.yMax, 1000)
+
+        dataSet.removeEntry(xIndex: 0)
+        dataSet.calcMinMax(start: 0, end: 5)
+        XCTAssertEqual(dataSet.yMax, linearMinMax(dataSet.yVals, start: 0, end: 5).max)
+    }
+
+    func testStackedBarsUseStackSums() {
+        let dataSet = BarChartDataSet(yVals: [BarChartDataEntry(values: [2, -3, 4], xIndex: 0), BarChartDataEntry(value: 1, xIndex: 1)], label: nil)
+        XCTAssertEqual(dataSet.yMin, -3)
+        XCTAssertEqual(dataSet.yMax, 6)
+
+        dataSet.addEntry(BarChartDataEntry(values: [-5, 1], xIndex: 2))
+        XCTAssertEqual(dataSet.yMin, -5)
+        dataSet.calcMinMax(start: 1, end: 1)
+        XCTAssertEqual(dataSet.yMin, 1)
+        XCTAssertEqual(dataSet.yMax, 1)
+    }
+
+    func testAxesAreAggregatedPerDependency() {
+        let left = ChartDataSet(yVals: [ChartDataEntry(value: -2, xIndex: 0), ChartDataEntry(value: 3, xIndex: 1)], label: nil)
+        let right = ChartDataSet(yVals: [ChartDataEntry(value: 10, xIndex: 0), ChartDataEntry(value: 20, xIndex: 1)], label: nil)
+        right.axisDependency = .Right
+        let xVals: [String?] = ["a", "b"]
+        let data = ChartData(xVals: xVals, dataSets: [left, right])
+
+        XCTAssertEqual(data.getYMin(.Left), -2)
+        XCTAssertEqual(data.getYMax(.Left), 3)
+        XCTAssertEqual(data.getYMin(.Right), 10)
+        XCTAssertEqual(data.getYMax(.Right), 20)
+        XCTAssertEqual(data.yMin, -2)
+        XCTAssertEqual(data.yMax, 20)
+    }
+
+    func testNotifyDataChangedSeesEntriesEditedInPlace() {
+        let dataSet = ChartDataSet(yVals: makeEntries(100), label: nil)
+        let data = ChartData(xVals: [String?](count: 100, repeatedValue: nil), dataSets: [dataSet])
+
+        dataSet.yVals[40].value = 1000
+        dataSet.yVals[60].value = -1000
+        data.notifyDataChanged()
+
+        XCTAssertEqual(data.yMax, 1000)
+        XCTAssertEqual(data.yMin, -1000)
+        XCTAssertEqual(data.getYMax(.Left), 1000)
+        XCTAssertEqual(data.getYMin(.Left), -1000)
+    }
+
+    // MARK: Streaming benchmarks.
+    // A live chart appends one entry and then autoscales to the visible window, the last visibleCount entries.
+    // The rescan benchmarks repeat the linear loop calcMinMax ran before the range index.
+
+    static let visibleCount = 5000
+    static let appendsPerMeasurement = 100
+
+    /* Append entries to dataSet, querying the visible window after each append. */
+    func streamIncremental(dataSet: ChartDataSet, entries: [ChartDataEntry]) {
+        for entry in entries {
+            dataSet.addEntry(entry)
+            let end = dataSet.entryCount - 1
+            dataSet.calcMinMax(start: max(0, end - ChartRangeMinMaxTests.visibleCount), end: end)
+        }
+    }
+
+    func streamRescan(var values: [ChartDataEntry], entries: [ChartDataEntry], wholeSet: Bool) {
+        for entry in entries {
+            values.append(entry)
+            let end = values.count - 1
+            // notifyDataSetChanged rescanned every entry, a viewport change only the visible ones
+            linearMinMax(values, start: wholeSet ? 0 : max(0, end - ChartRangeMinMaxTests.visibleCount), end: end)
+        }
+    }
+
+    func testPerformanceStreamingIncremental100k() {
+        let initial = makeEntries(100_000)
+        let appended = makeEntries(ChartRangeMinMaxTests.appendsPerMeasurement, from: initial.count)
+        self.measureBlock() {
+            let dataSet = ChartDataSet(yVals: initial, label: nil)
+            self.streamIncremental(dataSet, entries: appended)
+        }
+    }
+
+    func testPerformanceStreamingRescan100k() {
+        let initial = makeEntries(100_000)
+        let appended = makeEntries(ChartRangeMinMaxTests.appendsPerMeasurement, from: initial.count)
+        self.measureBlock() {
+            self.streamRescan(initial, entries: appended, wholeSet: true)
+        }
+    }
+}
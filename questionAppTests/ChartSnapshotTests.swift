@@ -0,0 +1,165 @@
+//
+//  ChartSnapshotTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+@testable import Charts
+
+class ChartSnapshotTests: XCTestCase {
+
+    func makeLineChart(count: Int) -> LineChartView {
+        var entries = [ChartDataEntry]()
+        var xVals = [String?]()
+        for i in 0..<count {
+            entries.append(ChartDataEntry(value: sin(Double(i) / 20) * 100, xIndex: i))
+            xVals.append("Day \(i)")
+        }
+
+        let dataSet = LineChartDataSet(yVals: entries, label: "Score")
+        dataSet.drawCirclesEnabled = false
+        dataSet.drawFilledEnabled = true
+
+        let chart = LineChartView(frame: CGRect(x: 0, y: 0, width: 640, height: 480))
+        chart.contentScaleFactor = UIScreen.mainScreen().scale
+        chart.descriptionText = "Scores by day"
+        chart.data = LineChartData(xVals: xVals, dataSets: [dataSet])
+        return chart
+    }
+
+    /* The milestone chart parents share. */
+    func makePieChart() -> BNMilestonePieChartView {
+        let chart = BNMilestonePieChartView(frame: CGRect(x: 0, y: 0, width: 320, height: 320))
+        chart.contentScaleFactor = UIScreen.mainScreen().scale
+        chart.config(["Sitting", "", "Crawling", "", "Walking"], values: [1, 1, 1, 1, 1])
+        return chart
+    }
+
+    /* chart drawn by its view on the main thread, the way the snapshot renders it: screen scale, on white. */
+    func drawChart(chart: ChartViewBase) -> UIImage {
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, UIScreen.mainScreen().scale)
+        CGContextSetFillColorWithColor(UIGraphicsGetCurrentContext(), UIColor.whiteColor().CGColor)
+        CGContextFillRect(UIGraphicsGetCurrentContext(), chart.bounds)
+        chart.drawRect(chart.bounds)
+        let image = UIGraphicsGetImageFromCurrentImageContext()
+        UIGraphicsEndImageContext()
+        return image
+    }
+
+    /* Number of pixels of a and b that differ by more than tolerance in a channel. */
+    func differingPixels(a: UIImage, _ b: UIImage, tolerance: Int) -> Int {
+        let width = Int(a.size.width * a.scale), height = Int(a.size.height * a.scale)
+        var pixels = [[UInt8]]()
+        for image in [a, b] {
+            var buffer = [UInt8](count: width * height * 4, repeatedValue: 0)
+            let context = CGBitmapContextCreate(&buffer, width, height, 8, width * 4, CGColorSpaceCreateDeviceRGB(), CGImageAlphaInfo.PremultipliedLast.rawValue)
+            CGContextDrawImage(context, CGRect(x: 0, y: 0, width: width, height: height), image.CGImage)
+            pixels.append(buffer)
+        }
+
+        var count = 0
+        for i in 0..<(width * height) {
+            for c in 0..<4 where abs(Int(pixels[0][i * 4 + c]) - Int(pixels[1][i * 4 + c])) > tolerance {
+                count++
+                break
+            }
+        }
+        return count
+    }
+
+    func testDataSetCopyKeepsClassAndStyle() {
+        let dataSet = LineChartDataSet(yVals: [ChartDataEntry(value: 1, xIndex: 0)], label: "Score")
+        dataSet.circleRadius = 3
+        dataSet.valueFont = UIFont.systemFontOfSize(20)
+        dataSet.axisDependency = .Right
+
+        let copy = dataSet.copy() as! LineChartDataSet
+        XCTAssertEqual(copy.circleRadius, 3)
+        XCTAssertEqual(copy.valueFont, dataSet.valueFont)
+        XCTAssertEqual(copy.axisDependency, ChartYAxis.AxisDependency.Right)
+        XCTAssertTrue((PieChartDataSet(yVals: nil, label: nil).copy() as AnyObject) is PieChartDataSet)
+        XCTAssertTrue((BarChartDataSet(yVals: nil, label: nil).copy() as AnyObject) is BarChartDataSet)
+    }
+
+    func testSnapshotDrawsLikeTheView() {
+        let line = makeLineChart(200)
+        line.highlightValue(xIndex: 50, dataSetIndex: 0, callDelegate: false)
+        let lineSnapshot = line.chartSnapshot(transparent: false)!
+        XCTAssertEqual(differingPixels(lineSnapshot.renderImage(), drawChart(line), tolerance: 16), 0)
+
+        let pie = makePieChart()
+        pie.highlightValue(xIndex: 2, dataSetIndex: 0, callDelegate: false)
+        let pieSnapshot = pie.chartSnapshot(transparent: false)!
+        XCTAssertEqual(differingPixels(pieSnapshot.renderImage(), drawChart(pie), tolerance: 16), 0)
+    }
+
+    func testSnapshotIgnoresLaterChanges() {
+        let chart = makeLineChart(200)
+        let snapshot = chart.chartSnapshot(transparent: false)!
+        let before = UIImagePNGRepresentation(snapshot.renderImage())!
+
+        let dataSet = chart.data!.dataSets[0]
+        dataSet.yVals[100].value = 500
+        dataSet.colors = [UIColor.redColor()]
+        chart.data!.addEntry(ChartDataEntry(value: -500, xIndex: 200), dataSetIndex: 0)
+        chart.zoom(2, scaleY: 1, x: 320, y: 240)
+        chart.notifyDataSetChanged()
+
+        XCTAssertEqual(UIImagePNGRepresentation(snapshot.renderImage())!, before)
+        XCTAssertNotEqual(UIImagePNGRepresentation(chart.chartSnapshot(transparent: false)!.renderImage())!, before)
+    }
+
+    func testUnsupportedChartsHaveNoSnapshot() {
+        XCTAssertNil(LineChartView(frame: CGRect(x: 0, y: 0, width: 100, height: 100)).chartSnapshot(transparent: false))
+        XCTAssertNil(RadarChartView(frame: CGRect(x: 0, y: 0, width: 100, height: 100)).chartSnapshot(transparent: false))
+    }
+
+    func testImageDataIsDeliveredOnMainQueue() {
+        let chart = makePieChart()
+        let delivered = expectationWithDescription("image data")
+        chart.getChartImageData(format: .PNG, compressionQuality: 1) { imageData in
+            XCTAssertTrue(NSThread.isMainThread())
+            XCTAssertNotNil(imageData.flatMap { UIImage(data: $0) })
+            delivered.fulfill()
+        }
+
+        let path = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent("ChartSnapshotTests.jpg")
+        let saved = expectationWithDescription("saved")
+        chart.saveToPath(path, format: .JPEG, compressionQuality: 0.8) { success in
+            XCTAssertTrue(success)
+            XCTAssertTrue(NSFileManager.defaultManager().fileExistsAtPath(path))
+            saved.fulfill()
+        }
+
+        waitForExpectationsWithTimeout(10, handler: nil)
+    }
+
+    // MARK: Main thread time to share a chart: drawing and encoding it there, or only taking a snapshot.
+
+    static let shareCount = 10
+
+    /* Shares the chart shareCount times, the way the share button does on the main thread. */
+    func repeatShares(share: () -> Void) {
+        for _ in 0..<ChartSnapshotTests.shareCount {
+            share()
+        }
+    }
+
+    func testPerformanceShareDrawAndEncode() {
+        let chart = makePieChart()
+        self.measureBlock() {
+            self.repeatShares { UIImagePNGRepresentation(self.drawChart(chart)) }
+        }
+    }
+
+    func testPerformanceShareSnapshot() {
+        let chart = makePieChart()
+        self.measureBlock() {
+            self.repeatShares { chart.chartSnapshot(transparent: true) }
+        }
+    }
+}
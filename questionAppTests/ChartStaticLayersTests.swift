@@ -0,0 +1,135 @@
+//
+//  ChartStaticLayersTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class ChartStaticLayersTests: XCTestCase {
+
+    /* A line chart with the chrome the static layers cache: grid, both axes, a limit line, legend and description. */
+    func makeChart(count: Int, cached: Bool) -> LineChartView {
+        var entries = [ChartDataEntry]()
+        var xVals = [String?]()
+        for i in 0..<count {
+            entries.append(ChartDataEntry(value: sin(Double(i) / 20) * 100, xIndex: i))
+            xVals.append("Day \(i)")
+        }
+
+        let dataSet = LineChartDataSet(yVals: entries, label: "Score")
+        dataSet.drawCirclesEnabled = false
+
+        let chart = LineChartView(frame: CGRect(x: 0, y: 0, width: 640, height: 480))
+        chart.descriptionText = "Scores by day"
+        chart.leftAxis.addLimitLine(ChartLimitLine(limit: 50, label: "Goal"))
+        chart.staticLayerCachingEnabled = cached
+        chart.data = LineChartData(xVals: xVals, dataSets: [dataSet])
+        return chart
+    }
+
+    /* Draws chart into an image context, the way UIKit calls drawRect. */
+    func redraw(chart: LineChartView) {
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        chart.drawRect(chart.bounds)
+        UIGraphicsEndImageContext()
+    }
+
+    func testHighlightReusesStaticLayers() {
+        let chart = makeChart(200, cached: true)
+        redraw(chart)
+        let background = chart._staticBackgroundImage
+        let foreground = chart._staticForegroundImage
+        XCTAssertNotNil(background)
+        XCTAssertNotNil(foreground)
+
+        chart.highlightValue(xIndex: 100, dataSetIndex: 0, callDelegate: false)
+        redraw(chart)
+        XCTAssertTrue(chart._staticBackgroundImage === background)
+        XCTAssertTrue(chart._staticForegroundImage === foreground)
+    }
+
+    func testViewportAndDataChangesRedrawStaticLayers() {
+        let chart = makeChart(200, cached: true)
+        redraw(chart)
+        var background = chart._staticBackgroundImage
+
+        chart.zoom(2, scaleY: 1, x: 320, y: 240)
+        redraw(chart)
+        XCTAssertFalse(chart._staticBackgroundImage === background)
+
+        background = chart._staticBackgroundImage
+        chart.data!.addEntry(ChartDataEntry(value: 500, xIndex: 199), dataSetIndex: 0)
+        chart.notifyDataSetChanged()
+        XCTAssertNil(chart._staticBackgroundImage)
+        redraw(chart)
+        XCTAssertFalse(chart._staticBackgroundImage === background)
+
+        background = chart._staticBackgroundImage
+        chart.gridBackgroundColor = UIColor.whiteColor()
+        redraw(chart)
+        XCTAssertFalse(chart._staticBackgroundImage === background)
+    }
+
+    func testUncachedChartKeepsNoLayers() {
+        let chart = makeChart(200, cached: false)
+        redraw(chart)
+        XCTAssertNil(chart._staticBackgroundImage)
+
+        chart.staticLayerCachingEnabled = true
+        redraw(chart)
+        XCTAssertNotNil(chart._staticBackgroundImage)
+
+        chart.staticLayerCachingEnabled = false
+        XCTAssertNil(chart._staticBackgroundImage)
+    }
+
+    func testPartialRedrawDrawsStaticLayersFromCache() {
+        let chart = makeChart(200, cached: false)
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        chart.drawRect(chart.bounds)
+        chart.drawRect(chart.dataLayerRect)
+        let background = chart._staticBackgroundImage
+        XCTAssertNotNil(background)
+        XCTAssertNotNil(chart._staticForegroundImage)
+
+        // the next paced frame reuses them, a full redraw releases them
+        chart.drawRect(chart.dataLayerRect)
+        XCTAssertTrue(chart._staticBackgroundImage === background)
+        chart.drawRect(chart.bounds)
+        XCTAssertNil(chart._staticBackgroundImage)
+        UIGraphicsEndImageContext()
+    }
+
+    // MARK: Frame time for redraws that only change the data layer: highlight taps and animation frames.
+
+    static let frameCount = 50
+
+    /* Redraws chart for frameCount highlight taps. */
+    func redrawHighlights(chart: LineChartView) {
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        chart.drawRect(chart.bounds)
+        for i in 0..<ChartStaticLayersTests.frameCount {
+            chart.highlightValue(xIndex: i, dataSetIndex: 0, callDelegate: false)
+            chart.drawRect(chart.bounds)
+        }
+        UIGraphicsEndImageContext()
+    }
+
+    func testPerformanceHighlightRedrawCached() {
+        let chart = makeChart(300, cached: true)
+        self.measureBlock() {
+            self.redrawHighlights(chart)
+        }
+    }
+
+    func testPerformanceHighlightRedrawUncached() {
+        let chart = makeChart(300, cached: false)
+        self.measureBlock() {
+            self.redrawHighlights(chart)
+        }
+    }
+}
@@ -0,0 +1,137 @@
+//
+//  ChartTextCacheTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+@testable import Charts
+
+class ChartTextCacheTests: XCTestCase {
+
+    let font = UIFont(name: kOmnesFontMedium, size: 17) ?? UIFont.systemFontOfSize(17)
+
+    func testSizesMatchNSStringMeasurement() {
+        let cache = ChartTextCache(capacity: 16)
+        let attributes = [NSFontAttributeName: font]
+        let text = "24 mo."
+
+        XCTAssertEqual(cache.size(text: text, attributes: attributes), (text as NSString).sizeWithAttributes(attributes))
+        let constraint = CGSize(width: 20, height: 0)
+        XCTAssertEqual(cache.size(text: text, attributes: attributes, constrainedToSize: constraint),
+            (text as NSString).boundingRectWithSize(constraint, options: .UsesLineFragmentOrigin, attributes: attributes, context: nil).size)
+
+        // the line is laid out as wide as UIKit measures it
+        let line = cache.line(text: text, font: font, color: UIColor.grayColor())
+        XCTAssertEqualWithAccuracy(line.size.width, (text as NSString).sizeWithAttributes(attributes).width, accuracy: 1.0)
+        XCTAssertEqual(cache.misses, 3)
+    }
+
+    func testKeysIncludeFontAndConstraint() {
+        let cache = ChartTextCache(capacity: 16)
+        cache.size(text: "Jan", attributes: [NSFontAttributeName: font])
+        cache.size(text: "Jan", attributes: [NSFontAttributeName: font.fontWithSize(9)])
+        cache.size(text: "Jan", attributes: [NSFontAttributeName: font], constrainedToSize: CGSize(width: 10, height: 0))
+        cache.size(text: "Jan", attributes: [NSFontAttributeName: font, NSForegroundColorAttributeName: UIColor.redColor()])
+        XCTAssertEqual(cache.misses, 3)
+        XCTAssertEqual(cache.hits, 1)
+    }
+
+    func testLeastRecentlyUsedIsDropped() {
+        let cache = ChartTextCache(capacity: 3)
+        let attributes = [NSFontAttributeName: font]
+        cache.size(text: "1 mo.", attributes: attributes)
+        cache.size(text: "2 mo.", attributes: attributes)
+        cache.size(text: "3 mo.", attributes: attributes)
+        cache.size(text: "1 mo.", attributes: attributes)
+        cache.size(text: "4 mo.", attributes: attributes)
+        XCTAssertEqual(cache.count, 3)
+
+        // "2 mo." was the least recently used
+        cache.size(text: "1 mo.", attributes: attributes)
+        cache.size(text: "3 mo.", attributes: attributes)
+        cache.size(text: "4 mo.", attributes: attributes)
+        XCTAssertEqual(cache.misses, 4)
+        cache.size(text: "2 mo.", attributes: attributes)
+        XCTAssertEqual(cache.misses, 5)
+    }
+
+    func testTextWithLineBreaksIsNotDrawnAsOneLine() {
+        let cache = ChartTextCache.sharedCache
+        cache.removeAll()
+        let attributes = [NSFontAttributeName: font]
+        UIGraphicsBeginImageContextWithOptions(CGSize(width: 100, height: 100), true, 1)
+        ChartUtils.drawText(context: UIGraphicsGetCurrentContext(), text: "Sam\n9 mo.", point: CGPointZero, align: .Left, attributes: attributes)
+        XCTAssertEqual(cache.misses, 0)
+        ChartUtils.drawText(context: UIGraphicsGetCurrentContext(), text: "9 mo.", point: CGPointZero, align: .Left, attributes: attributes)
+        XCTAssertEqual(cache.misses, 1)
+        UIGraphicsEndImageContext()
+    }
+
+    func testAxisLabelsAreLaidOutAgainOnlyWhenTheViewportChanges() {
+        var entries = [ChartDataEntry]()
+        var xVals = [String?]()
+        for i in 0..<100 {
+            entries.append(ChartDataEntry(value: Double(i), xIndex: i))
+            xVals.append("\(i) mo.")
+        }
+        let chart = LineChartView(frame: CGRect(x: 0, y: 0, width: 320, height: 240))
+        chart.data = LineChartData(xVals: xVals, dataSets: [LineChartDataSet(yVals: entries, label: "Age")])
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        chart.drawRect(chart.bounds)
+
+        let renderer = chart._xAxisRenderer
+        let attributes = [NSFontAttributeName: chart.xAxis.labelFont]
+        let key = renderer.labelLayoutKey
+        let before = renderer.laidOutLabels(attributes: attributes, labelMaxSize: CGSize()).map { $0.x }
+        chart.drawRect(chart.bounds)
+        XCTAssertTrue(renderer.labelLayoutKey == key)
+
+        chart.zoom(4, scaleY: 1, x: 160, y: 120)
+        chart.drawRect(chart.bounds)
+        XCTAssertFalse(renderer.labelLayoutKey == key)
+        XCTAssertFalse(renderer.laidOutLabels(attributes: attributes, labelMaxSize: CGSize()).map { $0.x } == before)
+        UIGraphicsEndImageContext()
+    }
+
+    // MARK: Redraw cost of the test range chart, whose month labels repeat on every layout and redraw.
+
+    static let frameCount = 50
+
+    func makeRangeChart() -> BNTestRangeChartView {
+        let chart = BNTestRangeChartView(frame: CGRect(x: 0, y: 0, width: 320, height: 120))
+        chart.config(startMonth: 0, endMonth: 24, successAgeInMonths: 9, babyAgeInMonths: 11, babyName: "Sam", babySuccessAgeInMonths: 10)
+        return chart
+    }
+
+    /* Lays out and redraws chart frameCount times, with the text cache warm or emptied before every frame. */
+    func redrawFrames(chart: BNTestRangeChartView, cold: Bool) {
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        chart.drawRect(chart.bounds)
+        for _ in 0..<ChartTextCacheTests.frameCount {
+            if cold {
+                ChartTextCache.sharedCache.removeAll()
+            }
+            chart.notifyDataSetChanged()
+            chart.drawRect(chart.bounds)
+        }
+        UIGraphicsEndImageContext()
+    }
+
+    func testPerformanceRangeChartCachedText() {
+        let chart = makeRangeChart()
+        self.measureBlock() {
+            self.redrawFrames(chart, cold: false)
+        }
+    }
+
+    func testPerformanceRangeChartMeasuredText() {
+        let chart = makeRangeChart()
+        self.measureBlock() {
+            self.redrawFrames(chart, cold: true)
+        }
+    }
+}
@@ -0,0 +1,126 @@
+//
+//  ChartTransformerTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class ChartTransformerTests: XCTestCase {
+
+    /* A transformer for a 320x240 chart showing x 0..<count and y -100...100. */
+    func makeTransformer(count: Int) -> ChartTransformer {
+        let viewPortHandler = ChartViewPortHandler(width: 320, height: 240)
+        viewPortHandler.restrainViewPort(offsetLeft: 20, offsetTop: 10, offsetRight: 10, offsetBottom: 20)
+        let trans = ChartTransformer(viewPortHandler: viewPortHandler)
+        trans.prepareMatrixValuePx(chartXMin: 0, deltaX: CGFloat(count), deltaY: 200, chartYMin: -100)
+        trans.prepareMatrixOffset(false)
+        return trans
+    }
+
+    func makePoints(count: Int) -> [CGPoint] {
+        var points = [CGPoint]()
+        points.reserveCapacity(count)
+        for i in 0..<count {
+            points.append(CGPoint(x: CGFloat(i), y: CGFloat(sin(Double(i) / 100) * 100)))
+        }
+        return points
+    }
+
+    /* The per point transform pointValuesToPixel did before the batch kernel. */
+    func transformPerPoint(inout points: [CGPoint], trans: CGAffineTransform, phaseY: CGFloat) {
+        for i in 0..<points.count {
+            points[i] = CGPointApplyAffineTransform(CGPoint(x: points[i].x, y: points[i].y * phaseY), trans)
+        }
+    }
+
+    func assertPointsEqual(points: [CGPoint], _ expected: [CGPoint], count: Int) {
+        for i in 0..<count {
+            XCTAssertEqualWithAccuracy(points[i].x, expected[i].x, accuracy: 0.0001)
+            XCTAssertEqualWithAccuracy(points[i].y, expected[i].y, accuracy: 0.0001)
+        }
+    }
+
+    func testBatchTransformMatchesPerPoint() {
+        let trans = makeTransformer(1000)
+        for phaseY in [CGFloat(1), 0.5, 0] {
+            var batch = makePoints(1000)
+            var expected = batch
+            trans.pointValuesToPixel(&batch, count: batch.count, phaseY: phaseY)
+            transformPerPoint(&expected, trans: trans.valueToPixelMatrix, phaseY: phaseY)
+            assertPointsEqual(batch, expected, count: batch.count)
+        }
+    }
+
+    func testBatchTransformOnlyTouchesCount() {
+        let trans = makeTransformer(100)
+        let original = makePoints(100)
+        var points = original
+        trans.pointValuesToPixel(&points, count: 40, phaseY: 1)
+        XCTAssertNotEqual(points[39], original[39])
+        XCTAssertEqual(Array(points[40..<100]), Array(original[40..<100]))
+    }
+
+    func testRotatedMatrixFallsBackToPerPoint() {
+        let trans = makeTransformer(100)
+        trans._matrixValueToPx = CGAffineTransformRotate(trans._matrixValueToPx, 0.3)
+        var batch = makePoints(100)
+        var expected = batch
+        trans.pointValuesToPixel(&batch, count: batch.count, phaseY: 0.8)
+        transformPerPoint(&expected, trans: trans.valueToPixelMatrix, phaseY: 0.8)
+        assertPointsEqual(batch, expected, count: batch.count)
+    }
+
+    func testTransformValuesLineReusesBuffer() {
+        let trans = makeTransformer(1000)
+        var entries = [ChartDataEntry]()
+        for point in makePoints(1000) {
+            entries.append(ChartDataEntry(value: Double(point.y), xIndex: Int(point.x)))
+        }
+
+        var buffer = [CGPoint]()
+        var count = trans.transformValuesLine(entries, phaseX: 1, phaseY: 0.5, from: 100, to: 900, buffer: &buffer)
+        XCTAssertEqual(count, 800)
+        assertPointsEqual(buffer, trans.generateTransformedValuesLine(entries, phaseX: 1, phaseY: 0.5, from: 100, to: 900), count: count)
+
+        // a smaller range writes into the same buffer
+        count = trans.transformValuesLine(entries, phaseX: 0.5, phaseY: 1, from: 0, to: 100, buffer: &buffer)
+        XCTAssertEqual(count, 50)
+        XCTAssertEqual(buffer.count, 800)
+
+        let columns = ChartDataColumns(xIndices: entries.map { $0.xIndex }, values: entries.map { $0.value })
+        assertPointsEqual(trans.generateTransformedValuesLine(columns, phaseX: 1, phaseY: 0.5, from: 100, to: 900), trans.generateTransformedValuesLine(entries, phaseX: 1, phaseY: 0.5, from: 100, to: 900), count: 800)
+    }
+
+    // MARK: Per frame transform cost while panning.
+    // Panning changes the touch matrix, so every frame transforms all visible points again.
+
+    static let framesPerMeasurement = 10
+
+    func testPerformanceBatchTransform1M() {
+        let trans = makeTransformer(1_000_000)
+        let points = makePoints(1_000_000)
+        var buffer = points
+        self.measureBlock() {
+            for _ in 0..<ChartTransformerTests.framesPerMeasurement {
+                buffer.replaceRange(0..<points.count, with: points)
+                trans.pointValuesToPixel(&buffer, count: buffer.count, phaseY: 0.5)
+            }
+        }
+    }
+
+    func testPerformancePerPointTransform1M() {
+        let trans = makeTransformer(1_000_000)
+        let points = makePoints(1_000_000)
+        var buffer = points
+        self.measureBlock() {
+            for _ in 0..<ChartTransformerTests.framesPerMeasurement {
+                buffer.replaceRange(0..<points.count, with: points)
+                self.transformPerPoint(&buffer, trans: trans.valueToPixelMatrix, phaseY: 0.5)
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+//
+//  LineChartRendererTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import Charts
+
+class LineChartRendererTests: XCTestCase {
+
+    static let palette = [UIColor.redColor(), UIColor.greenColor(), UIColor.blueColor(), UIColor.orangeColor(),
+        UIColor.purpleColor(), UIColor.brownColor(), UIColor.cyanColor(), UIColor.magentaColor()]
+
+    func makeChart(count: Int, colors: [UIColor]) -> LineChartView {
+        var entries = [ChartDataEntry]()
+        var xVals = [String?]()
+        entries.reserveCapacity(count)
+        xVals.reserveCapacity(count)
+        for i in 0..<count {
+            // deterministic, so two charts with the same count draw the same line
+            entries.append(ChartDataEntry(value: sin(Double(i) / 50) * 100 + cos(Double(i) / 3) * 10, xIndex: i))
+            xVals.append(String(i))
+        }
+
+        let dataSet = LineChartDataSet(yVals: entries, label: nil)
+        dataSet.colors = colors
+        dataSet.drawCirclesEnabled = false
+        dataSet.drawValuesEnabled = false
+
+        let chart = LineChartView(frame: CGRect(x: 0, y: 0, width: 640, height: 480))
+        chart.data = LineChartData(xVals: xVals, dataSets: [dataSet])
+        return chart
+    }
+
+    /* colors for count entries, changing every runLength entries. */
+    func makeRuns(count: Int, colors: [UIColor], runLength: Int) -> [UIColor] {
+        var runs = [UIColor]()
+        runs.reserveCapacity(count)
+        for i in 0..<count {
+            runs.append(colors[(i / runLength) % colors.count])
+        }
+        return runs
+    }
+
+    func render(chart: LineChartView) -> NSData {
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        chart.drawRect(chart.bounds)
+        let image = UIGraphicsGetImageFromCurrentImageContext()
+        UIGraphicsEndImageContext()
+        return UIImagePNGRepresentation(image)!
+    }
+
+    func testSingleRunDrawsLikeSingleColor() {
+        let single = makeChart(2000, colors: [UIColor.redColor()])
+        // equal colors, different objects: one run
+        let runs = makeChart(2000, colors: [UIColor.redColor(), UIColor(red: 1, green: 0, blue: 0, alpha: 1)])
+        XCTAssertEqual(render(single), render(runs))
+    }
+
+    func testZoomedChartDrawsVisibleRange() {
+        let chart = makeChart(10_000, colors: makeRuns(10_000, colors: LineChartRendererTests.palette, runLength: 100))
+        chart.zoom(50, scaleY: 1, x: 320, y: 240)
+        chart.moveViewToX(5000)
+        XCTAssertGreaterThan(chart.lowestVisibleXIndex, 0)
+        XCTAssertGreaterThan(render(chart).length, 0)
+    }
+
+    // MARK: Frame time for 1, 2 and many color DataSets.
+    // LegacyMultiColorLine is the per segment drawing drawLinear did for multi-color DataSets before color runs.
+
+    class LegacyMultiColorLine {
+        static func draw(context: CGContext?, dataSet: LineChartDataSet, trans: ChartTransformer, viewPortHandler: ChartViewPortHandler) {
+            let entries = dataSet.yVals
+            let valueToPixelMatrix = trans.valueToPixelMatrix
+            var segments = [CGPoint](count: 2, repeatedValue: CGPoint())
+            for j in 0..<(entries.count - 1) {
+                segments[0] = CGPointApplyAffineTransform(CGPoint(x: CGFloat(entries[j].xIndex), y: CGFloat(entries[j].value)), valueToPixelMatrix)
+                segments[1] = CGPointApplyAffineTransform(CGPoint(x: CGFloat(entries[j + 1].xIndex), y: CGFloat(entries[j + 1].value)), valueToPixelMatrix)
+                if !viewPortHandler.isInBoundsRight(segments[0].x) {
+                    break
+                }
+                if !viewPortHandler.isInBoundsLeft(segments[1].x) {
+                    continue
+                }
+                CGContextSetStrokeColorWithColor(context, dataSet.colorAt(j).CGColor)
+                CGContextStrokeLineSegments(context, segments, 2)
+            }
+        }
+    }
+
+    func testPerformanceFrameColorRuns() {
+        let chart = makeChart(20_000, colors: makeRuns(20_000, colors: LineChartRendererTests.palette, runLength: 100))
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        self.measureBlock() {
+            chart.drawRect(chart.bounds)
+        }
+        UIGraphicsEndImageContext()
+    }
+
+    func testPerformanceFramePerSegmentColors() {
+        let chart = makeChart(20_000, colors: makeRuns(20_000, colors: LineChartRendererTests.palette, runLength: 100))
+        let dataSet = chart.data!.dataSets[0] as! LineChartDataSet
+        let trans = chart.getTransformer(.Left)
+        UIGraphicsBeginImageContextWithOptions(chart.bounds.size, true, 1)
+        let context = UIGraphicsGetCurrentContext()
+        self.measureBlock() {
+            LegacyMultiColorLine.draw(context, dataSet: dataSet, trans: trans, viewPortHandler: chart.viewPortHandler)
+        }
+        UIGraphicsEndImageContext()
+    }
+}
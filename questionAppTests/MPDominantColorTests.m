@@ -0,0 +1,132 @@
+//
+//  MPDominantColorTests.m
+//  questionAppTests
+//
+
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+#import "MPDominantColor.h"
+#import "UIImage+MPAverageColor.h"
+
+@interface MPDominantColorTests : XCTestCase
+
+@end
+
+@implementation MPDominantColorTests
+
+{
+    mp_color_histogram _histogram;
+}
+
+// Fills rows [fromRow, toRow) of a BGRA buffer with one color.
+static void fillRows(uint8_t *pixels, size_t width, size_t fromRow, size_t toRow, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
+{
+    for (size_t i = fromRow * width; i < toRow * width; i++) {
+        pixels[i * 4 + 0] = blue;
+        pixels[i * 4 + 1] = green;
+        pixels[i * 4 + 2] = red;
+        pixels[i * 4 + 3] = alpha;
+    }
+}
+
+- (void)setUp {
+    [super setUp];
+    mp_color_histogram_reset(&_histogram);
+}
+
+- (void)testLargestRegionWinsForEveryRefinement {
+    size_t width = 32, height = 32;
+    uint8_t pixels[32 * 32 * 4];
+    fillRows(pixels, width, 0, 20, 200, 30, 40, 255);
+    fillRows(pixels, width, 20, 32, 20, 40, 220, 255);
+    mp_color_histogram_add_pixels(&_histogram, pixels, width, height, width * 4, MP_DOMINANT_COLOR_DEFAULT_FILTERS);
+
+    mp_dominant_color_refinement refinements[] = { MP_DOMINANT_COLOR_HISTOGRAM, MP_DOMINANT_COLOR_KMEANS, MP_DOMINANT_COLOR_MEDIAN_CUT };
+    for (int i = 0; i < 3; i++) {
+        mp_dominant_color color;
+        XCTAssertEqual(mp_color_histogram_dominant_color(&_histogram, refinements[i], 4, &color), 0);
+        XCTAssertEqual(color.red, 200);
+        XCTAssertEqual(color.green, 30);
+        XCTAssertEqual(color.blue, 40);
+        XCTAssertEqual(color.population, 20u * 32u);
+    }
+}
+
+- (void)testFiltersSkipWhiteGrayAndTransparentPixels {
+    size_t width = 16, height = 16;
+    uint8_t pixels[16 * 16 * 4];
+    fillRows(pixels, width, 0, 6, 255, 255, 255, 255);
+    fillRows(pixels, width, 6, 10, 128, 128, 128, 255);
+    fillRows(pixels, width, 10, 13, 0, 0, 255, 0);
+    fillRows(pixels, width, 13, 16, 10, 160, 90, 255);
+    mp_color_histogram_add_pixels(&_histogram, pixels, width, height, width * 4, MP_DOMINANT_COLOR_DEFAULT_FILTERS);
+
+    XCTAssertEqual(_histogram.total, 3u * 16u);
+    mp_dominant_color color;
+    XCTAssertEqual(mp_color_histogram_dominant_color(&_histogram, MP_DOMINANT_COLOR_HISTOGRAM, 1, &color), 0);
+    XCTAssertEqual(color.red, 10);
+    XCTAssertEqual(color.green, 160);
+    XCTAssertEqual(color.blue, 90);
+}
+
+- (void)testCountersDoNotOverflow {
+    // The old histogram used 8 bit counters; a single color covering more than
+    // 255 pixels has to keep counting.
+    size_t width = 64, height = 64;
+    uint8_t *pixels = malloc(width * height * 4);
+    fillRows(pixels, width, 0, 60, 90, 20, 160, 255);
+    fillRows(pixels, width, 60, 64, 220, 120, 0, 255);
+    mp_color_histogram_add_pixels(&_histogram, pixels, width, height, width * 4, MP_DOMINANT_COLOR_DEFAULT_FILTERS);
+    free(pixels);
+
+    mp_dominant_color color;
+    XCTAssertEqual(mp_color_histogram_dominant_color(&_histogram, MP_DOMINANT_COLOR_HISTOGRAM, 1, &color), 0);
+    XCTAssertEqual(color.population, 60u * 64u);
+    XCTAssertEqual(color.red, 90);
+}
+
+- (void)testNearbyShadesAreMergedByRefinement {
+    // Two shades that land in different histogram bins but are perceptually the
+    // same color outweigh a third color that is larger than either one alone.
+    size_t width = 10, height = 10;
+    uint8_t pixels[10 * 10 * 4];
+    fillRows(pixels, width, 0, 3, 100, 20, 20, 255);
+    fillRows(pixels, width, 3, 6, 112, 20, 20, 255);
+    fillRows(pixels, width, 6, 10, 20, 20, 200, 255);
+    mp_color_histogram_add_pixels(&_histogram, pixels, width, height, width * 4, MP_DOMINANT_COLOR_DEFAULT_FILTERS);
+
+    mp_dominant_color color;
+    XCTAssertEqual(mp_color_histogram_dominant_color(&_histogram, MP_DOMINANT_COLOR_HISTOGRAM, 2, &color), 0);
+    XCTAssertEqual(color.blue, 200);
+
+    XCTAssertEqual(mp_color_histogram_dominant_color(&_histogram, MP_DOMINANT_COLOR_KMEANS, 2, &color), 0);
+    XCTAssertEqual(color.red, 106);
+    XCTAssertEqual(color.population, 60u);
+
+    XCTAssertEqual(mp_color_histogram_dominant_color(&_histogram, MP_DOMINANT_COLOR_MEDIAN_CUT, 2, &color), 0);
+    XCTAssertEqual(color.red, 106);
+    XCTAssertEqual(color.population, 60u);
+}
+
+- (void)testEmptyHistogramHasNoDominantColor {
+    mp_dominant_color color;
+    XCTAssertEqual(mp_color_histogram_dominant_color(&_histogram, MP_DOMINANT_COLOR_KMEANS, 4, &color), -1);
+}
+
+- (void)testImportantColorPerformance {
+    UIGraphicsBeginImageContextWithOptions(CGSizeMake(640.0f, 1136.0f), YES, 2.0f);
+    for (int i = 0; i < 64; i++) {
+        [[UIColor colorWithHue:i / 64.0f saturation:0.8f brightness:0.8f alpha:1.0f] setFill];
+        UIRectFill(CGRectMake(0.0f, i * 17.75f, 640.0f, 17.75f));
+    }
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+
+    [self measureBlock:^{
+        for (int i = 0; i < 10; i++) {
+            XCTAssertNotNil([image mp_dominantColorInRect:(CGRect){.size = image.size} refinement:MP_DOMINANT_COLOR_KMEANS]);
+        }
+    }];
+}
+
+@end
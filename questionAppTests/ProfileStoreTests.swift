@@ -0,0 +1,113 @@
+//
+//  ProfileStoreTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+
+class ProfileStoreTests: XCTestCase {
+
+    var directory: String!
+
+    override func setUp() {
+        super.setUp()
+        directory = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent(NSUUID().UUIDString)
+        try! NSFileManager.defaultManager().createDirectoryAtPath(directory, withIntermediateDirectories: true, attributes: nil)
+    }
+
+    override func tearDown() {
+        _ = try? NSFileManager.defaultManager().removeItemAtPath(directory)
+        super.tearDown()
+    }
+
+    /* The profiles on disk, read by a TestProfiles that does not share the store's state. */
+    func loadFromDisk() -> TestProfiles {
+        let profiles = TestProfiles(documentsPath: directory)
+        profiles.loadArchive()
+        return profiles
+    }
+
+    var manifestPath: String {
+        return TestProfiles(documentsPath: directory).manifestPath
+    }
+
+    /* Counts a passed hearing test for "sam.ada". Changes the history directly, since Test.addTestResult also appends to the app's result log. */
+    func passHearing(store: ProfileStore) {
+        store.update { profiles in
+            profiles.getTestHistories(profileName: "sam.ada")!.getTestHistory(testName: Test.TestNames.hearing).countOfSuccessfulTests += 1
+        }
+    }
+
+    /* Waits up to timeout seconds for the write-behind save to put the manifest on disk. */
+    func waitForManifest(timeout: NSTimeInterval) -> Bool {
+        let deadline = NSDate(timeIntervalSinceNow: timeout)
+        while !NSFileManager.defaultManager().fileExistsAtPath(manifestPath) {
+            if deadline.timeIntervalSinceNow < 0 {
+                return false
+            }
+            NSThread.sleepForTimeInterval(0.05)
+        }
+        return true
+    }
+
+    func testArchiveIsReadOnce() {
+        let store = ProfileStore(documentsPath: directory)
+        XCTAssertNil(store.read { $0.getTestHistories(profileName: "sam.ada") })
+
+        // a profile written behind the store's back is not seen: the store does not read the disk again
+        let other = TestProfiles(documentsPath: directory)
+        other.addProfile(name: "sam.ada")
+        XCTAssertTrue(other.writeArchive())
+        XCTAssertNil(store.read { $0.getTestHistories(profileName: "sam.ada") })
+    }
+
+    func testUpdatesAreWrittenAfterTheSaveDelay() {
+        let store = ProfileStore(documentsPath: directory)
+        store.addProfile("sam.ada")
+        store.addProfile("sam.ben")
+        store.addProfile("sam.cy")
+        XCTAssertFalse(NSFileManager.defaultManager().fileExistsAtPath(manifestPath))
+
+        XCTAssertTrue(waitForManifest(ProfileStore.saveDelay * 10))
+        store.flush()
+        let profiles = loadFromDisk()
+        for name in ["sam.ada", "sam.ben", "sam.cy"] {
+            XCTAssertNotNil(profiles.getTestHistories(profileName: name))
+        }
+    }
+
+    func testFlushWritesPendingChanges() {
+        let store = ProfileStore(documentsPath: directory)
+        store.addProfile("sam.ada")
+        passHearing(store)
+        store.flush()
+
+        XCTAssertEqual(loadFromDisk().getTest("sam.ada", testName: Test.TestNames.hearing).history.countOfSuccessfulTests, 1)
+    }
+
+    func testShardsAreReplacedAtomically() {
+        let store = ProfileStore(documentsPath: directory)
+        store.addProfile("sam.ada")
+        store.flush()
+
+        let manager = NSFileManager.defaultManager()
+        let storeDirectory = TestProfiles(documentsPath: directory).storeDirectoryPath
+        let shards = try! manager.contentsOfDirectoryAtPath(storeDirectory).filter { $0.hasSuffix(".bin") }
+        XCTAssertEqual(shards.count, 1)
+        let shardPath = (storeDirectory as NSString).stringByAppendingPathComponent(shards[0])
+        let before = try! manager.attributesOfItemAtPath(shardPath)[NSFileSystemFileNumber] as! NSNumber
+
+        passHearing(store)
+        store.flush()
+
+        // an atomic write renames a new file over the shard rather than rewriting it in place, and leaves no temporary file
+        let after = try! manager.attributesOfItemAtPath(shardPath)[NSFileSystemFileNumber] as! NSNumber
+        XCTAssertNotEqual(before, after)
+        XCTAssertEqual(Set(try! manager.contentsOfDirectoryAtPath(storeDirectory)), Set([shards[0], "Manifest.plist"]))
+        XCTAssertEqual(loadFromDisk().getTest("sam.ada", testName: Test.TestNames.hearing).history.countOfSuccessfulTests, 1)
+    }
+}
@@ -0,0 +1,182 @@
+//
+//  TestFlowTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+
+class TestFlowTests: XCTestCase {
+
+    func loadHearingDictionary() -> [String : AnyObject]? {
+        guard let path = NSBundle.mainBundle().pathForResource("HearingFlow", ofType: "plist") else {
+            return nil
+        }
+        return NSDictionary(contentsOfFile: path) as? [String : AnyObject]
+    }
+
+    func testHearingDefinition() {
+        guard let definition = TestFlowDefinition.definitionForTest(Test.TestNames.hearing) else {
+            XCTFail("missing hearing definition")
+            return
+        }
+        XCTAssertEqual(definition.trackerName, Tracker.Name.Hearing)
+        XCTAssertEqual(definition.presentableName, Test.TestNamesPresentable.hearing)
+        XCTAssertEqual(definition.videoFile ?? "", "hearing")
+        XCTAssertEqual(definition.reminderInterval, Test.NotificationInterval.hearing)
+
+        // the same steps, and Tracker progress values, as the storyboard flow
+        let kinds: [TestFlowDefinition.StepKind] = [.Why, .Overview, .WhatIsNeeded, .IsReady, .TimeToTest, .WhatDidYouSee, .Good, .Bad, .MoreInfo]
+        XCTAssertEqual(definition.steps.map { $0.kind }, kinds)
+        XCTAssertEqual(definition.steps.map { $0.progress }, kinds.map { $0.defaultProgress })
+    }
+
+    func testStepAfter() {
+        let definition = TestFlowDefinition.definitionForTest(Test.TestNames.hearing)!
+        XCTAssertEqual(definition.stepAfter(.WhatIsNeeded, skipIsReady: false)?.kind, .IsReady)
+        XCTAssertEqual(definition.stepAfter(.WhatIsNeeded, skipIsReady: true)?.kind, .TimeToTest)
+        // outcomes are reached by answering, not by "next step"
+        XCTAssertNil(definition.stepAfter(.WhatDidYouSee, skipIsReady: false))
+    }
+
+    func testBadOutcomeMessages() {
+        let definition = TestFlowDefinition.definitionForTest(Test.TestNames.hearing)!
+        XCTAssertEqual(definition.badOutcomeMessage(failures: 0)?.maxFailures, 1)
+        XCTAssertEqual(definition.badOutcomeMessage(failures: 2)?.maxFailures, 2)
+        XCTAssertEqual(definition.badOutcomeMessage(failures: 7)?.maxFailures, Int(Int32.max))
+    }
+
+    func testRejectsInvalidDefinitions() {
+        var dictionary = loadHearingDictionary()!
+        dictionary["version"] = TestFlowDefinition.version + 1
+        XCTAssertNil(TestFlowDefinition(dictionary: dictionary))
+
+        dictionary = loadHearingDictionary()!
+        dictionary["tracker"] = "Not A Tracker Name"
+        XCTAssertNil(TestFlowDefinition(dictionary: dictionary))
+    }
+
+    func testViewControllerCacheReusesControllers() {
+        let cache = TestFlowViewControllerCache.sharedCache
+        cache.removeAll()
+        let definition = TestFlowDefinition.definitionForTest(Test.TestNames.hearing)!
+        let coordinator = TestFlowCoordinator(definition: definition)
+
+        let first = coordinator.viewControllerForStep(definition.step(.Why)!)
+        cache.recycle(first)
+        XCTAssertNil(first.step)
+        let second = coordinator.viewControllerForStep(definition.step(.Why)!)
+        XCTAssertTrue(first === second)
+        XCTAssertTrue(coordinator.viewControllerForStep(definition.step(.Bad)!) is TestFlowBadOutcomeViewController)
+    }
+
+    // MARK: Launch and memory benchmarks.
+    // The storyboard benchmarks open CrossingEyes, a storyboard test with the same ten screens as hearing had.
+
+    /* Resident memory of the test process, in bytes. */
+    func residentMemory() -> UInt64 {
+        var info = mach_task_basic_info()
+        var count = mach_msg_type_number_t(sizeofValue(info) / sizeof(integer_t))
+        let result = withUnsafeMutablePointer(&info) {
+            task_info(mach_task_self_, task_flavor_t(MACH_TASK_BASIC_INFO), task_info_t($0), &count)
+        }
+        return result == KERN_SUCCESS ? UInt64(info.resident_size) : 0
+    }
+
+    /* Growth of resident memory since before, in bytes. */
+    func residentMemoryGrowth(since before: UInt64) -> UInt64 {
+        let now = residentMemory()
+        return now > before ? now - before : 0
+    }
+
+    /* Open the first screen of a test the way the milestone screens do, with nothing cached. */
+    func testPerformanceFirstScreenFlowEngine() {
+        let dictionary = loadHearingDictionary()!
+        self.measureBlock() {
+            let definition = TestFlowDefinition(dictionary: dictionary)!
+            let controller = TestFlowStepViewController()
+            controller.configure(coordinator: TestFlowCoordinator(definition: definition), step: definition.steps[0])
+            XCTAssertNotNil(controller.view)
+        }
+    }
+
+    func testPerformanceFirstScreenStoryboard() {
+        self.measureBlock() {
+            let storyboard = UIStoryboard(name: "CrossingEyes", bundle: nil)
+            let controller = storyboard.instantiateViewControllerWithIdentifier("WhyIsCrossingEyesStoryboardID")
+            XCTAssertNotNil(controller.view)
+        }
+    }
+
+    /* Walk every screen of the hearing flow through the view controller cache. */
+    func testPerformanceWholeFlowEngine() {
+        let definition = TestFlowDefinition.definitionForTest(Test.TestNames.hearing)!
+        self.measureBlock() {
+            let coordinator = TestFlowCoordinator(definition: definition)
+            for step in definition.steps where step.kind != .Bad {
+                let controller = coordinator.viewControllerForStep(step)
+                XCTAssertNotNil(controller.view)
+                controller.view.layoutIfNeeded()
+                TestFlowViewControllerCache.sharedCache.recycle(controller)
+            }
+        }
+    }
+
+    func testPerformanceWholeFlowStoryboard() {
+        self.measureBlock() {
+            let storyboard = UIStoryboard(name: "CrossingEyes", bundle: nil)
+            for identifier in TestFlowTests.storyboardScreenIds {
+                let controller = storyboard.instantiateViewControllerWithIdentifier(identifier)
+                XCTAssertNotNil(controller.view)
+                controller.view.layoutIfNeeded()
+            }
+        }
+    }
+
+    /* The CrossingEyes screens matching the hearing steps other than the bad outcome, whose storyboard controller schedules a reminder when loaded. */
+    static let storyboardScreenIds = ["WhyIsCrossingEyesStoryboardID", "CrossingEyesTestOverviewStoryboardID", "CrossingEyesWhatWillYouNeedStoryboardID",
+        "CrossingEyesIsBabyReadyStoryboardID", "CrossingEyesTimeToTestStoryboardID", "CrossingEyesWhatDidYouSeeStoryboardID",
+        "CrossingEyesGoodOutcomeStoryboardID", "CrossingEyesMoreInfoStoryboardID"]
+
+    func testMemoryFlowEngineVersusStoryboard() {
+        TestFlowViewControllerCache.sharedCache.removeAll()
+        let definition = TestFlowDefinition.definitionForTest(Test.TestNames.hearing)!
+        let storyboard = UIStoryboard(name: "CrossingEyes", bundle: nil)
+        var controllers = [UIViewController]()
+
+        // load the fonts and images both flows share before measuring either
+        let warmCoordinator = TestFlowCoordinator(definition: definition)
+        controllers.append(warmCoordinator.viewControllerForStep(definition.steps[0]))
+        controllers.append(storyboard.instantiateViewControllerWithIdentifier(TestFlowTests.storyboardScreenIds[0]))
+        for controller in controllers {
+            controller.view.layoutIfNeeded()
+        }
+
+        // the same screens through each
+        let coordinator = TestFlowCoordinator(definition: definition)
+        let engineSteps = definition.steps.filter { $0.kind != .Bad }
+        XCTAssertEqual(engineSteps.count, TestFlowTests.storyboardScreenIds.count)
+
+        let before = residentMemory()
+        for step in engineSteps {
+            let controller = coordinator.viewControllerForStep(step)
+            controller.view.layoutIfNeeded()
+            controllers.append(controller)
+        }
+        let engineMemory = residentMemoryGrowth(since: before)
+
+        let storyboardBefore = residentMemory()
+        for identifier in TestFlowTests.storyboardScreenIds {
+            let controller = storyboard.instantiateViewControllerWithIdentifier(identifier)
+            controller.view.layoutIfNeeded()
+            controllers.append(controller)
+        }
+        let storyboardMemory = residentMemoryGrowth(since: storyboardBefore)
+
+        // Resident memory deltas are too noisy to assert on; the numbers are reported for comparison between runs.
+        NSLog("TestFlowTests: \(engineSteps.count) screens: flow engine \(engineMemory / 1024) KB, storyboard \(storyboardMemory / 1024) KB")
+    }
+}
@@ -0,0 +1,110 @@
+//
+//  TestProfilesCodecTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+
+class TestProfilesCodecTests: XCTestCase {
+
+    /* Build count profiles with every test run at least once, similar to a long-used device. */
+    func makeProfiles(count: Int) -> [String : TestHistories] {
+        var profiles = [String : TestHistories]()
+        for p in 0..<count {
+            let histories = TestHistories()
+            var i = 0
+            for (_, history) in histories.histories {
+                history.countOfCompletedTests = 3 + i
+                history.countOfSuccessfulTests = i % 3
+                history.countOfFailedTests = history.countOfCompletedTests - history.countOfSuccessfulTests
+                history.mostRecentTestResult = i % 2 == 0
+                history.mostRecentTestDate = NSDate(timeIntervalSinceReferenceDate: Double(1000 * i))
+                history.succeededTestDate = i % 3 == 0 ? nil : NSDate(timeIntervalSinceReferenceDate: Double(500 * i))
+                history.reminderDate = i % 4 == 0 ? NSDate(timeIntervalSinceReferenceDate: Double(700 * i)) : nil
+                i += 1
+            }
+            profiles["parent \(p).baby \(p)"] = histories
+        }
+        return profiles
+    }
+
+    func testRoundTrip() {
+        let profiles = makeProfiles(3)
+        let data = TestProfilesCodec.encode(profiles)
+        guard let archive = TestProfilesCodec.Archive(data: data) else {
+            XCTFail("archive did not parse")
+            return
+        }
+        XCTAssertEqual(Set(archive.profileNames), Set(profiles.keys))
+
+        for (name, expected) in profiles {
+            guard let decoded = archive.decodeHistories(profileName: name) else {
+                XCTFail("missing profile \(name)")
+                continue
+            }
+            for (testName, history) in expected.histories {
+                let other = decoded.getTestHistory(testName: testName)
+                XCTAssertEqual(other.testName, history.testName)
+                XCTAssertEqual(other.countOfCompletedTests, history.countOfCompletedTests)
+                XCTAssertEqual(other.countOfSuccessfulTests, history.countOfSuccessfulTests)
+                XCTAssertEqual(other.countOfFailedTests, history.countOfFailedTests)
+                XCTAssertEqual(other.mostRecentTestResult, history.mostRecentTestResult)
+                XCTAssertEqual(other.mostRecentTestDate, history.mostRecentTestDate)
+                XCTAssertEqual(other.succeededTestDate, history.succeededTestDate)
+                XCTAssertEqual(other.reminderDate, history.reminderDate)
+            }
+        }
+    }
+
+    func testRejectsInvalidData() {
+        XCTAssertNil(TestProfilesCodec.Archive(data: NSData()))
+        let keyed = NSKeyedArchiver.archivedDataWithRootObject(makeProfiles(1))
+        XCTAssertNil(TestProfilesCodec.Archive(data: keyed))
+
+        // truncated records must not be readable
+        let data = TestProfilesCodec.encode(makeProfiles(1))
+        XCTAssertNil(TestProfilesCodec.Archive(data: data.subdataWithRange(NSRange(location: 0, length: data.length - 1))))
+    }
+
+    func testSmallerThanKeyedArchive() {
+        let profiles = makeProfiles(10)
+        let binary = TestProfilesCodec.encode(profiles)
+        let keyed = NSKeyedArchiver.archivedDataWithRootObject(profiles)
+        XCTAssertLessThan(binary.length, keyed.length)
+    }
+
+    // MARK: Load/save benchmarks at 1, 10 and 100 profiles.
+    // Each "load" opens the archive and reads one profile, which is what the app does at launch.
+
+    func measureBinary(profileCount: Int) {
+        let profiles = makeProfiles(profileCount)
+        let name = profiles.keys.first!
+        self.measureBlock() {
+            let data = TestProfilesCodec.encode(profiles)
+            let archive = TestProfilesCodec.Archive(data: data)
+            XCTAssertNotNil(archive?.decodeHistories(profileName: name))
+        }
+    }
+
+    func measureKeyedArchiver(profileCount: Int) {
+        let profiles = makeProfiles(profileCount)
+        let name = profiles.keys.first!
+        self.measureBlock() {
+            let data = NSKeyedArchiver.archivedDataWithRootObject(profiles)
+            let decoded = NSKeyedUnarchiver.unarchiveObjectWithData(data) as? [String : TestHistories]
+            XCTAssertNotNil(decoded?[name])
+        }
+    }
+
+    func testPerformanceBinary1() { measureBinary(1) }
+    func testPerformanceBinary10() { measureBinary(10) }
+    func testPerformanceBinary100() { measureBinary(100) }
+
+    func testPerformanceKeyedArchiver1() { measureKeyedArchiver(1) }
+    func testPerformanceKeyedArchiver10() { measureKeyedArchiver(10) }
+    func testPerformanceKeyedArchiver100() { measureKeyedArchiver(100) }
+}
@@ -0,0 +1,139 @@
+//
+//  TestProfilesTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+
+class TestProfilesTests: XCTestCase {
+
+    var directory: String!
+
+    override func setUp() {
+        super.setUp()
+        directory = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent(NSUUID().UUIDString)
+    }
+
+    override func tearDown() {
+        _ = try? NSFileManager.defaultManager().removeItemAtPath(directory)
+        super.tearDown()
+    }
+
+    /* Counts a passed hearing test for a profile. Changes the history directly, since Test.addTestResult also appends to the app's result log. */
+    func passHearing(profiles: TestProfiles, profileName: String) {
+        profiles.getTestHistories(profileName: profileName)!.getTestHistory(testName: Test.TestNames.hearing).countOfSuccessfulTests += 1
+    }
+
+    /* Writes profiles "sam.ada" and "sam.ben" to a new store, with one passed hearing test for ada. */
+    func writeStore() {
+        let profiles = TestProfiles(documentsPath: directory)
+        profiles.addProfile(name: "sam.ada")
+        profiles.addProfile(name: "sam.ben")
+        passHearing(profiles, profileName: "sam.ada")
+        XCTAssertTrue(profiles.writeArchive())
+    }
+
+    func shardFilenames() -> [String] {
+        let storeDirectory = TestProfiles(documentsPath: directory).storeDirectoryPath
+        return (try! NSFileManager.defaultManager().contentsOfDirectoryAtPath(storeDirectory)).filter { $0.hasSuffix(".bin") }
+    }
+
+    func shardPathForProfile(name: String) -> String {
+        let profiles = TestProfiles(documentsPath: directory)
+        let manifest = NSDictionary(contentsOfFile: profiles.manifestPath)!
+        let filename = (manifest["profiles"] as! [String : String])[name]!
+        return (profiles.storeDirectoryPath as NSString).stringByAppendingPathComponent(filename)
+    }
+
+    func testEachProfileHasItsOwnShard() {
+        writeStore()
+        XCTAssertEqual(shardFilenames().count, 2)
+        XCTAssertNotEqual(shardPathForProfile("sam.ada"), shardPathForProfile("sam.ben"))
+    }
+
+    func testOnlyThePreloadedProfileIsDecodedOnLoad() {
+        writeStore()
+        let profiles = TestProfiles(documentsPath: directory)
+        XCTAssertTrue(profiles.loadArchive(preloadProfileName: "sam.ben"))
+        XCTAssertTrue(Array(profiles.testProfiles.keys) == ["sam.ben"])
+
+        XCTAssertEqual(profiles.getTest("sam.ada", testName: Test.TestNames.hearing).history.countOfSuccessfulTests, 1)
+        XCTAssertEqual(Set(profiles.testProfiles.keys), Set(["sam.ada", "sam.ben"]))
+    }
+
+    func testOnlyChangedShardsAreWritten() {
+        writeStore()
+        let profiles = TestProfiles(documentsPath: directory)
+        profiles.loadArchive(preloadProfileName: "sam.ada")
+        profiles.getTestHistories(profileName: "sam.ben")
+        XCTAssertTrue(profiles.pendingWrites().writes.isEmpty)
+
+        passHearing(profiles, profileName: "sam.ben")
+        let pending = profiles.pendingWrites()
+        XCTAssertTrue(pending.writes.map { $0.path } == [shardPathForProfile("sam.ben")])
+    }
+
+    func testChangesStayPendingUntilMarkedWritten() {
+        let profiles = TestProfiles(documentsPath: directory)
+        profiles.addProfile(name: "sam.ada")
+        let pending = profiles.pendingWrites()
+        XCTAssertEqual(pending.writes.count, 2)
+
+        // a save that was collected but never written is collected again
+        XCTAssertEqual(profiles.pendingWrites().writes.count, 2)
+        XCTAssertTrue(TestProfiles.performWrites(pending))
+
+        // a change made while the write was in flight stays dirty after it is marked written
+        passHearing(profiles, profileName: "sam.ada")
+        profiles.markWritten(pending)
+        XCTAssertTrue(profiles.pendingWrites().writes.map { $0.path } == [shardPathForProfile("sam.ada")])
+
+        let again = profiles.pendingWrites()
+        XCTAssertTrue(TestProfiles.performWrites(again))
+        profiles.markWritten(again)
+        XCTAssertTrue(profiles.pendingWrites().writes.isEmpty)
+    }
+
+    func testRemovedProfileShardIsDeleted() {
+        writeStore()
+        let profiles = TestProfiles(documentsPath: directory)
+        profiles.loadArchive()
+        let path = shardPathForProfile("sam.ben")
+        profiles.removeProfile("sam.ben")
+        let pending = profiles.pendingWrites()
+        XCTAssertTrue(pending.deletions == [path])
+        XCTAssertTrue(TestProfiles.performWrites(pending))
+        profiles.markWritten(pending)
+
+        XCTAssertFalse(NSFileManager.defaultManager().fileExistsAtPath(path))
+        XCTAssertTrue(profiles.pendingWrites().deletions.isEmpty)
+        let reloaded = TestProfiles(documentsPath: directory)
+        reloaded.loadArchive()
+        XCTAssertNil(reloaded.getTestHistories(profileName: "sam.ben"))
+    }
+
+    func testUnreadableShardIsNeverOverwritten() {
+        writeStore()
+        let path = shardPathForProfile("sam.ada")
+        let saved = NSData(contentsOfFile: path)!
+        let garbage = "not a shard".dataUsingEncoding(NSUTF8StringEncoding)!
+        garbage.writeToFile(path, atomically: true)
+
+        let profiles = TestProfiles(documentsPath: directory)
+        profiles.loadArchive(preloadProfileName: "sam.ada")
+        XCTAssertNil(profiles.getTestHistories(profileName: "sam.ada"))
+        profiles.addProfile(name: "sam.ada")
+        XCTAssertNil(profiles.getTestHistories(profileName: "sam.ada"))
+        XCTAssertNil(profiles.getTest("sam.ada", testName: Test.TestNames.hearing).profileName)
+        XCTAssertTrue(profiles.pendingWrites().writes.isEmpty)
+        XCTAssertEqual(NSData(contentsOfFile: path), garbage)
+
+        // once the shard can be read again the profile is decoded from it
+        saved.writeToFile(path, atomically: true)
+        XCTAssertEqual(profiles.getTest("sam.ada", testName: Test.TestNames.hearing).history.countOfSuccessfulTests, 1)
+    }
+}
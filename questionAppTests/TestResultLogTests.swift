@@ -0,0 +1,177 @@
+//
+//  TestResultLogTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+
+class TestResultLogTests: XCTestCase {
+
+    var directory: String!
+
+    let birthday = NSDate(timeIntervalSinceReferenceDate: 400000000)
+
+    override func setUp() {
+        super.setUp()
+        directory = (NSTemporaryDirectory() as NSString).stringByAppendingPathComponent(NSUUID().UUIDString)
+    }
+
+    override func tearDown() {
+        _ = try? NSFileManager.defaultManager().removeItemAtPath(directory)
+        super.tearDown()
+    }
+
+    /* A fresh instance on the test's log file, so nothing is served from another instance's memory. */
+    func makeLog() -> TestResultLog {
+        return TestResultLog(profileName: "sam.ada", directoryPath: directory)
+    }
+
+    func dateAtMonth(month: Double) -> NSDate {
+        return birthday.dateByAddingTimeInterval(month * TestResultLog.SecondsInAMonth)
+    }
+
+    /* The bytes of one record, written the way the log lays them out on disk. */
+    func rawRecord(month month: Double, testId: UInt16, succeeded: Bool) -> NSData {
+        let data = NSMutableData()
+        var bits = unsafeBitCast(dateAtMonth(month).timeIntervalSinceReferenceDate, UInt64.self).littleEndian
+        var id = testId.littleEndian
+        var outcome: UInt8 = succeeded ? 1 : 0
+        data.appendBytes(&bits, length: 8)
+        data.appendBytes(&id, length: 2)
+        data.appendBytes(&outcome, length: 1)
+        data.appendData(NSMutableData(length: 5)!)
+        return data
+    }
+
+    func appendRaw(data: NSData, toLog log: TestResultLog) {
+        let handle = NSFileHandle(forWritingAtPath: log.filePath)!
+        handle.seekToEndOfFile()
+        handle.writeData(data)
+        handle.closeFile()
+    }
+
+    func fileLength(path: String) -> Int {
+        return (try? NSFileManager.defaultManager().attributesOfItemAtPath(path)[NSFileSize] as! NSNumber)?.integerValue ?? -1
+    }
+
+    func testAppendWritesOneRecordPerAttempt() {
+        let log = makeLog()
+        XCTAssertTrue(log.append(testName: Test.TestNames.hearing, succeeded: false, date: dateAtMonth(1)))
+        XCTAssertTrue(log.append(testName: Test.TestNames.symmetry, succeeded: true, date: dateAtMonth(2)))
+        XCTAssertFalse(log.append(testName: "not a test", succeeded: true, date: dateAtMonth(3)))
+        XCTAssertEqual(fileLength(log.filePath), TestResultLog.headerSize + 2 * TestResultLog.recordSize)
+
+        let records = makeLog().records(testName: nil, from: nil, to: nil)
+        XCTAssertEqual(records.count, 2)
+        XCTAssertEqual(records[0].testName, Test.TestNames.hearing)
+        XCTAssertEqual(records[0].date, dateAtMonth(1))
+        XCTAssertFalse(records[0].succeeded)
+        XCTAssertEqual(records[1].testName, Test.TestNames.symmetry)
+        XCTAssertTrue(records[1].succeeded)
+    }
+
+    func testOutOfOrderDatesAreClampedSoTheLogStaysSorted() {
+        let log = makeLog()
+        log.append(testName: Test.TestNames.hearing, succeeded: false, date: dateAtMonth(5))
+        log.append(testName: Test.TestNames.hearing, succeeded: true, date: dateAtMonth(4))
+        let records = log.records(testName: nil, from: nil, to: nil)
+        XCTAssertEqual(records[1].date, dateAtMonth(5))
+    }
+
+    func testRangeQueriesByTest() {
+        let log = makeLog()
+        for month in 0..<12 {
+            log.append(testName: month % 2 == 0 ? Test.TestNames.hearing : Test.TestNames.symmetry, succeeded: month >= 8, date: dateAtMonth(Double(month)))
+        }
+
+        let hearing = log.records(testName: Test.TestNames.hearing, from: dateAtMonth(3), to: dateAtMonth(8))
+        XCTAssertTrue(hearing.map { $0.date } == [dateAtMonth(4), dateAtMonth(6)])
+        XCTAssertEqual(log.records(testName: Test.TestNames.symmetry, from: nil, to: nil).count, 6)
+        XCTAssertEqual(log.records(testName: Test.TestNames.pincer, from: nil, to: nil).count, 0)
+
+        // appends after the per-test index is built are included
+        log.append(testName: Test.TestNames.hearing, succeeded: true, date: dateAtMonth(12))
+        XCTAssertEqual(log.records(testName: Test.TestNames.hearing, from: dateAtMonth(10), to: nil).count, 2)
+
+        let counts = log.outcomeCounts(testNames: [Test.TestNames.symmetry], from: nil, to: nil)
+        XCTAssertEqual(counts.passed, 2)
+        XCTAssertEqual(counts.failed, 4)
+    }
+
+    func testRangeQueriesByAgeWindow() {
+        let log = makeLog()
+        for month in [1.0, 2.0, 3.0, 4.0] {
+            log.append(testName: Test.TestNames.hearing, succeeded: month >= 3, date: dateAtMonth(month))
+        }
+
+        // the start of the window is inclusive, the end exclusive
+        let records = log.records(testName: nil, birthday: birthday, fromMonth: 2, toMonth: 4)
+        XCTAssertTrue(records.map { $0.date } == [dateAtMonth(2), dateAtMonth(3)])
+        XCTAssertEqualWithAccuracy(log.ageInMonthsOfFirstSuccess(testName: Test.TestNames.hearing, birthday: birthday)!, 3, accuracy: 0.0001)
+        XCTAssertNil(log.ageInMonthsOfFirstSuccess(testName: Test.TestNames.symmetry, birthday: birthday))
+    }
+
+    func testCompactionRebuildsHistoriesAndDropsUnreadableRecords() {
+        let log = makeLog()
+        log.append(testName: Test.TestNames.hearing, succeeded: false, date: dateAtMonth(1))
+        log.append(testName: Test.TestNames.hearing, succeeded: true, date: dateAtMonth(2))
+        log.append(testName: Test.TestNames.symmetry, succeeded: false, date: dateAtMonth(3))
+        appendRaw(rawRecord(month: 4, testId: UInt16(TestResultLog.testIds.count + 1), succeeded: true), toLog: log)
+        appendRaw(rawRecord(month: 5, testId: 1, succeeded: true).subdataWithRange(NSRange(location: 0, length: 7)), toLog: log)
+
+        let histories = TestHistories()
+        let compacted = makeLog()
+        XCTAssertTrue(compacted.compact(histories: histories))
+        XCTAssertEqual(fileLength(compacted.filePath), TestResultLog.headerSize + 3 * TestResultLog.recordSize)
+
+        let hearing = histories.getTestHistory(testName: Test.TestNames.hearing)
+        XCTAssertEqual(hearing.countOfCompletedTests, 2)
+        XCTAssertEqual(hearing.countOfSuccessfulTests, 1)
+        XCTAssertEqual(hearing.countOfFailedTests, 1)
+        XCTAssertEqual(hearing.mostRecentTestDate, dateAtMonth(2))
+        XCTAssertEqual(hearing.succeededTestDate, dateAtMonth(2))
+        XCTAssertEqual(histories.getTestHistory(testName: Test.TestNames.symmetry).countOfFailedTests, 1)
+        XCTAssertEqual(compacted.records(testName: nil, from: nil, to: nil).count, 3)
+    }
+
+    func testCompactionKeepsCountsFromBeforeTheLog() {
+        let log = makeLog()
+        log.append(testName: Test.TestNames.hearing, succeeded: true, date: dateAtMonth(1))
+
+        let histories = TestHistories()
+        histories.getTestHistory(testName: Test.TestNames.hearing).countOfCompletedTests = 5
+        XCTAssertTrue(log.compact(histories: histories))
+        XCTAssertEqual(histories.getTestHistory(testName: Test.TestNames.hearing).countOfCompletedTests, 5)
+    }
+
+    func testUnknownLogIsMovedAsideAndNotTruncated() {
+        try! NSFileManager.defaultManager().createDirectoryAtPath(directory, withIntermediateDirectories: true, attributes: nil)
+        let log = makeLog()
+        let unknown = NSMutableData(bytes: [0x42, 0x4E, 0x52, 0x4C, 0x02, 0x00, 0x10, 0x00] as [UInt8], length: 8)
+        unknown.appendData(rawRecord(month: 1, testId: 1, succeeded: true))
+        unknown.writeToFile(log.filePath, atomically: true)
+
+        XCTAssertEqual(log.records(testName: nil, from: nil, to: nil).count, 0)
+        let asidePath = log.filePath + ".unrecognized"
+        XCTAssertEqual(NSData(contentsOfFile: asidePath), unknown as NSData)
+
+        // the next append starts a new log
+        XCTAssertTrue(log.append(testName: Test.TestNames.hearing, succeeded: true, date: dateAtMonth(2)))
+        XCTAssertEqual(makeLog().records(testName: nil, from: nil, to: nil).count, 1)
+    }
+
+    func testCorruptLogIsNotRead() {
+        try! NSFileManager.defaultManager().createDirectoryAtPath(directory, withIntermediateDirectories: true, attributes: nil)
+        let log = makeLog()
+        NSData(bytes: [0x00, 0x01, 0x02] as [UInt8], length: 3).writeToFile(log.filePath, atomically: true)
+
+        XCTAssertEqual(log.records(testName: Test.TestNames.hearing, from: nil, to: nil).count, 0)
+        XCTAssertTrue(NSFileManager.defaultManager().fileExistsAtPath(log.filePath + ".unrecognized"))
+        XCTAssertTrue(log.append(testName: Test.TestNames.hearing, succeeded: false, date: dateAtMonth(1)))
+        XCTAssertEqual(fileLength(log.filePath), TestResultLog.headerSize + TestResultLog.recordSize)
+    }
+}
@@ -0,0 +1,81 @@
+//
+//  TrackerTests.swift
+//  questionAppTests
+//
+//  Copyright (c) 2015 codeHatcher. All rights reserved.
+//
+
+import UIKit
+import XCTest
+@testable import questionApp
+
+class TrackerTests: XCTestCase {
+
+    var savedDeliver: (([Tracker.Payload], [NSTimeInterval]) -> Void)!
+
+    override func setUp() {
+        super.setUp()
+        // never send test events to Mixpanel
+        savedDeliver = Tracker.deliver
+        Tracker.deliver = { _, _ in }
+        Tracker.flush()
+    }
+
+    override func tearDown() {
+        Tracker.flush()
+        Tracker.deliver = savedDeliver
+        super.tearDown()
+    }
+
+    func testPayloadMatchesLegacyFormat() {
+        let payload = Tracker.payload(Tracker.Event(name: .Hearing, action: .Load, progress: .Why))
+        XCTAssertEqual(payload.sentence, "Hearing Load in why is?")
+        XCTAssertEqual(payload.properties["name"] as? String, "Hearing")
+        XCTAssertEqual(payload.properties["action"] as? String, "Load")
+        XCTAssertEqual(payload.properties["progress"] as? String, "why is?")
+    }
+
+    func testEventsAreDeliveredInBatches() {
+        let expectation = expectationWithDescription("batch delivered")
+        var sentences = [String]()
+        Tracker.deliver = { payloads, times in
+            XCTAssertEqual(payloads.count, times.count)
+            sentences += payloads.map { $0.sentence }
+            expectation.fulfill()
+        }
+
+        Tracker.createEvent(.Milestone, .Load)
+        Tracker.createEvent(.Hearing, .Tapped, .TimeToTest)
+        // nothing is handed to the SDK until the batch is flushed
+        XCTAssertTrue(sentences.isEmpty)
+        Tracker.flush()
+
+        waitForExpectationsWithTimeout(1, handler: nil)
+        XCTAssertEqual(sentences, ["Milestone Load in ", "Hearing Tapped in time to test"])
+    }
+
+    // MARK: Per-event cost on the main thread.
+    // The legacy benchmark repeats what createEvent did before batching, without the SDK call itself.
+
+    static let eventsPerMeasurement = 1000
+
+    func testPerformanceCreateEvent() {
+        self.measureBlock() {
+            for _ in 0..<TrackerTests.eventsPerMeasurement {
+                Tracker.createEvent(.Hearing, .Load, .WhatDidSee)
+            }
+            Tracker.flush()
+        }
+    }
+
+    func testPerformanceLegacyCreateEvent() {
+        self.measureBlock() {
+            for _ in 0..<TrackerTests.eventsPerMeasurement {
+                let event = (name: Tracker.Name.Hearing.rawValue, action: Tracker.Action.Load.rawValue, progress: Tracker.Progress.WhatDidSee.rawValue)
+                let sentence = "\(event.name) \(event.action) in \(event.progress)"
+                let properties = ["name": event.name, "action": event.action, "progress": event.progress]
+                XCTAssertFalse(sentence.isEmpty || properties.isEmpty)
+            }
+        }
+    }
+}
@@ -22,6 +22,9 @@ public protocol ChartAnimatorDelegate
     
     /// Called when the Animator has stopped.
     func chartAnimatorStopped(chartAnimator: ChartAnimator)
+    
+    /// Called when a paced animation has missed display refreshes, with the number of frames it dropped since the last step.
+    optional func chartAnimator(chartAnimator: ChartAnimator, droppedFrames count: Int)
 }
 
 public class ChartAnimator: NSObject
@@ -52,6 +55,30 @@ public class ChartAnimator: NSObject
     private var _easingX: ChartEasingFunctionBlock?
     private var _easingY: ChartEasingFunctionBlock?
     
+    /// if true, animations started from now on are paced: the display link skips refreshes while the chart cannot draw a frame
+    /// in time, and goes back to the full frame rate once it can. Dropped frames are reported to the delegate.
+    /// During a paced animation bar-line charts only redraw their data layer, and line charts interpolate between pixel positions
+    /// computed once instead of transforming every entry on every step.
+    /// **default**: false
+    public var pacedAnimationEnabled = false
+    
+    /// the slowest a paced animation may step, in display refreshes per step
+    /// **default**: 4 (15 fps on a 60 Hz display)
+    public var maximumFrameInterval = 4
+    
+    /// the number of frames the current (or last) paced animation has dropped
+    public private(set) var droppedFrameCount = 0
+    
+    /// the number of display refreshes per step of the current paced animation
+    public private(set) var frameInterval = 1
+    
+    /// the number of steps on time after which a paced animation tries a faster frame rate again
+    internal static let recoveryFrames = 30
+    
+    private var _pacing = false
+    private var _lastTimestamp: CFTimeInterval = 0.0
+    private var _framesOnTime = 0
+    
     public override init()
     {
         super.init()
@@ -62,6 +89,12 @@ public class ChartAnimator: NSObject
         stop()
     }
     
+    /// - returns: true if pacedAnimationEnabled is enabled
+    public var isPacedAnimationEnabled: Bool { return pacedAnimationEnabled }
+    
+    /// - returns: true while a paced animation is running
+    public var isPacing: Bool { return _pacing && _displayLink != nil }
+    
     public func stop()
     {
         if (_displayLink != nil)
@@ -71,6 +104,7 @@ public class ChartAnimator: NSObject
             
             _enabledX = false
             _enabledY = false
+            _pacing = false
             
             if (delegate != nil)
             {
@@ -124,10 +158,62 @@ public class ChartAnimator: NSObject
         }
     }
     
+    /// Counts the refreshes missed since the previous step of a paced animation, and adapts the frame interval to them:
+    /// one refresh slower after a step came late, one refresh faster after `recoveryFrames` steps on time.
+    /// - parameter timestamp: the display link's timestamp of this step
+    /// - parameter refreshDuration: the time between two display refreshes
+    internal func paceFrame(timestamp timestamp: CFTimeInterval, refreshDuration: CFTimeInterval)
+    {
+        defer { _lastTimestamp = timestamp }
+        
+        if (_lastTimestamp <= 0.0 || refreshDuration <= 0.0)
+        {
+            return
+        }
+        
+        let late = (timestamp - _lastTimestamp) / refreshDuration - Double(frameInterval)
+        let dropped = Int(round(late))
+        
+        if (dropped > 0)
+        {
+            droppedFrameCount += dropped
+            _framesOnTime = 0
+            
+            if (frameInterval < maximumFrameInterval)
+            {
+                frameInterval++
+            }
+            
+            if (delegate != nil)
+            {
+                delegate!.chartAnimator?(self, droppedFrames: dropped)
+            }
+        }
+        else if (++_framesOnTime >= ChartAnimator.recoveryFrames)
+        {
+            _framesOnTime = 0
+            
+            if (frameInterval > 1)
+            {
+                frameInterval--
+            }
+        }
+        
+        if (_displayLink != nil)
+        {
+            _displayLink.frameInterval = frameInterval
+        }
+    }
+    
     @objc private func animationLoop()
     {
         let currentTime: NSTimeInterval = CACurrentMediaTime()
         
+        if (_pacing)
+        {
+            paceFrame(timestamp: _displayLink.timestamp, refreshDuration: _displayLink.duration)
+        }
+        
         updateAnimationPhases(currentTime)
         
         if (delegate != nil)
@@ -169,6 +255,12 @@ public class ChartAnimator: NSObject
         _easingX = easingX
         _easingY = easingY
         
+        _pacing = pacedAnimationEnabled && (_enabledX || _enabledY)
+        _lastTimestamp = 0.0
+        _framesOnTime = 0
+        droppedFrameCount = 0
+        frameInterval = 1
+        
         // Take care of the first frame if rendering is already scheduled...
         updateAnimationPhases(_startTime)
         
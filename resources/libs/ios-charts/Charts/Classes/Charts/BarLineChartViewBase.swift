@@ -35,15 +35,58 @@ public class BarLineChartViewBase: ChartViewBase, UIGestureRecognizerDelegate
     
     /// the color for the background of the chart-drawing area (everything behind the grid lines).
     public var gridBackgroundColor = UIColor(red: 240/255.0, green: 240/255.0, blue: 240/255.0, alpha: 1.0)
+    {
+        didSet
+        {
+            invalidateStaticLayers()
+        }
+    }
     
     public var borderColor = UIColor.blackColor()
+    {
+        didSet
+        {
+            invalidateStaticLayers()
+        }
+    }
+    
     public var borderLineWidth: CGFloat = 1.0
+    {
+        didSet
+        {
+            invalidateStaticLayers()
+        }
+    }
     
     /// flag indicating if the grid background should be drawn or not
     public var drawGridBackgroundEnabled = true
+    {
+        didSet
+        {
+            invalidateStaticLayers()
+        }
+    }
     
     /// Sets drawing the borders rectangle to true. If this is enabled, there is no point drawing the axis-lines of x- and y-axis.
     public var drawBordersEnabled = false
+    {
+        didSet
+        {
+            invalidateStaticLayers()
+        }
+    }
+    
+    /// If enabled, grid, axes, limit lines, legend and description are drawn into cached images that are only redrawn
+    /// when the data, the viewport or the axis ranges change, or after `invalidateStaticLayers()`.
+    /// Animation frames and highlight changes then only redraw the data, highlights, values and markers.
+    /// Partial redraws of paced animations use the cached images even when this is disabled.
+    public var staticLayerCachingEnabled = false
+    {
+        didSet
+        {
+            invalidateStaticLayers()
+        }
+    }
     
     /// the object representing the labels on the y-axis, this object is prepared
     /// in the pepareYLabels() method
@@ -133,32 +176,74 @@ public class BarLineChartViewBase: ChartViewBase, UIGestureRecognizerDelegate
         
         let context = UIGraphicsGetCurrentContext()
         
-        calcModulus()
+        prepareForDrawing()
         
-        if (_xAxisRenderer !== nil)
+        // A partial redraw only invalidates the data layer (see `chartAnimatorUpdated`), so draw grid, axes, legend
+        // and description from the static layers instead of running their renderers again for every frame.
+        let drawsStaticLayersFromCache = staticLayerCachingEnabled || !CGRectContainsRect(rect, self.bounds)
+        
+        // execute all drawing commands
+        
+        if (drawsStaticLayersFromCache)
         {
-            _xAxisRenderer!.calcXBounds(chart: self, xAxisModulus: _xAxis.axisLabelModulus)
+            updateStaticLayers()
+            _staticBackgroundImage?.drawInRect(self.bounds)
         }
-        if (renderer !== nil)
+        else
         {
-            renderer!.calcXBounds(chart: self, xAxisModulus: _xAxis.axisLabelModulus)
+            // the static layers are only kept for partial redraws, release them
+            invalidateStaticLayers()
+            drawStaticBackground(context: context)
         }
-
-        // execute all drawing commands
-        drawGridBackground(context: context)
         
-        if (_leftAxis.isEnabled)
+        // make sure the graph values cannot be drawn outside the content-rect
+        CGContextSaveGState(context)
+        CGContextClipToRect(context, _viewPortHandler.contentRect)
+        
+        renderer?.drawData(context: context)
+        
+        CGContextRestoreGState(context)
+        
+        if (drawsStaticLayersFromCache)
         {
-            _leftYAxisRenderer?.computeAxis(yMin: _leftAxis.axisMinimum, yMax: _leftAxis.axisMaximum)
+            _staticForegroundImage?.drawInRect(self.bounds)
         }
-        if (_rightAxis.isEnabled)
+        else
         {
-            _rightYAxisRenderer?.computeAxis(yMin: _rightAxis.axisMinimum, yMax: _rightAxis.axisMaximum)
+            drawStaticForeground(context: context)
+        }
+
+        // if highlighting is enabled
+        if (valuesToHighlight())
+        {
+            CGContextSaveGState(context)
+            CGContextClipToRect(context, _viewPortHandler.contentRect)
+            
+            renderer?.drawHighlighted(context: context, indices: _indicesToHightlight)
+            
+            CGContextRestoreGState(context)
         }
         
-        _xAxisRenderer?.renderAxisLine(context: context)
-        _leftYAxisRenderer?.renderAxisLine(context: context)
-        _rightYAxisRenderer?.renderAxisLine(context: context)
+        renderer!.drawExtras(context: context)
+
+        renderer!.drawValues(context: context)
+
+        drawMarkers(context: context)
+    }
+    
+    /// Updates what drawing depends on for the current viewport: label modulus, visible x-range and, with autoscaling, the y-axis range.
+    internal func prepareForDrawing()
+    {
+        calcModulus()
+        
+        if (_xAxisRenderer !== nil)
+        {
+            _xAxisRenderer!.calcXBounds(chart: self, xAxisModulus: _xAxis.axisLabelModulus)
+        }
+        if (renderer !== nil)
+        {
+            renderer!.calcXBounds(chart: self, xAxisModulus: _xAxis.axisLabelModulus)
+        }
 
         if (_autoScaleMinMaxEnabled)
         {
@@ -175,10 +260,30 @@ public class BarLineChartViewBase: ChartViewBase, UIGestureRecognizerDelegate
                 _autoScaleLastHighestVisibleXIndex = highestVisibleXIndex
             }
         }
+    }
+    
+    /// Draws everything behind the data that only depends on data, viewport and style: grid background, axis lines,
+    /// limit lines drawn behind the data and grid lines.
+    internal func drawStaticBackground(context context: CGContext?)
+    {
+        drawGridBackground(context: context)
         
-        // make sure the graph values and grid cannot be drawn outside the content-rect
+        if (_leftAxis.isEnabled)
+        {
+            _leftYAxisRenderer?.computeAxis(yMin: _leftAxis.axisMinimum, yMax: _leftAxis.axisMaximum)
+        }
+        if (_rightAxis.isEnabled)
+        {
+            _rightYAxisRenderer?.computeAxis(yMin: _rightAxis.axisMinimum, yMax: _rightAxis.axisMaximum)
+        }
+        
+        _xAxisRenderer?.renderAxisLine(context: context)
+        _leftYAxisRenderer?.renderAxisLine(context: context)
+        _rightYAxisRenderer?.renderAxisLine(context: context)
+        
+        // make sure the grid cannot be drawn outside the content-rect
         CGContextSaveGState(context)
-
+        
         CGContextClipToRect(context, _viewPortHandler.contentRect)
         
         if (_xAxis.isDrawLimitLinesBehindDataEnabled)
@@ -198,7 +303,16 @@ public class BarLineChartViewBase: ChartViewBase, UIGestureRecognizerDelegate
         _leftYAxisRenderer?.renderGridLines(context: context)
         _rightYAxisRenderer?.renderGridLines(context: context)
         
-        renderer?.drawData(context: context)
+        CGContextRestoreGState(context)
+    }
+    
+    /// Draws everything in front of the data that only depends on data, viewport and style: limit lines drawn in front
+    /// of the data, axis labels, legend and description.
+    internal func drawStaticForeground(context context: CGContext?)
+    {
+        CGContextSaveGState(context)
+        
+        CGContextClipToRect(context, _viewPortHandler.contentRect)
         
         if (!_xAxis.isDrawLimitLinesBehindDataEnabled)
         {
@@ -212,32 +326,132 @@ public class BarLineChartViewBase: ChartViewBase, UIGestureRecognizerDelegate
         {
             _rightYAxisRenderer?.renderLimitLines(context: context)
         }
-
-        // if highlighting is enabled
-        if (valuesToHighlight())
-        {
-            renderer?.drawHighlighted(context: context, indices: _indicesToHightlight)
-        }
-
-        // Removes clipping rectangle
-        CGContextRestoreGState(context)
         
-        renderer!.drawExtras(context: context)
+        CGContextRestoreGState(context)
         
         _xAxisRenderer.renderAxisLabels(context: context)
         _leftYAxisRenderer.renderAxisLabels(context: context)
         _rightYAxisRenderer.renderAxisLabels(context: context)
+        
+        _legendRenderer.renderLegend(context: context)
+        
+        drawDescription(context: context)
+    }
+    
+    // MARK: - Static layers
+    
+    /// the cached drawings of `drawStaticBackground` and `drawStaticForeground`, nil when invalidated
+    internal var _staticBackgroundImage: UIImage?
+    internal var _staticForegroundImage: UIImage?
+    
+    /// what the static layers were drawn for, see `staticLayersKey()`
+    private var _staticLayersKey = [Double]()
+    
+    /// Drops the cached static layers, so the next redraw draws grid, axes, limit lines, legend and description again.
+    /// Call this after changing the style of an axis, the legend or the description while static layer caching is enabled,
+    /// unless `notifyDataSetChanged()` is called anyway. Viewport changes are picked up by themselves.
+    public func invalidateStaticLayers()
+    {
+        _staticBackgroundImage = nil
+        _staticForegroundImage = nil
+    }
+    
+    /// - returns: everything the static layers depend on besides style: size, viewport, axis ranges and label spacing
+    private func staticLayersKey() -> [Double]
+    {
+        let touchMatrix = _viewPortHandler.touchMatrix
+        let contentRect = _viewPortHandler.contentRect
+        
+        return [
+            Double(self.bounds.width), Double(self.bounds.height), Double(self.contentScaleFactor),
+            Double(touchMatrix.a), Double(touchMatrix.b), Double(touchMatrix.c), Double(touchMatrix.d), Double(touchMatrix.tx), Double(touchMatrix.ty),
+            Double(contentRect.origin.x), Double(contentRect.origin.y), Double(contentRect.width), Double(contentRect.height),
+            _leftAxis.axisMinimum, _leftAxis.axisMaximum, _rightAxis.axisMinimum, _rightAxis.axisMaximum,
+            _chartXMin, Double(_deltaX), Double(_xAxis.axisLabelModulus)]
+    }
+    
+    /// Redraws the static layers if they were invalidated or anything they depend on changed.
+    private func updateStaticLayers()
+    {
+        let key = staticLayersKey()
+        
+        if (_staticBackgroundImage != nil && _staticForegroundImage != nil && key == _staticLayersKey)
+        {
+            return
+        }
+        
+        _staticBackgroundImage = drawStaticLayer { self.drawStaticBackground(context: $0) }
+        _staticForegroundImage = drawStaticLayer { self.drawStaticForeground(context: $0) }
+        _staticLayersKey = key
+    }
+    
+    /// - returns: the static layers for the current viewport, from the cache when static layer caching is enabled
+    internal func staticLayerImages() -> (background: UIImage?, foreground: UIImage?)
+    {
+        if (staticLayerCachingEnabled)
+        {
+            updateStaticLayers()
+            return (_staticBackgroundImage, _staticForegroundImage)
+        }
+        
+        return (drawStaticLayer { self.drawStaticBackground(context: $0) }, drawStaticLayer { self.drawStaticForeground(context: $0) })
+    }
+    
+    /// - returns: an image the size of the view, with what `drawing` draws into its context
+    private func drawStaticLayer(drawing: (CGContext?) -> Void) -> UIImage?
+    {
+        UIGraphicsBeginImageContextWithOptions(self.bounds.size, false, self.contentScaleFactor)
+        drawing(UIGraphicsGetCurrentContext())
+        let image = UIGraphicsGetImageFromCurrentImageContext()
+        UIGraphicsEndImageContext()
+        
+        return image
+    }
+    
+    public override func chartSnapshot(transparent transparent: Bool) -> ChartSnapshot?
+    {
+        if (_dataNotSet || !BarLineChartSnapshot.canSnapshot(self))
+        {
+            return nil
+        }
+        
+        return BarLineChartSnapshot(chart: self, transparent: transparent)
+    }
 
-        renderer!.drawValues(context: context)
+    /// During a paced animation only the data layer is invalidated. `drawRect` then draws axis labels, legend and description
+    /// from the static layers, whether or not `staticLayerCachingEnabled` is set.
+    public override func chartAnimatorUpdated(chartAnimator: ChartAnimator)
+    {
+        if (chartAnimator.isPacing && !(drawMarkers && marker !== nil && valuesToHighlight()))
+        {
+            setNeedsDisplayInRect(dataLayerRect)
+        }
+        else
+        {
+            super.chartAnimatorUpdated(chartAnimator)
+        }
+    }
 
-        _legendRenderer.renderLegend(context: context)
-        // drawLegend()
+    /// the part of the chart the renderer draws into: the content rect across the full width,
+    /// grown vertically by the space values and circles drawn at its edges take.
+    internal var dataLayerRect: CGRect
+    {
+        var margin = CGFloat(0.0)
 
-        drawMarkers(context: context)
+        if let dataSets = _data?.dataSets
+        {
+            for set in dataSets
+            {
+                let circleDiameter = ((set as? LineChartDataSet)?.circleRadius ?? 0.0) * 2.0
+                margin = max(margin, set.valueFont.lineHeight + max(circleDiameter, 4.5) + 1.0)
+            }
+        }
 
-        drawDescription(context: context)
+        let contentRect = _viewPortHandler.contentRect
+
+        return CGRect(x: self.bounds.minX, y: contentRect.minY - margin, width: self.bounds.width, height: contentRect.height + margin * 2.0)
     }
-    
+
     internal func prepareValuePxMatrix()
     {
         _rightAxisTransformer.prepareMatrixValuePx(chartXMin: _chartXMin, deltaX: _deltaX, deltaY: CGFloat(_rightAxis.axisRange), chartYMin: _rightAxis.axisMinimum)
@@ -274,6 +488,10 @@ public class BarLineChartViewBase: ChartViewBase, UIGestureRecognizerDelegate
         
         calculateOffsets()
         
+        invalidateStaticLayers()
+        
+        _highlighter?.invalidateIndex()
+        
         setNeedsDisplay()
     }
     
@@ -1346,6 +1564,13 @@ public class BarLineChartViewBase: ChartViewBase, UIGestureRecognizerDelegate
         return drawBordersEnabled
     }
     
+    /// **default**: false
+    /// - returns: true if grid, axes, limit lines, legend and description are cached between redraws, false if not.
+    public var isStaticLayerCachingEnabled: Bool
+    {
+        return staticLayerCachingEnabled
+    }
+    
     /// - returns: the Highlight object (contains x-index and DataSet index) of the selected value at the given touch point inside the Line-, Scatter-, or CandleStick-Chart.
     public func getHighlightByTouchPoint(pt: CGPoint) -> ChartHighlight?
     {
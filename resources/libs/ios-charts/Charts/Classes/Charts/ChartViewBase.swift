@@ -32,6 +32,9 @@ public protocol ChartViewDelegate
     
     // Callbacks when the chart is moved / translated via drag gesture.
     optional func chartTranslated(chartView: ChartViewBase, dX: CGFloat, dY: CGFloat)
+    
+    // Called when a paced animation has dropped frames (see `ChartAnimator.pacedAnimationEnabled`).
+    optional func chartAnimationDroppedFrames(chartView: ChartViewBase, count: Int)
 }
 
 public class ChartViewBase: UIView, ChartAnimatorDelegate
@@ -769,6 +772,69 @@ public class ChartViewBase: UIView, ChartAnimatorDelegate
         case PNG
     }
     
+    /// - returns: a copy of the chart's data, viewport and style that renders the chart on any thread (see `ChartSnapshot`),
+    /// or nil if there is no data or this chart type only draws through its view.
+    public func chartSnapshot(transparent transparent: Bool) -> ChartSnapshot?
+    {
+        return nil
+    }
+    
+    /// Encodes the chart like `saveToPath`, without rendering or encoding on the main thread:
+    /// the chart is copied now and rendered on a background queue, so later changes to the chart do not show up in the image.
+    /// Charts without snapshot support (see `chartSnapshot(transparent:)`) are drawn now and only encoded in the background.
+    ///
+    /// - parameter completion: called on the main queue with the encoded image, or nil if encoding failed
+    public func getChartImageData(format format: ImageFormat, compressionQuality: Double, completion: (NSData?) -> Void)
+    {
+        encodeChartImage(format: format, compressionQuality: compressionQuality) { imageData in
+            dispatch_async(dispatch_get_main_queue()) {
+                completion(imageData)
+            }
+        }
+    }
+    
+    /// Saves the chart like `saveToPath(_:format:compressionQuality:)`, rendering, encoding and writing on a background queue.
+    ///
+    /// - parameter completion: called on the main queue with true if the image was saved successfully
+    public func saveToPath(path: String, format: ImageFormat, compressionQuality: Double, completion: ((Bool) -> Void)?)
+    {
+        encodeChartImage(format: format, compressionQuality: compressionQuality) { imageData in
+            let saved = imageData?.writeToFile(path, atomically: true) ?? false
+            
+            if (completion != nil)
+            {
+                dispatch_async(dispatch_get_main_queue()) {
+                    completion!(saved)
+                }
+            }
+        }
+    }
+    
+    /// Takes a snapshot of the chart, or draws it if it has no snapshot support, and calls `encoded` on `ChartSnapshot.renderQueue`
+    /// with the rendered and encoded image.
+    private func encodeChartImage(format format: ImageFormat, compressionQuality: Double, encoded: (NSData?) -> Void)
+    {
+        let transparent = format != .JPEG
+        let snapshot = chartSnapshot(transparent: transparent)
+        let image: UIImage? = snapshot === nil ? getChartImage(transparent: transparent) : nil
+        
+        dispatch_async(ChartSnapshot.renderQueue) {
+            encoded(ChartViewBase.encodeImage(snapshot?.renderImage() ?? image!, format: format, compressionQuality: compressionQuality))
+        }
+    }
+    
+    private static func encodeImage(image: UIImage, format: ImageFormat, compressionQuality: Double) -> NSData?
+    {
+        switch (format)
+        {
+        case .PNG:
+            return UIImagePNGRepresentation(image)
+            
+        case .JPEG:
+            return UIImageJPEGRepresentation(image, CGFloat(compressionQuality))
+        }
+    }
+    
     /// Saves the current chart state with the given name to the given path on
     /// the sdcard leaving the path empty "" will put the saved file directly on
     /// the SD card chart is saved as a PNG image, example:
@@ -783,19 +849,9 @@ public class ChartViewBase: UIView, ChartAnimatorDelegate
     {
         let image = getChartImage(transparent: format != .JPEG)
 
-        var imageData: NSData!
-        switch (format)
-        {
-        case .PNG:
-            imageData = UIImagePNGRepresentation(image)
-            break
-            
-        case .JPEG:
-            imageData = UIImageJPEGRepresentation(image, CGFloat(compressionQuality))
-            break
-        }
+        let imageData = ChartViewBase.encodeImage(image, format: format, compressionQuality: compressionQuality)
 
-        return imageData.writeToFile(path, atomically: true)
+        return imageData?.writeToFile(path, atomically: true) ?? false
     }
     
     /// Saves the current state of the chart to the camera roll
@@ -899,6 +955,11 @@ public class ChartViewBase: UIView, ChartAnimatorDelegate
         
     }
     
+    public func chartAnimator(chartAnimator: ChartAnimator, droppedFrames count: Int)
+    {
+        delegate?.chartAnimationDroppedFrames?(self, count: count)
+    }
+    
     // MARK: - Touches
     
     public override func touchesBegan(touches: Set<UITouch>, withEvent event: UIEvent?)
@@ -15,7 +15,7 @@ import Foundation
 import UIKit
 
 /// View that represents a pie chart. Draws cake like slices.
-public class PieChartView: PieRadarChartViewBase
+public class PieChartView: PieRadarChartViewBase, PieChartRendererDelegate
 {
     /// rect object that represents the bounds of the piechart, needed for drawing the circle
     private var _circleBox = CGRect()
@@ -40,7 +40,7 @@ public class PieChartView: PieRadarChartViewBase
     {
         super.initialize()
         
-        renderer = PieChartRenderer(chart: self, animator: _animator, viewPortHandler: _viewPortHandler)
+        renderer = PieChartRenderer(delegate: self, animator: _animator, viewPortHandler: _viewPortHandler)
     }
     
     public override func drawRect(rect: CGRect)
@@ -72,6 +72,16 @@ public class PieChartView: PieRadarChartViewBase
         drawMarkers(context: context)
     }
     
+    public override func chartSnapshot(transparent transparent: Bool) -> ChartSnapshot?
+    {
+        if (_dataNotSet)
+        {
+            return nil
+        }
+        
+        return PieChartSnapshot(chart: self, transparent: transparent)
+    }
+    
     internal override func calculateOffsets()
     {
         super.calculateOffsets()
@@ -502,4 +512,41 @@ public class PieChartView: PieRadarChartViewBase
             setNeedsDisplay()
         }
     }
+    
+    // MARK: - PieChartRendererDelegate
+    
+    public func pieChartRendererData(renderer: PieChartRenderer) -> ChartData!
+    {
+        return _data
+    }
+    
+    public func pieChartRendererCircleBox(renderer: PieChartRenderer) -> CGRect
+    {
+        return circleBox
+    }
+    
+    public func pieChartRendererRotationAngle(renderer: PieChartRenderer) -> CGFloat
+    {
+        return rotationAngle
+    }
+    
+    public func pieChartRendererDrawAngles(renderer: PieChartRenderer) -> [CGFloat]
+    {
+        return drawAngles
+    }
+    
+    public func pieChartRendererAbsoluteAngles(renderer: PieChartRenderer) -> [CGFloat]
+    {
+        return absoluteAngles
+    }
+    
+    public func pieChartDefaultRendererValueFormatter(renderer: PieChartRenderer) -> NSNumberFormatter!
+    {
+        return valueFormatter
+    }
+    
+    public func pieChartRenderer(renderer: PieChartRenderer, needsHighlightXIndex xIndex: Int, dataSetIndex: Int) -> Bool
+    {
+        return needsHighlight(xIndex: xIndex, dataSetIndex: dataSetIndex)
+    }
 }
\ No newline at end of file
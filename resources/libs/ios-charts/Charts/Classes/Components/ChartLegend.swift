@@ -129,7 +129,7 @@ public class ChartLegend: ChartComponentBase
                 continue
             }
             
-            let size = (labels[i] as NSString!).sizeWithAttributes([NSFontAttributeName: font])
+            let size = ChartTextCache.sharedCache.size(text: labels[i]!, attributes: [NSFontAttributeName: font])
             
             if (size.width > maxW)
             {
@@ -168,7 +168,7 @@ public class ChartLegend: ChartComponentBase
                     width += formSize + formToTextSpace
                 }
                 
-                let size = (labels[i] as NSString!).sizeWithAttributes([NSFontAttributeName: labelFont])
+                let size = ChartTextCache.sharedCache.size(text: labels[i]!, attributes: [NSFontAttributeName: labelFont])
                 
                 width += size.width
                 height += size.height
@@ -291,7 +291,7 @@ public class ChartLegend: ChartComponentBase
                 // grouped forms have null labels
                 if (labels[i] != nil)
                 {
-                    calculatedLabelSizes[i] = (labels[i] as NSString!).sizeWithAttributes(labelAttrs)
+                    calculatedLabelSizes[i] = ChartTextCache.sharedCache.size(text: labels[i]!, attributes: labelAttrs)
                     requiredWidth += drawingForm ? formToTextSpace + formSize : 0.0
                     requiredWidth += calculatedLabelSizes[i].width
                 }
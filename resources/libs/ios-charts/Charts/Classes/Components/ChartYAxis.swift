@@ -179,8 +179,8 @@ public class ChartYAxis: ChartAxisBase
     
     public func requiredSize() -> CGSize
     {
-        let label = getLongestLabel() as NSString
-        var size = label.sizeWithAttributes([NSFontAttributeName: labelFont])
+        let label = getLongestLabel()
+        var size = ChartTextCache.sharedCache.size(text: label, attributes: [NSFontAttributeName: labelFont])
         size.width += xOffset * 2.0
         size.height += yOffset * 2.0
         size.width = max(minWidth, min(size.width, maxWidth > 0.0 ? maxWidth : size.width))
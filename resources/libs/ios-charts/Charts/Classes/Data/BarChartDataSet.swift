@@ -36,14 +36,45 @@ public class BarChartDataSet: BarLineScatterCandleBubbleChartDataSet
     /// array of labels used to describe the different values of the stacked bars
     public var stackLabels: [String] = ["Stack"]
     
+    public required init()
+    {
+        super.init()
+        
+        self.highlightColor = UIColor.blackColor()
+    }
+    
     public override init(yVals: [ChartDataEntry]?, label: String?)
     {
         super.init(yVals: yVals, label: label)
         
         self.highlightColor = UIColor.blackColor()
         
-        self.calcStackSize(yVals as! [BarChartDataEntry]?)
-        self.calcEntryCountIncludingStacks(yVals as! [BarChartDataEntry]?)
+        let entries = yVals as? [BarChartDataEntry] ?? [BarChartDataEntry]()
+        self.calcStackSize(entries)
+        self.calcEntryCountIncludingStacks(entries)
+    }
+    
+    /// Columnar Bar DataSets hold plain bars, one value per x-index.
+    internal override func makeEntry(value value: Double, xIndex: Int) -> ChartDataEntry
+    {
+        return BarChartDataEntry(value: value, xIndex: xIndex)
+    }
+    
+    internal override func canStoreInColumns(e: ChartDataEntry) -> Bool
+    {
+        return super.canStoreInColumns(e) && (e as? BarChartDataEntry)?.values == nil
+    }
+    
+    public override func notifyDataSetChanged()
+    {
+        super.notifyDataSetChanged()
+        
+        if (isColumnar)
+        {
+            // the buffers hold no stacks
+            _stackSize = 1
+            _entryCountStacks = entryCount
+        }
     }
     
     // MARK: NSCopying
@@ -96,71 +127,23 @@ public class BarChartDataSet: BarLineScatterCandleBubbleChartDataSet
     }
     }
     
-    internal override func calcMinMax(start start : Int, end: Int)
+    /// Stacked entries reach from the sum of their negative values to the sum of their positive values.
+    internal override func entryYMin(e: ChartDataEntry) -> Double
     {
-        let yValCount = _yVals.count
-        
-        if yValCount == 0
+        if let e = e as? BarChartDataEntry where e.values != nil && !e.value.isNaN
         {
-            return
+            return -e.negativeSum
         }
-        
-        var endValue : Int
-        
-        if end == 0 || end >= yValCount
-        {
-            endValue = yValCount - 1
-        }
-        else
-        {
-            endValue = end
-        }
-        
-        _lastStart = start
-        _lastEnd = endValue
-        
-        _yMin = DBL_MAX
-        _yMax = -DBL_MAX
-        
-        for (var i = start; i <= endValue; i++)
-        {
-            if let e = _yVals[i] as? BarChartDataEntry
-            {
-                if !e.value.isNaN
-                {
-                    if e.values == nil
-                    {
-                        if e.value < _yMin
-                        {
-                            _yMin = e.value
-                        }
-                        
-                        if e.value > _yMax
-                        {
-                            _yMax = e.value
-                        }
-                    }
-                    else
-                    {
-                        if -e.negativeSum < _yMin
-                        {
-                            _yMin = -e.negativeSum
-                        }
-                        
-                        if e.positiveSum > _yMax
-                        {
-                            _yMax = e.positiveSum
-                        }
-                    }
-                }
-            }
-        }
-        
-        if (_yMin == DBL_MAX)
+        return e.value
+    }
+    
+    internal override func entryYMax(e: ChartDataEntry) -> Double
+    {
+        if let e = e as? BarChartDataEntry where e.values != nil && !e.value.isNaN
         {
-            _yMin = 0.0
-            _yMax = 0.0
+            return e.positiveSum
         }
+        return e.value
     }
     
     /// - returns: the maximum number of bars that can be stacked upon another in this DataSet.
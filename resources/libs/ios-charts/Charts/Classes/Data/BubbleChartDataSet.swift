@@ -28,6 +28,11 @@ public class BubbleChartDataSet: BarLineScatterCandleBubbleChartDataSet
         super.setColor(color.colorWithAlphaComponent(alpha))
     }
     
+    internal override func makeEntry(value value: Double, xIndex: Int) -> ChartDataEntry
+    {
+        return BubbleChartDataEntry(xIndex: xIndex, value: value, size: 0.0)
+    }
+    
     internal override func calcMinMax(start start: Int, end: Int)
     {
         if (yVals.count == 0)
@@ -45,51 +45,43 @@ public class CandleChartDataSet: LineScatterCandleChartDataSet
     /// Are increasing values drawn as filled?
     public var increasingFilled = true
     
+    public required init()
+    {
+        super.init()
+    }
+    
     public override init(yVals: [ChartDataEntry]?, label: String?)
     {
         super.init(yVals: yVals, label: label)
     }
     
-    internal override func calcMinMax(start start: Int, end: Int)
+    /// Columnar Candle DataSets hold one value per x-index: a candle whose open, close, high and low are that value,
+    /// so min/max over the buffers are min/max over the candles' low and high.
+    internal override func makeEntry(value value: Double, xIndex: Int) -> ChartDataEntry
     {
-        if (yVals.count == 0)
-        {
-            return
-        }
-        
-        var entries = yVals as! [CandleChartDataEntry]
-        
-        var endValue : Int
-        
-        if end == 0 || end >= entries.count
-        {
-            endValue = entries.count - 1
-        }
-        else
-        {
-            endValue = end
-        }
-        
-        _lastStart = start
-        _lastEnd = end
-        
-        _yMin = entries[start].low
-        _yMax = entries[start].high
-        
-        for (var i = start + 1; i <= endValue; i++)
+        return CandleChartDataEntry(xIndex: xIndex, shadowH: value, shadowL: value, open: value, close: value)
+    }
+    
+    internal override func canStoreInColumns(e: ChartDataEntry) -> Bool
+    {
+        if let e = e as? CandleChartDataEntry
         {
-            let e = entries[i]
-            
-            if (e.low < _yMin)
+            if (e.high != e.value || e.low != e.value || e.open != e.value || e.close != e.value)
             {
-                _yMin = e.low
-            }
-            
-            if (e.high > _yMax)
-            {
-                _yMax = e.high
+                return false
             }
         }
+        return super.canStoreInColumns(e)
+    }
+    
+    internal override func entryYMin(e: ChartDataEntry) -> Double
+    {
+        return (e as! CandleChartDataEntry).low
+    }
+    
+    internal override func entryYMax(e: ChartDataEntry) -> Double
+    {
+        return (e as! CandleChartDataEntry).high
     }
 
     /// the space that is left out on the left and right side of each candle,
@@ -132,7 +132,7 @@ public class ChartData: NSObject
         
         for (var i = 0; i < dataSets.count; i++)
         {
-            if (dataSets[i].yVals.count > _xVals.count)
+            if (dataSets[i].entryCount > _xVals.count)
             {
                 print("One or more of the DataSet Entry arrays are longer than the x-values array of this Data object.", terminator: "\n")
                 return
@@ -142,6 +142,15 @@ public class ChartData: NSObject
     
     public func notifyDataChanged()
     {
+        // entries may have been edited in place, which the DataSets' min/max indexes cannot see
+        if (_dataSets != nil)
+        {
+            for dataSet in _dataSets
+            {
+                dataSet._yRangeIndex = nil
+            }
+        }
+        
         initialize(_dataSets)
     }
     
@@ -162,69 +171,60 @@ public class ChartData: NSObject
             _yMin = DBL_MAX
             _yMax = -DBL_MAX
             
-            for (var i = 0; i < _dataSets.count; i++)
+            var firstLeft: ChartDataSet?
+            var firstRight: ChartDataSet?
+            
+            // overall and per-axis bounds in a single pass over the datasets
+            for dataSet in _dataSets
             {
-                _dataSets[i].calcMinMax(start: start, end: end)
+                dataSet.calcMinMax(start: start, end: end)
                 
-                if (_dataSets[i].yMin < _yMin)
+                if (dataSet.yMin < _yMin)
                 {
-                    _yMin = _dataSets[i].yMin
+                    _yMin = dataSet.yMin
                 }
                 
-                if (_dataSets[i].yMax > _yMax)
+                if (dataSet.yMax > _yMax)
                 {
-                    _yMax = _dataSets[i].yMax
+                    _yMax = dataSet.yMax
                 }
-            }
-            
-            if (_yMin == DBL_MAX)
-            {
-                _yMin = 0.0
-                _yMax = 0.0
-            }
-            
-            // left axis
-            let firstLeft = getFirstLeft()
-
-            if (firstLeft !== nil)
-            {
-                _leftAxisMax = firstLeft!.yMax
-                _leftAxisMin = firstLeft!.yMin
-
-                for dataSet in _dataSets
+                
+                if (dataSet.axisDependency == .Left)
                 {
-                    if (dataSet.axisDependency == .Left)
+                    if (firstLeft === nil)
+                    {
+                        firstLeft = dataSet
+                        _leftAxisMin = dataSet.yMin
+                        _leftAxisMax = dataSet.yMax
+                    }
+                    else
                     {
                         if (dataSet.yMin < _leftAxisMin)
                         {
                             _leftAxisMin = dataSet.yMin
                         }
-
+                        
                         if (dataSet.yMax > _leftAxisMax)
                         {
                             _leftAxisMax = dataSet.yMax
                         }
                     }
                 }
-            }
-
-            // right axis
-            let firstRight = getFirstRight()
-
-            if (firstRight !== nil)
-            {
-                _rightAxisMax = firstRight!.yMax
-                _rightAxisMin = firstRight!.yMin
-                
-                for dataSet in _dataSets
+                else
                 {
-                    if (dataSet.axisDependency == .Right)
+                    if (firstRight === nil)
+                    {
+                        firstRight = dataSet
+                        _rightAxisMin = dataSet.yMin
+                        _rightAxisMax = dataSet.yMax
+                    }
+                    else
                     {
                         if (dataSet.yMin < _rightAxisMin)
                         {
                             _rightAxisMin = dataSet.yMin
                         }
-
+                        
                         if (dataSet.yMax > _rightAxisMax)
                         {
                             _rightAxisMax = dataSet.yMax
@@ -232,7 +232,13 @@ public class ChartData: NSObject
                     }
                 }
             }
-
+            
+            if (_yMin == DBL_MAX)
+            {
+                _yMin = 0.0
+                _yMax = 0.0
+            }
+            
             // in case there is only one axis, adjust the second axis
             handleEmptyAxis(firstLeft, firstRight: firstRight)
         }
@@ -623,53 +629,57 @@ public class ChartData: NSObject
             let val = e.value
             let set = _dataSets[dataSetIndex]
             
+            // the extents the data set counts for this entry, e.g. the stack sums of a stacked bar
+            let entryMin = set.entryYMin(e)
+            let entryMax = set.entryYMax(e)
+            
             if (_yValCount == 0)
             {
-                _yMin = val
-                _yMax = val
+                _yMin = entryMin
+                _yMax = entryMax
                 
                 if (set.axisDependency == .Left)
                 {
-                    _leftAxisMax = e.value
-                    _leftAxisMin = e.value
+                    _leftAxisMax = entryMax
+                    _leftAxisMin = entryMin
                 }
                 else
                 {
-                    _rightAxisMax = e.value
-                    _rightAxisMin = e.value
+                    _rightAxisMax = entryMax
+                    _rightAxisMin = entryMin
                 }
             }
             else
             {
-                if (_yMax < val)
+                if (_yMax < entryMax)
                 {
-                    _yMax = val
+                    _yMax = entryMax
                 }
-                if (_yMin > val)
+                if (_yMin > entryMin)
                 {
-                    _yMin = val
+                    _yMin = entryMin
                 }
                 
                 if (set.axisDependency == .Left)
                 {
-                    if (_leftAxisMax < e.value)
+                    if (_leftAxisMax < entryMax)
                     {
-                        _leftAxisMax = e.value
+                        _leftAxisMax = entryMax
                     }
-                    if (_leftAxisMin > e.value)
+                    if (_leftAxisMin > entryMin)
                     {
-                        _leftAxisMin = e.value
+                        _leftAxisMin = entryMin
                     }
                 }
                 else
                 {
-                    if (_rightAxisMax < e.value)
+                    if (_rightAxisMax < entryMax)
                     {
-                        _rightAxisMax = e.value
+                        _rightAxisMax = entryMax
                     }
-                    if (_rightAxisMin > e.value)
+                    if (_rightAxisMin > entryMin)
                     {
-                        _rightAxisMin = e.value
+                        _rightAxisMin = entryMin
                     }
                 }
             }
@@ -0,0 +1,104 @@
+//
+//  ChartDataColumns.swift
+//  Charts
+//
+//  Copyright 2015 Daniel Cohen Gindi & Philipp Jahoda
+//  A port of MPAndroidChart for iOS
+//  Licensed under Apache License 2.0
+//
+//  https://github.com/danielgindi/ios-charts
+//
+
+import Foundation
+
+/// Columnar storage of a DataSet's entries: x-indices and values in two contiguous buffers, sorted by x-index.
+/// Used by DataSets created with `ChartDataSet(xIndices:values:label:)`, until something asks for entry objects.
+internal struct ChartDataColumns
+{
+    internal var xIndices: [Int]
+    internal var values: [Double]
+
+    internal init(xIndices: [Int], values: [Double])
+    {
+        self.xIndices = xIndices
+        self.values = values
+    }
+
+    internal var count: Int { return xIndices.count }
+
+    internal mutating func append(xIndex xIndex: Int, value: Double)
+    {
+        xIndices.append(xIndex)
+        values.append(value)
+    }
+
+    internal mutating func removeAtIndex(index: Int)
+    {
+        xIndices.removeAtIndex(index)
+        values.removeAtIndex(index)
+    }
+
+    internal mutating func removeAll()
+    {
+        xIndices.removeAll(keepCapacity: true)
+        values.removeAll(keepCapacity: true)
+    }
+
+    /// - returns: the index of the first entry at the given x-index, or of the closest entry if there is none. -1 if empty.
+    /// Same semantics as `ChartDataSet.entryIndex(xIndex:)`.
+    internal func entryIndex(xIndex x: Int) -> Int
+    {
+        var low = 0
+        var high = xIndices.count - 1
+        var closest = -1
+
+        while (low <= high)
+        {
+            var m = (high + low) / 2
+
+            if (x == xIndices[m])
+            {
+                while (m > 0 && xIndices[m - 1] == x)
+                {
+                    m--
+                }
+
+                return m
+            }
+
+            if (x > xIndices[m])
+            {
+                low = m + 1
+            }
+            else
+            {
+                high = m - 1
+            }
+
+            closest = m
+        }
+
+        return closest
+    }
+
+    /// - returns: the index of the entry with the given x-index and value (within the tolerance of `ChartDataEntry.isEqual`), or -1.
+    internal func entryIndex(xIndex x: Int, value: Double) -> Int
+    {
+        var i = entryIndex(xIndex: x)
+
+        if (i < 0)
+        {
+            return -1
+        }
+
+        for (; i < xIndices.count && xIndices[i] == x; i++)
+        {
+            if (fabs(values[i] - value) <= 0.00001)
+            {
+                return i
+            }
+        }
+
+        return -1
+    }
+}
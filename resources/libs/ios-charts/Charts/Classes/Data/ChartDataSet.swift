@@ -18,7 +18,33 @@ import UIKit
 public class ChartDataSet: NSObject
 {
     public var colors = [UIColor]()
+    
+    /// the entry objects. Not used while the DataSet keeps its entries in `_columns`.
+    private var _entries: [ChartDataEntry]!
+    
+    /// x-indices and values in contiguous buffers, for DataSets created with `init(xIndices:values:label:)`.
+    /// nil once entry objects have been materialized.
+    internal var _columns: ChartDataColumns?
+    
+    /// the entries as objects. For a columnar DataSet, reading this materializes the entry objects once,
+    /// and the DataSet keeps using objects from then on.
     internal var _yVals: [ChartDataEntry]!
+    {
+        get
+        {
+            if (_columns != nil)
+            {
+                materializeEntries()
+            }
+            return _entries
+        }
+        set
+        {
+            _columns = nil
+            _entries = newValue
+        }
+    }
+    
     internal var _yMax = Double(0.0)
     internal var _yMin = Double(0.0)
     internal var _yValueSum = Double(0.0)
@@ -29,6 +55,10 @@ public class ChartDataSet: NSObject
     /// the last end value used for calcMinMax
     internal var _lastEnd: Int = 0
     
+    /// range min/max index over the entries, built by calcMinMax and kept up to date by addEntry.
+    /// nil when it has to be rebuilt.
+    internal var _yRangeIndex: ChartRangeMinMax?
+    
     public var label: String? = "DataSet"
     public var visible = true
     public var drawValuesEnabled = true
@@ -56,7 +86,7 @@ public class ChartDataSet: NSObject
     /// - returns: true if value highlighting is enabled for this dataset
     public var isHighlightEnabled: Bool { return highlightEnabled }
     
-    public override init()
+    public required override init()
     {
         super.init()
     }
@@ -80,16 +110,73 @@ public class ChartDataSet: NSObject
         self.init(yVals: yVals, label: "DataSet")
     }
     
+    /// Creates a DataSet that keeps x-indices and values in contiguous buffers instead of one ChartDataEntry per value.
+    /// Min/max, lookups by x-index and line drawing read the buffers directly; entry objects are only created
+    /// when an API hands one out (e.g. `entryForXIndex`), or for all entries when `yVals` is read.
+    ///
+    /// - parameter xIndices: the x-indices, in ascending order
+    /// - parameter values: the values, one per x-index
+    public convenience init(xIndices: [Int], values: [Double], label: String?)
+    {
+        self.init(yVals: nil, label: label)
+        
+        let count = min(xIndices.count, values.count)
+        
+        if (xIndices.count != values.count)
+        {
+            print("ChartDataSet(xIndices:values:label:) - xIndices and values differ in length, the extra items are ignored.", terminator: "\n")
+        }
+        
+        _columns = ChartDataColumns(
+            xIndices: count == xIndices.count ? xIndices : Array(xIndices[0..<count]),
+            values: count == values.count ? values : Array(values[0..<count]))
+        
+        notifyDataSetChanged()
+    }
+    
+    /// true if the entries are kept in contiguous buffers, see `init(xIndices:values:label:)`.
+    public var isColumnar: Bool { return _columns != nil }
+    
+    /// - returns: the entry object the DataSet class uses for a plain value, when materializing a columnar DataSet.
+    internal func makeEntry(value value: Double, xIndex: Int) -> ChartDataEntry
+    {
+        return ChartDataEntry(value: value, xIndex: xIndex)
+    }
+    
+    /// - returns: true if the columnar buffers can keep everything `e` holds, so adding it does not need entry objects.
+    internal func canStoreInColumns(e: ChartDataEntry) -> Bool
+    {
+        return e.data === nil
+    }
+    
+    /// Replaces the columnar storage with entry objects.
+    private func materializeEntries()
+    {
+        guard let columns = _columns else { return }
+        
+        var entries = [ChartDataEntry]()
+        entries.reserveCapacity(columns.count)
+        
+        for (var i = 0; i < columns.count; i++)
+        {
+            entries.append(makeEntry(value: columns.values[i], xIndex: columns.xIndices[i]))
+        }
+        
+        _columns = nil
+        _entries = entries
+    }
+    
     /// Use this method to tell the data set that the underlying data has changed
     public func notifyDataSetChanged()
     {
+        _yRangeIndex = nil
         calcMinMax(start: _lastStart, end: _lastEnd)
         calcYValueSum()
     }
     
     internal func calcMinMax(start start : Int, end: Int)
     {
-        let yValCount = _yVals.count
+        let yValCount = entryCount
         
         if yValCount == 0
         {
@@ -110,26 +197,28 @@ public class ChartDataSet: NSObject
         _lastStart = start
         _lastEnd = endValue
         
-        _yMin = DBL_MAX
-        _yMax = -DBL_MAX
-        
-        for (var i = start; i <= endValue; i++)
+        if (_yRangeIndex == nil || _yRangeIndex!.count != yValCount)
         {
-            let e = _yVals[i]
-            
-            if (!e.value.isNaN)
+            if let columns = _columns
             {
-                if (e.value < _yMin)
-                {
-                    _yMin = e.value
-                }
-                if (e.value > _yMax)
-                {
-                    _yMax = e.value
-                }
+                _yRangeIndex = ChartRangeMinMax(
+                    count: yValCount,
+                    entryMin: { columns.values[$0] },
+                    entryMax: { columns.values[$0] })
+            }
+            else
+            {
+                _yRangeIndex = ChartRangeMinMax(
+                    count: yValCount,
+                    entryMin: { self.entryYMin(self._entries[$0]) },
+                    entryMax: { self.entryYMax(self._entries[$0]) })
             }
         }
         
+        let range = _yRangeIndex!.minMax(start: start, end: endValue)
+        _yMin = range.min
+        _yMax = range.max
+        
         if (_yMin == DBL_MAX)
         {
             _yMin = 0.0
@@ -137,13 +226,60 @@ public class ChartDataSet: NSObject
         }
     }
     
+    /// - returns: the lowest y-value an entry reaches. NaN if the entry should not count towards the minimum.
+    internal func entryYMin(e: ChartDataEntry) -> Double
+    {
+        return e.value
+    }
+    
+    /// - returns: the highest y-value an entry reaches. NaN if the entry should not count towards the maximum.
+    internal func entryYMax(e: ChartDataEntry) -> Double
+    {
+        return e.value
+    }
+    
+    /// Updates the min/max values, and the range index if it is built, for an entry added at the end.
+    private func appendMinMax(e: ChartDataEntry)
+    {
+        let entryMin = entryYMin(e)
+        let entryMax = entryYMax(e)
+        
+        if (entryCount == 0)
+        {
+            _yMin = entryMin.isNaN ? 0.0 : entryMin
+            _yMax = entryMax.isNaN ? 0.0 : entryMax
+        }
+        else
+        {
+            if (_yMax < entryMax)
+            {
+                _yMax = entryMax
+            }
+            if (_yMin > entryMin)
+            {
+                _yMin = entryMin
+            }
+        }
+        
+        _yRangeIndex?.append(min: entryMin, max: entryMax)
+    }
+    
     private func calcYValueSum()
     {
         _yValueSum = 0
         
-        for var i = 0; i < _yVals.count; i++
+        if let columns = _columns
+        {
+            for var i = 0; i < columns.count; i++
+            {
+                _yValueSum += fabs(columns.values[i])
+            }
+            return
+        }
+        
+        for var i = 0; i < _entries.count; i++
         {
-            _yValueSum += fabs(_yVals[i].value)
+            _yValueSum += fabs(_entries[i].value)
         }
     }
     
@@ -153,10 +289,16 @@ public class ChartDataSet: NSObject
         return yValueSum / Double(valueCount)
     }
     
-    public var entryCount: Int { return _yVals!.count; }
+    public var entryCount: Int { return _columns?.count ?? _entries!.count; }
     
     public func yValForXIndex(x: Int) -> Double
     {
+        if let columns = _columns
+        {
+            let index = columns.entryIndex(xIndex: x)
+            return index > -1 && columns.xIndices[index] == x ? columns.values[index] : Double.NaN
+        }
+        
         let e = self.entryForXIndex(x)
         
         if (e !== nil && e!.xIndex == x) { return e!.value }
@@ -171,7 +313,12 @@ public class ChartDataSet: NSObject
         let index = self.entryIndex(xIndex: x)
         if (index > -1)
         {
-            return _yVals[index]
+            if let columns = _columns
+            {
+                // a new object every time, changing it does not change the DataSet
+                return makeEntry(value: columns.values[index], xIndex: columns.xIndices[index])
+            }
+            return _entries[index]
         }
         return nil
     }
@@ -225,18 +372,23 @@ public class ChartDataSet: NSObject
     
     public func entryIndex(xIndex x: Int) -> Int
     {
+        if let columns = _columns
+        {
+            return columns.entryIndex(xIndex: x)
+        }
+        
         var low = 0
-        var high = _yVals.count - 1
+        var high = _entries.count - 1
         var closest = -1
         
         while (low <= high)
         {
             var m = (high + low) / 2
-            let entry = _yVals[m]
+            let entry = _entries[m]
             
             if (x == entry.xIndex)
             {
-                while (m > 0 && _yVals[m - 1].xIndex == x)
+                while (m > 0 && _entries[m - 1].xIndex == x)
                 {
                     m--
                 }
@@ -261,11 +413,17 @@ public class ChartDataSet: NSObject
     
     public func entryIndex(entry e: ChartDataEntry, isEqual: Bool) -> Int
     {
+        if let columns = _columns
+        {
+            // columnar entries have no identity, and no data
+            return isEqual && e.data === nil ? columns.entryIndex(xIndex: e.xIndex, value: e.value) : -1
+        }
+        
         if (isEqual)
         {
-            for (var i = 0; i < _yVals.count; i++)
+            for (var i = 0; i < _entries.count; i++)
             {
-                if (_yVals[i].isEqual(e))
+                if (_entries[i].isEqual(e))
                 {
                     return i
                 }
@@ -273,9 +431,9 @@ public class ChartDataSet: NSObject
         }
         else
         {
-            for (var i = 0; i < _yVals.count; i++)
+            for (var i = 0; i < _entries.count; i++)
             {
-                if (_yVals[i] === e)
+                if (_entries[i] === e)
                 {
                     return i
                 }
@@ -286,41 +444,38 @@ public class ChartDataSet: NSObject
     }
     
     /// - returns: the number of entries this DataSet holds.
-    public var valueCount: Int { return _yVals.count; }
+    public var valueCount: Int { return entryCount; }
     
     /// Adds an Entry to the DataSet dynamically.
     /// Entries are added to the end of the list.
-    /// This will also recalculate the current minimum and maximum values of the DataSet and the value-sum.
+    /// This will also update the current minimum and maximum values of the DataSet and the value-sum, in O(log n).
     /// - parameter e: the entry to add
     public func addEntry(e: ChartDataEntry)
     {
         let val = e.value
         
-        if (_yVals == nil)
+        if (_entries == nil && _columns == nil)
         {
-            _yVals = [ChartDataEntry]()
+            _entries = [ChartDataEntry]()
         }
         
-        if (_yVals.count == 0)
-        {
-            _yMax = val
-            _yMin = val
-        }
-        else
+        appendMinMax(e)
+        
+        _yValueSum += val
+        
+        if (_columns != nil)
         {
-            if (_yMax < val)
-            {
-                _yMax = val
-            }
-            if (_yMin > val)
+            if (canStoreInColumns(e))
             {
-                _yMin = val
+                _columns!.append(xIndex: e.xIndex, value: val)
+                return
             }
+            
+            // the buffers cannot keep the entry's data
+            materializeEntries()
         }
         
-        _yValueSum += val
-        
-        _yVals.append(e)
+        _entries.append(e)
     }
     
     /// Adds an Entry to the DataSet dynamically.
@@ -331,53 +486,49 @@ public class ChartDataSet: NSObject
     {
         let val = e.value
         
-        if (_yVals == nil)
+        if (_entries == nil && _columns == nil)
         {
-            _yVals = [ChartDataEntry]()
+            _entries = [ChartDataEntry]()
         }
         
-        if (_yVals.count == 0)
-        {
-            _yMax = val
-            _yMin = val
-        }
-        else
-        {
-            if (_yMax < val)
-            {
-                _yMax = val
-            }
-            if (_yMin > val)
-            {
-                _yMin = val
-            }
-        }
+        appendMinMax(e)
         
         _yValueSum += val
         
-        if _yVals.last?.xIndex > e.xIndex
+        materializeEntries()
+        
+        if _entries.last?.xIndex > e.xIndex
         {
+            // the index only supports appending
+            _yRangeIndex = nil
+            
             var closestIndex = entryIndex(xIndex: e.xIndex)
-            if _yVals[closestIndex].xIndex < e.xIndex
+            if _entries[closestIndex].xIndex < e.xIndex
             {
                 closestIndex++
             }
-            _yVals.insert(e, atIndex: closestIndex)
+            _entries.insert(e, atIndex: closestIndex)
             return;
         }
         
-        _yVals.append(e)
+        _entries.append(e)
     }
     
     public func removeEntry(entry: ChartDataEntry) -> Bool
     {
         var removed = false
         
-        for (var i = 0; i < _yVals.count; i++)
+        if (_columns != nil)
         {
-            if (_yVals[i] === entry)
+            // columnar entries are never handed out as the stored objects
+            return false
+        }
+        
+        for (var i = 0; i < _entries.count; i++)
+        {
+            if (_entries[i] === entry)
             {
-                _yVals.removeAtIndex(i)
+                _entries.removeAtIndex(i)
                 removed = true
                 break
             }
@@ -386,6 +537,7 @@ public class ChartDataSet: NSObject
         if (removed)
         {
             _yValueSum -= entry.value
+            _yRangeIndex = nil
             calcMinMax(start: _lastStart, end: _lastEnd)
         }
         
@@ -397,9 +549,19 @@ public class ChartDataSet: NSObject
         let index = self.entryIndex(xIndex: xIndex)
         if (index > -1)
         {
-            let e = _yVals.removeAtIndex(index)
+            var value: Double
+            if (_columns != nil)
+            {
+                value = _columns!.values[index]
+                _columns!.removeAtIndex(index)
+            }
+            else
+            {
+                value = _entries.removeAtIndex(index).value
+            }
             
-            _yValueSum -= e.value
+            _yValueSum -= value
+            _yRangeIndex = nil
             calcMinMax(start: _lastStart, end: _lastEnd)
             
             return true
@@ -447,6 +609,11 @@ public class ChartDataSet: NSObject
     /// - returns: true if contains the entry, false if not.
     public func contains(e: ChartDataEntry) -> Bool
     {
+        if (_columns != nil)
+        {
+            return entryIndex(entry: e, isEqual: true) > -1
+        }
+        
         for entry in _yVals
         {
             if (entry.isEqual(e))
@@ -461,7 +628,14 @@ public class ChartDataSet: NSObject
     /// Removes all values from this DataSet and recalculates min and max value.
     public func clear()
     {
-        _yVals.removeAll(keepCapacity: true)
+        if (_columns != nil)
+        {
+            _columns!.removeAll()
+        }
+        else
+        {
+            _entries.removeAll(keepCapacity: true)
+        }
         _lastStart = 0
         _lastEnd = 0
         notifyDataSetChanged()
@@ -471,7 +645,7 @@ public class ChartDataSet: NSObject
     
     public override var description: String
     {
-        return String(format: "ChartDataSet, label: %@, %i entries", arguments: [self.label ?? "", _yVals.count])
+        return String(format: "ChartDataSet, label: %@, %i entries", arguments: [self.label ?? "", entryCount])
     }
     
     public override var debugDescription: String
@@ -490,15 +664,24 @@ public class ChartDataSet: NSObject
     
     public func copyWithZone(zone: NSZone) -> AnyObject
     {
-        let copy = ChartDataSet()
+        let copy = self.dynamicType.init()
         copy.colors = colors
-        copy._yVals = _yVals
+        copy._entries = _entries
+        copy._columns = _columns
         copy._yMax = _yMax
         copy._yMin = _yMin
         copy._yValueSum = _yValueSum
         copy._lastStart = _lastStart
         copy._lastEnd = _lastEnd
+        copy._yRangeIndex = _yRangeIndex
         copy.label = label
+        copy.visible = visible
+        copy.drawValuesEnabled = drawValuesEnabled
+        copy.valueTextColor = valueTextColor
+        copy.valueFont = valueFont
+        copy.valueFormatter = valueFormatter
+        copy.axisDependency = axisDependency
+        copy.highlightEnabled = highlightEnabled
         return copy
     }
 }
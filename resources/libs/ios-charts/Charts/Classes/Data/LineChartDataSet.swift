@@ -34,7 +34,12 @@ public class LineChartDataSet: LineRadarChartDataSet
     
     public var drawCircleHoleEnabled = true
     
-    public override init()
+    /// reduces the entries drawn by straight lines to the content width of the chart.
+    /// Only the pixel based approximators (MinMaxPerPixel, LargestTriangleThreeBuckets) are applied.
+    /// **default**: nil, draw every entry
+    public var approximator: ChartDataApproximatorFilter?
+    
+    public required init()
     {
         super.init()
         circleColors.append(UIColor(red: 140.0/255.0, green: 234.0/255.0, blue: 255.0/255.0, alpha: 1.0))
@@ -102,18 +107,31 @@ public class LineChartDataSet: LineRadarChartDataSet
     
     public var isDrawCircleHoleEnabled: Bool { return drawCircleHoleEnabled; }
     
+    public override func notifyDataSetChanged()
+    {
+        approximator?.invalidate()
+        super.notifyDataSetChanged()
+    }
+    
     // MARK: NSCopying
     
     public override func copyWithZone(zone: NSZone) -> AnyObject
     {
         let copy = super.copyWithZone(zone) as! LineChartDataSet
         copy.circleColors = circleColors
+        copy.circleHoleColor = circleHoleColor
         copy.circleRadius = circleRadius
         copy.cubicIntensity = cubicIntensity
         copy.lineDashPhase = lineDashPhase
         copy.lineDashLengths = lineDashLengths
         copy.drawCirclesEnabled = drawCirclesEnabled
         copy.drawCubicEnabled = drawCubicEnabled
+        copy.drawCircleHoleEnabled = drawCircleHoleEnabled
+        if (approximator !== nil)
+        {
+            // not shared, the approximator caches the reduction of its own DataSet
+            copy.approximator = ChartDataApproximatorFilter(type: approximator!.type, tolerance: approximator!.tolerance)
+        }
         return copy
     }
 }
@@ -21,18 +21,38 @@ public class ChartDataApproximatorFilter: ChartDataBaseFilter
     {
         case None
         case RamerDouglasPeucker
+        /// keeps the first, last, lowest and highest entry of every pixel column (M4)
+        case MinMaxPerPixel
+        /// Largest-Triangle-Three-Buckets: keeps the most significant entry of each of one bucket per pixel column
+        case LargestTriangleThreeBuckets
     }
     
     /// the type of filtering algorithm to use
     public var type = ApproximatorType.None
+    {
+        didSet
+        {
+            invalidate()
+        }
+    }
     
     /// the tolerance to be filtered with
     /// When using the Douglas-Peucker-Algorithm, the tolerance is an angle in degrees, that will trigger the filtering
+    /// When using MinMaxPerPixel or LargestTriangleThreeBuckets with `filter()`, the tolerance is the number of pixel columns
     public var tolerance = Double(0.0)
     
+    /// the indices kept by the last `reducedIndices` call, reused while its range, width and entry count are unchanged
+    private var _cachedIndices: [Int]?
+    /// entry count, from, to and columns of the cached indices
+    private var _cachedKey = [Int]()
+    
     public var scaleRatio = Double(1.0)
     public var deltaRatio = Double(1.0)
     
+    /// Douglas-Peucker splits inputs of at least this many entries across threads.
+    /// Set to Int.max to always run on the calling thread.
+    public var parallelThreshold = Int(250_000)
+    
     public override init()
     {
         super.init()
@@ -85,11 +105,183 @@ public class ChartDataApproximatorFilter: ChartDataBaseFilter
         {
         case .RamerDouglasPeucker:
             return reduceWithDouglasPeuker(points, epsilon: tolerance)
+        case .MinMaxPerPixel, .LargestTriangleThreeBuckets:
+            guard let indices = reducedIndices(points, from: 0, to: points.count, columns: Int(tolerance)) else { return points }
+            return indices.map { points[$0] }
         case .None:
             return points
         }
     }
     
+    /// true if the type reduces to a pixel width rather than a tolerance (MinMaxPerPixel, LargestTriangleThreeBuckets)
+    public var isPixelBased: Bool
+    {
+        return type == .MinMaxPerPixel || type == .LargestTriangleThreeBuckets
+    }
+    
+    /// Drops the cached reduction.
+    /// Needed when entry values change without the entry count changing, `LineChartDataSet.notifyDataSetChanged()` calls this.
+    public func invalidate()
+    {
+        _cachedIndices = nil
+    }
+    
+    /// Reduces the entries in `from..<to` for drawing into the given number of pixel columns.
+    /// The result is cached, so calling this on every draw only recomputes when the visible range or width changed, i.e. on zoom and pan.
+    /// Entries must be sorted by x-index. Use one filter per DataSet, as the cache is for one entry array.
+    ///
+    /// - returns: the ascending indices of the entries to draw, or nil if the range needs no reduction, or the type is not pixel based.
+    public func reducedIndices(entries: [ChartDataEntry], from: Int, to: Int, columns: Int) -> [Int]?
+    {
+        let pointsPerColumn = type == .MinMaxPerPixel ? 4 : 1
+        
+        if (!isPixelBased || columns < 3 || to - from <= columns * pointsPerColumn)
+        {
+            return nil
+        }
+        
+        let key = [entries.count, from, to, columns]
+        if (_cachedIndices != nil && _cachedKey == key)
+        {
+            return _cachedIndices
+        }
+        
+        _cachedKey = key
+        _cachedIndices = type == .MinMaxPerPixel
+            ? reduceWithMinMaxPerPixel(entries, from: from, to: to, columns: columns)
+            : reduceWithLargestTriangleThreeBuckets(entries, from: from, to: to, buckets: columns)
+        return _cachedIndices
+    }
+    
+    /// M4: splits the x-range into pixel columns, and keeps the first, lowest, highest and last entry of each.
+    /// The drawn line is pixel-identical to drawing every entry.
+    private func reduceWithMinMaxPerPixel(entries: [ChartDataEntry], from: Int, to: Int, columns: Int) -> [Int]
+    {
+        var indices = [Int]()
+        indices.reserveCapacity(columns * 4)
+        
+        let firstX = Double(entries[from].xIndex)
+        let columnWidth = max(1.0, Double(entries[to - 1].xIndex) - firstX + 1.0) / Double(columns)
+        
+        var column = -1
+        var first = from, last = from, minIndex = from, maxIndex = from
+        var minValue = DBL_MAX, maxValue = -DBL_MAX
+        
+        for (var i = from; i <= to; i++)
+        {
+            let c = i < to ? Int((Double(entries[i].xIndex) - firstX) / columnWidth) : -1
+            
+            if (c != column)
+            {
+                if (column >= 0)
+                {
+                    // flush the finished column, in index order and without duplicates
+                    for index in [first, min(minIndex, maxIndex), max(minIndex, maxIndex), last]
+                    {
+                        if (indices.last != index)
+                        {
+                            indices.append(index)
+                        }
+                    }
+                }
+                
+                if (i == to)
+                {
+                    break
+                }
+                
+                column = c
+                first = i
+                minIndex = i
+                maxIndex = i
+                minValue = DBL_MAX
+                maxValue = -DBL_MAX
+            }
+            
+            let value = entries[i].value
+            last = i
+            
+            if (value < minValue)
+            {
+                minValue = value
+                minIndex = i
+            }
+            if (value > maxValue)
+            {
+                maxValue = value
+                maxIndex = i
+            }
+        }
+        
+        return indices
+    }
+    
+    /// Largest-Triangle-Three-Buckets (Steinarsson): keeps the first and last entry, and of every bucket in between
+    /// the entry forming the largest triangle with the previously kept entry and the average of the next bucket.
+    private func reduceWithLargestTriangleThreeBuckets(entries: [ChartDataEntry], from: Int, to: Int, buckets: Int) -> [Int]
+    {
+        var indices = [Int]()
+        indices.reserveCapacity(buckets)
+        
+        let bucketSize = Double(to - from - 2) / Double(buckets - 2)
+        var a = from
+        
+        indices.append(from)
+        
+        for (var bucket = 0; bucket < buckets - 2; bucket++)
+        {
+            // average point of the next bucket
+            let avgStart = from + Int(Double(bucket + 1) * bucketSize) + 1
+            let avgEnd = min(from + Int(Double(bucket + 2) * bucketSize) + 1, to)
+            var avgX = 0.0, avgY = 0.0, avgCount = 0.0
+            
+            for (var i = avgStart; i < avgEnd; i++)
+            {
+                let e = entries[i]
+                if (!e.value.isNaN)
+                {
+                    avgX += Double(e.xIndex)
+                    avgY += e.value
+                    avgCount += 1.0
+                }
+            }
+            
+            if (avgCount > 0.0)
+            {
+                avgX /= avgCount
+                avgY /= avgCount
+            }
+            
+            // the entry of this bucket with the largest triangle
+            let rangeStart = from + Int(Double(bucket) * bucketSize) + 1
+            let rangeEnd = from + Int(Double(bucket + 1) * bucketSize) + 1
+            let ax = Double(entries[a].xIndex)
+            let ay = entries[a].value
+            
+            var maxArea = -1.0
+            var next = rangeStart
+            
+            for (var i = rangeStart; i < rangeEnd; i++)
+            {
+                let e = entries[i]
+                let area = fabs((ax - avgX) * (e.value - ay) - (ax - Double(e.xIndex)) * (avgY - ay))
+                
+                if (area > maxArea)
+                {
+                    maxArea = area
+                    next = i
+                }
+            }
+            
+            indices.append(next)
+            a = next
+        }
+        
+        indices.append(to - 1)
+        
+        return indices
+    }
+    
     /// uses the douglas peuker algorithm to reduce the given arraylist of entries
     private func reduceWithDouglasPeuker(entries: [ChartDataEntry], epsilon: Double) -> [ChartDataEntry]
     {
@@ -99,53 +291,79 @@ public class ChartDataApproximatorFilter: ChartDataBaseFilter
             return entries
         }
         
-        var keep = [Bool](count: entries.count, repeatedValue: false)
+        return douglasPeuckerIndices(entries, epsilon: epsilon).map { entries[$0] }
+    }
+    
+    /// Applies the Douglas-Peucker-Reduction with the given epsilon (an angle in degrees, see `tolerance`).
+    /// Runs iteratively over contiguous x/y buffers, so deep splits cannot overflow the stack,
+    /// and splits large inputs across threads (see `parallelThreshold`).
+    ///
+    /// - returns: the ascending indices of the kept entries. First and last always stay.
+    public func douglasPeuckerIndices(entries: [ChartDataEntry], epsilon: Double) -> [Int]
+    {
+        let count = entries.count
+        
+        if (epsilon <= 0 || count < 3)
+        {
+            return Array(0..<count)
+        }
+        
+        // the scaled coordinates the angles are measured in
+        var x = [Double](count: count, repeatedValue: 0.0)
+        var y = [Double](count: count, repeatedValue: 0.0)
+        for (var i = 0; i < count; i++)
+        {
+            x[i] = Double(entries[i].xIndex) * Double(deltaRatio)
+            y[i] = entries[i].value * scaleRatio
+        }
+        
+        var keep = [Bool](count: count, repeatedValue: false)
         
         // first and last always stay
         keep[0] = true
-        keep[entries.count - 1] = true
+        keep[count - 1] = true
         
-        // first and last entry are entry point to recursion
-        algorithmDouglasPeucker(entries, epsilon: epsilon, start: 0, end: entries.count - 1, keep: &keep)
+        // the buffers are only borrowed for the duration of the call
+        if (count >= parallelThreshold)
+        {
+            ChartDataApproximatorFilter.douglasPeuckerParallel(x: x, y: y, count: count, epsilon: epsilon, keep: &keep)
+        }
+        else
+        {
+            ChartDataApproximatorFilter.douglasPeucker(x: x, y: y, start: 0, end: count - 1, epsilon: epsilon, keep: &keep)
+        }
         
-        // create a new array with series, only take the kept ones
-        var reducedEntries = [ChartDataEntry]()
-        for (var i = 0; i < entries.count; i++)
+        var indices = [Int]()
+        for (var i = 0; i < count; i++)
         {
             if (keep[i])
             {
-                let curEntry = entries[i]
-                reducedEntries.append(ChartDataEntry(value: curEntry.value, xIndex: curEntry.xIndex))
+                indices.append(i)
             }
         }
         
-        return reducedEntries
+        return indices
     }
     
-    /// apply the Douglas-Peucker-Reduction to an ArrayList of Entry with a given epsilon (tolerance)
+    /// Finds the point of `start..<end` with the greatest angle to the line `start`-`end`, and keeps it if the angle exceeds epsilon.
     ///
-    /// - parameter entries:
-    /// - parameter epsilon: as y-value
-    /// - parameter start:
-    /// - parameter end:
-    private func algorithmDouglasPeucker(entries: [ChartDataEntry], epsilon: Double, start: Int, end: Int, inout keep: [Bool])
+    /// - returns: the kept point, or -1 if the range needs no further splitting.
+    private static func douglasPeuckerSplit(x x: UnsafePointer<Double>, y: UnsafePointer<Double>, start: Int, end: Int, epsilon: Double, keep: UnsafeMutablePointer<Bool>) -> Int
     {
         if (end <= start + 1)
         {
-            // recursion finished
-            return
+            return -1
         }
         
         // find the greatest distance between start and endpoint
         var maxDistIndex = Int(0)
         var distMax = Double(0.0)
         
-        let firstEntry = entries[start]
-        let lastEntry = entries[end]
+        let lineAngle = atan2(y[end] - y[start], x[end] - x[start]) * ChartUtils.Math.RAD2DEG
         
         for (var i = start + 1; i < end; i++)
         {
-            let dist = calcAngleBetweenLines(firstEntry, end1: lastEntry, start2: firstEntry, end2: entries[i])
+            let dist = fabs(lineAngle - atan2(y[i] - y[start], x[i] - x[start]) * ChartUtils.Math.RAD2DEG)
             
             // keep the point with the greatest distance
             if (dist > distMax)
@@ -159,11 +377,58 @@ public class ChartDataApproximatorFilter: ChartDataBaseFilter
         {
             // keep max dist point
             keep[maxDistIndex] = true
+            return maxDistIndex
+        }
+        
+        return -1 // else don't keep the point...
+    }
+    
+    /// Reduces `start...end` on the calling thread, with an explicit stack of ranges instead of recursion.
+    private static func douglasPeucker(x x: UnsafePointer<Double>, y: UnsafePointer<Double>, start: Int, end: Int, epsilon: Double, keep: UnsafeMutablePointer<Bool>)
+    {
+        // flat (start, end) pairs
+        var stack = [start, end]
+        
+        while (!stack.isEmpty)
+        {
+            let e = stack.removeLast()
+            let s = stack.removeLast()
             
-            // recursive call
-            algorithmDouglasPeucker(entries, epsilon: epsilon, start: start, end: maxDistIndex, keep: &keep)
-            algorithmDouglasPeucker(entries, epsilon: epsilon, start: maxDistIndex, end: end, keep: &keep)
-        } // else don't keep the point...
+            let split = douglasPeuckerSplit(x: x, y: y, start: s, end: e, epsilon: epsilon, keep: keep)
+            if (split >= 0)
+            {
+                stack.append(split)
+                stack.append(e)
+                stack.append(s)
+                stack.append(split)
+            }
+        }
+    }
+    
+    /// Splits breadth-first on the calling thread until there is a range per thread, then reduces the ranges concurrently.
+    /// Ranges never overlap except at their kept endpoints, so the threads write disjoint parts of `keep`.
+    private static func douglasPeuckerParallel(x x: UnsafePointer<Double>, y: UnsafePointer<Double>, count: Int, epsilon: Double, keep: UnsafeMutablePointer<Bool>)
+    {
+        let target = NSProcessInfo.processInfo().activeProcessorCount * 4
+        var ranges = [0, count - 1]
+        
+        while (ranges.count > 0 && ranges.count / 2 < target)
+        {
+            var next = [Int]()
+            for (var r = 0; r < ranges.count; r += 2)
+            {
+                let split = douglasPeuckerSplit(x: x, y: y, start: ranges[r], end: ranges[r + 1], epsilon: epsilon, keep: keep)
+                if (split >= 0)
+                {
+                    next += [ranges[r], split, split, ranges[r + 1]]
+                }
+            }
+            ranges = next
+        }
+        
+        dispatch_apply(ranges.count / 2, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)) { r in
+            ChartDataApproximatorFilter.douglasPeucker(x: x, y: y, start: ranges[2 * r], end: ranges[2 * r + 1], epsilon: epsilon, keep: keep)
+        }
     }
     
     /// calculate the distance between a line between two entries and an entry (point)
@@ -187,23 +452,6 @@ public class ChartDataApproximatorFilter: ChartDataBaseFilter
             * (xDiffEndStart))) / Double(normalLength)
     }
     
-    /// Calculates the angle between two given lines. The provided entries mark the starting and end points of the lines.
-    private func calcAngleBetweenLines(start1: ChartDataEntry, end1: ChartDataEntry, start2: ChartDataEntry, end2: ChartDataEntry) -> Double
-    {
-        let angle1 = calcAngleWithRatios(start1, p2: end1)
-        let angle2 = calcAngleWithRatios(start2, p2: end2)
-        
-        return fabs(angle1 - angle2)
-    }
-    
-    /// calculates the angle between two entries (points) in the chart taking ratios into consideration
-    private func calcAngleWithRatios(p1: ChartDataEntry, p2: ChartDataEntry) -> Double
-    {
-        let dx = Double(p2.xIndex) * Double(deltaRatio) - Double(p1.xIndex) * Double(deltaRatio)
-        let dy = p2.value * scaleRatio - p1.value * scaleRatio
-        return atan2(Double(dy), dx) * ChartUtils.Math.RAD2DEG
-    }
-    
     // calculates the angle between two entries (points) in the chart
     private func calcAngle(p1: ChartDataEntry, p2: ChartDataEntry) -> Double
     {
@@ -0,0 +1,213 @@
+//
+//  ChartHighlightIndex.swift
+//  Charts
+//
+//  Copyright 2015 Daniel Cohen Gindi & Philipp Jahoda
+//  A port of MPAndroidChart for iOS
+//  Licensed under Apache License 2.0
+//
+//  https://github.com/danielgindi/ios-charts
+//
+
+import Foundation
+import CoreGraphics
+
+/// The pixel positions of the values a `ChartHighlighter` chooses from, for one viewport.
+/// Values are bucketed in a grid of one column per x-index over a range of x-indices, and sorted by pixel-y within a column,
+/// one grid per axis. Finding the DataSet closest to a touch is a column lookup and a binary search in that column.
+internal class ChartHighlightIndex
+{
+    /// One axis' grid: the values of column `c` are `offsets[c]..<offsets[c + 1]`.
+    private struct Grid
+    {
+        var offsets = [Int]()
+        var pixelY = [Double]()
+        var dataSetIndex = [Int]()
+
+        /// the position of the DataSet in the order the highlighter visits DataSets, which breaks ties between equal distances
+        var order = [Int]()
+    }
+
+    /// the x-index of the first column
+    internal let fromXIndex: Int
+
+    /// the x-index of the last column
+    internal let toXIndex: Int
+
+    private var _grids = [Grid(), Grid()]
+
+    /// - parameter dataSets: the DataSets to choose from, in the order the highlighter visits them, with the DataSet index it reports for them
+    /// - parameter fromXIndex: the x-index of the first column
+    /// - parameter toXIndex: the x-index of the last column
+    /// - parameter transformer: the transformer for each axis
+    internal init(dataSets: [(dataSet: ChartDataSet, dataSetIndex: Int)], fromXIndex: Int, toXIndex: Int, transformer: (ChartYAxis.AxisDependency) -> ChartTransformer)
+    {
+        self.fromXIndex = fromXIndex
+        self.toXIndex = max(toXIndex, fromXIndex - 1)
+
+        let columnCount = self.toXIndex - fromXIndex + 1
+
+        for axis in [ChartYAxis.AxisDependency.Left, ChartYAxis.AxisDependency.Right]
+        {
+            var columns = [Int]()
+            var points = [CGPoint]()
+            var dataSetIndices = [Int]()
+            var orders = [Int]()
+
+            for (var order = 0; order < dataSets.count; order++)
+            {
+                let (dataSet, dataSetIndex) = dataSets[order]
+
+                // dont include datasets that cannot be highlighted
+                if (!dataSet.isHighlightEnabled || dataSet.axisDependency != axis)
+                {
+                    continue
+                }
+
+                // the first value at every x-index in the range, as `yValForXIndex` finds it
+                var lastXIndex = Int.min
+
+                let dataColumns = dataSet._columns
+                let entries: [ChartDataEntry] = dataColumns == nil ? dataSet._yVals : []
+
+                for (var i = max(dataSet.entryIndex(xIndex: fromXIndex), 0), count = dataSet.entryCount; i < count; i++)
+                {
+                    let xIndex: Int
+                    let value: Double
+
+                    if (dataColumns != nil)
+                    {
+                        xIndex = dataColumns!.xIndices[i]
+                        value = dataColumns!.values[i]
+                    }
+                    else
+                    {
+                        xIndex = entries[i].xIndex
+                        value = entries[i].value
+                    }
+
+                    if (xIndex > self.toXIndex)
+                    {
+                        break
+                    }
+
+                    if (xIndex < fromXIndex || xIndex == lastXIndex || value.isNaN)
+                    {
+                        continue
+                    }
+
+                    lastXIndex = xIndex
+
+                    columns.append(xIndex - fromXIndex)
+                    points.append(CGPoint(x: 0.0, y: CGFloat(value)))
+                    dataSetIndices.append(dataSetIndex)
+                    orders.append(order)
+                }
+            }
+
+            // all values of the axis go through its matrix in one pass
+            transformer(axis).pointValuesToPixel(&points)
+
+            let sorted = (0 ..< points.count).filter { !points[$0].y.isNaN }.sort { a, b in
+                if (columns[a] != columns[b])
+                {
+                    return columns[a] < columns[b]
+                }
+                if (points[a].y != points[b].y)
+                {
+                    return points[a].y < points[b].y
+                }
+                return orders[a] < orders[b]
+            }
+
+            var grid = Grid()
+            grid.offsets = [Int](count: columnCount + 1, repeatedValue: 0)
+            grid.pixelY.reserveCapacity(sorted.count)
+            grid.dataSetIndex.reserveCapacity(sorted.count)
+            grid.order.reserveCapacity(sorted.count)
+
+            for i in sorted
+            {
+                grid.offsets[columns[i] + 1]++
+                grid.pixelY.append(Double(points[i].y))
+                grid.dataSetIndex.append(dataSetIndices[i])
+                grid.order.append(orders[i])
+            }
+
+            for (var c = 0; c < columnCount; c++)
+            {
+                grid.offsets[c + 1] += grid.offsets[c]
+            }
+
+            _grids[axis == .Left ? 0 : 1] = grid
+        }
+    }
+
+    /// - returns: true if the index has a column for `xIndex`
+    internal func contains(xIndex xIndex: Int) -> Bool
+    {
+        return xIndex >= fromXIndex && xIndex <= toXIndex
+    }
+
+    /// Picks the DataSet like `ChartHighlighter.getDataSetIndex(...)` does: the axis with the value closest to `y`,
+    /// then the closest value on that axis, the first visited DataSet winning ties.
+    /// - parameter xIndex: an x-index the index contains
+    /// - parameter y: the touch position in pixels
+    /// - returns: the DataSet index, -Int.max if no DataSet has a value at `xIndex`
+    internal func closestDataSetIndex(xIndex xIndex: Int, y: Double) -> Int
+    {
+        let left = closest(grid: _grids[0], column: xIndex - fromXIndex, y: y)
+        let right = closest(grid: _grids[1], column: xIndex - fromXIndex, y: y)
+
+        return left.distance < right.distance ? left.dataSetIndex : right.dataSetIndex
+    }
+
+    /// - returns: the value of a column of `grid` closest to `y`, DBL_MAX and -Int.max if the column is empty
+    private func closest(grid grid: Grid, column: Int, y: Double) -> (distance: Double, dataSetIndex: Int)
+    {
+        let from = grid.offsets[column], to = grid.offsets[column + 1]
+
+        // the first value not less than `y`; equal values are sorted by visiting order, so it is the first visited of them
+        var low = from, high = to
+        while (low < high)
+        {
+            let m = (low + high) / 2
+            if (grid.pixelY[m] < y)
+            {
+                low = m + 1
+            }
+            else
+            {
+                high = m
+            }
+        }
+
+        var best = -1
+        var distance = DBL_MAX
+
+        if (low < to)
+        {
+            best = low
+            distance = grid.pixelY[low] - y
+        }
+
+        if (low > from)
+        {
+            // the first visited of the largest values less than `y`
+            var above = low - 1
+            while (above > from && grid.pixelY[above - 1] == grid.pixelY[above])
+            {
+                above--
+            }
+
+            let aboveDistance = y - grid.pixelY[above]
+            if (best < 0 || aboveDistance < distance || (aboveDistance == distance && grid.order[above] < grid.order[best]))
+            {
+                best = above
+                distance = aboveDistance
+            }
+        }
+
+        return best < 0 ? (DBL_MAX, -Int.max) : (distance, grid.dataSetIndex[best])
+    }
+}
@@ -20,6 +20,11 @@ internal class ChartHighlighter
     /// instance of the data-provider
     internal weak var _chart: BarLineChartViewBase?;
     
+    /// the pixel positions of the visible values, and what they were computed for
+    private var _index: ChartHighlightIndex?
+    private weak var _indexData: ChartData?
+    private var _indexKey = [Double]()
+    
     internal init(chart: BarLineChartViewBase)
     {
         _chart = chart;
@@ -67,6 +72,12 @@ internal class ChartHighlighter
     /// - returns:
     internal func getDataSetIndex(xIndex xIndex: Int, x: Double, y: Double) -> Int
     {
+        // inside the visible range, the index answers without visiting every DataSet
+        if let index = selectionIndex() where index.contains(xIndex: xIndex)
+        {
+            return index.closestDataSetIndex(xIndex: xIndex, y: y)
+        }
+        
         let valsAtIndex = getSelectionDetailsAtIndex(xIndex)
         
         let leftdist = ChartUtils.getMinimumDistance(valsAtIndex, val: y, axis: ChartYAxis.AxisDependency.Left)
@@ -87,10 +98,8 @@ internal class ChartHighlighter
         var vals = [ChartSelectionDetail]()
         var pt = CGPoint()
         
-        for (var i = 0, dataSetCount = _chart?.data?.dataSetCount; i < dataSetCount; i++)
+        for (dataSet, dataSetIndex) in selectableDataSets()
         {
-            let dataSet = _chart!.data!.getDataSetByIndex(i)
-            
             // dont include datasets that cannot be highlighted
             if !dataSet.isHighlightEnabled
             {
@@ -110,10 +119,64 @@ internal class ChartHighlighter
             
             if !pt.y.isNaN
             {
-                vals.append(ChartSelectionDetail(value: Double(pt.y), dataSetIndex: i, dataSet: dataSet))
+                vals.append(ChartSelectionDetail(value: Double(pt.y), dataSetIndex: dataSetIndex, dataSet: dataSet))
             }
         }
         
         return vals
     }
+    
+    /// - returns: the DataSets touches choose from, in the order they are visited, with the DataSet index a highlight reports for them
+    internal func selectableDataSets() -> [(dataSet: ChartDataSet, dataSetIndex: Int)]
+    {
+        var dataSets = [(dataSet: ChartDataSet, dataSetIndex: Int)]()
+        
+        for (var i = 0, dataSetCount = _chart?.data?.dataSetCount; i < dataSetCount; i++)
+        {
+            dataSets.append((dataSet: _chart!.data!.getDataSetByIndex(i)!, dataSetIndex: i))
+        }
+        
+        return dataSets
+    }
+    
+    /// Drops the index of the visible values, the next touch rebuilds it.
+    internal func invalidateIndex()
+    {
+        _index = nil
+    }
+    
+    /// - returns: the index of the values around the visible x-range, rebuilt when the viewport or the data changed since it was built
+    internal func selectionIndex() -> ChartHighlightIndex?
+    {
+        guard let chart = _chart, data = chart.data else { return nil }
+        
+        let dataSets = selectableDataSets()
+        let left = chart.getTransformer(.Left)
+        let right = chart.getTransformer(.Right)
+        
+        // one column either side of the visible range, for touches rounding to the x-index just outside
+        let fromXIndex = max(chart.lowestVisibleXIndex - 1, 0)
+        let toXIndex = min(chart.highestVisibleXIndex + 1, data.xValCount - 1)
+        
+        var key = [Double(fromXIndex), Double(toXIndex)]
+        for m in [left.valueToPixelMatrix, right.valueToPixelMatrix]
+        {
+            key += [Double(m.a), Double(m.b), Double(m.c), Double(m.d), Double(m.tx), Double(m.ty)]
+        }
+        for (dataSet, _) in dataSets
+        {
+            key += [Double(dataSet.entryCount), dataSet.yValueSum, dataSet.isHighlightEnabled ? 1.0 : 0.0, Double(dataSet.axisDependency.rawValue)]
+        }
+        
+        if (_index === nil || _indexData !== data || _indexKey != key)
+        {
+            _index = ChartHighlightIndex(dataSets: dataSets, fromXIndex: fromXIndex, toXIndex: toXIndex, transformer: { which in
+                which == .Left ? left : right
+            })
+            _indexData = data
+            _indexKey = key
+        }
+        
+        return _index
+    }
 }
@@ -22,51 +22,25 @@ internal class CombinedHighlighter: ChartHighlighter
         super.init(chart: chart)
     }
     
-    /// Returns a list of SelectionDetail object corresponding to the given xIndex.
-    /// - parameter xIndex:
-    /// - returns:
-    internal override func getSelectionDetailsAtIndex(xIndex: Int) -> [ChartSelectionDetail]
+    /// - returns: the DataSets of all the chart's data objects, with their index within their data object
+    internal override func selectableDataSets() -> [(dataSet: ChartDataSet, dataSetIndex: Int)]
     {
-        var vals = [ChartSelectionDetail]()
+        var dataSets = [(dataSet: ChartDataSet, dataSetIndex: Int)]()
         
         if let data = _chart?.data as? CombinedChartData
         {
             // get all chartdata objects
             var dataObjects = data.allData
             
-            var pt = CGPoint()
-            
             for var i = 0; i < dataObjects.count; i++
             {
                 for var j = 0; j < dataObjects[i].dataSetCount; j++
                 {
-                    let dataSet = dataObjects[i].getDataSetByIndex(j)
-                    
-                    // dont include datasets that cannot be highlighted
-                    if !dataSet.isHighlightEnabled
-                    {
-                        continue
-                    }
-                    
-                    // extract all y-values from all DataSets at the given x-index
-                    let yVal = dataSet.yValForXIndex(xIndex)
-                    if yVal.isNaN
-                    {
-                        continue
-                    }
-                    
-                    pt.y = CGFloat(yVal)
-                    
-                    _chart!.getTransformer(dataSet.axisDependency).pointValueToPixel(&pt)
-                    
-                    if !pt.y.isNaN
-                    {
-                        vals.append(ChartSelectionDetail(value: Double(pt.y), dataSetIndex: j, dataSet: dataSet))
-                    }
+                    dataSets.append((dataSet: dataObjects[i].getDataSetByIndex(j)!, dataSetIndex: j))
                 }
             }
         }
         
-        return vals
+        return dataSets
     }
 }
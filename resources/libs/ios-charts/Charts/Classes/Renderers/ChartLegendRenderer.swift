@@ -333,7 +333,7 @@ public class ChartLegendRenderer: ChartRendererBase
                     
                     if (direction == .RightToLeft)
                     {
-                        x -= (labels[i] as NSString!).sizeWithAttributes([NSFontAttributeName: labelFont]).width
+                        x -= ChartTextCache.sharedCache.size(text: labels[i]!, attributes: [NSFontAttributeName: labelFont]).width
                     }
                     
                     if (!wasStacked)
@@ -39,9 +39,11 @@ public class ChartXAxisRenderer: ChartAxisRendererBase
         
         let widthText = a as NSString
         
-        _xAxis.labelWidth = widthText.sizeWithAttributes([NSFontAttributeName: _xAxis.labelFont]).width
+        _xAxis.labelWidth = ChartTextCache.sharedCache.size(text: widthText as String, attributes: [NSFontAttributeName: _xAxis.labelFont]).width
         _xAxis.labelHeight = _xAxis.labelFont.lineHeight
         _xAxis.values = xValues
+        
+        _laidOutLabelsKey.removeAll()
     }
     
     public override func renderAxisLabels(context context: CGContext?)
@@ -133,39 +135,83 @@ public class ChartXAxisRenderer: ChartAxisRendererBase
             NSForegroundColorAttributeName: _xAxis.labelTextColor,
             NSParagraphStyleAttributeName: paraStyle]
         
-        let valueToPixelMatrix = transformer.valueToPixelMatrix
-        
-        var position = CGPoint(x: 0.0, y: 0.0)
-        
         var labelMaxSize = CGSize()
         
         if (_xAxis.isWordWrapEnabled)
         {
-            labelMaxSize.width = _xAxis.wordWrapWidthPercent * valueToPixelMatrix.a
+            labelMaxSize.width = _xAxis.wordWrapWidthPercent * transformer.valueToPixelMatrix.a
         }
         
+        for laidOut in laidOutLabels(attributes: labelAttrs, labelMaxSize: labelMaxSize)
+        {
+            drawLabel(context: context, label: laidOut.label, xIndex: laidOut.xIndex, x: laidOut.x, y: pos, align: .Center, attributes: labelAttrs, constrainedToSize: labelMaxSize)
+        }
+    }
+    
+    // MARK: - Label layout
+    
+    /// the visible labels of the last layout and their x-positions in pixels
+    private var _laidOutLabels = [(xIndex: Int, label: String, x: CGFloat)]()
+    
+    /// what `_laidOutLabels` were laid out for, see `labelLayoutKey`
+    private var _laidOutLabelsKey = [Double]()
+    
+    /// everything the label positions depend on: transform, visible range, label spacing, view port and label font
+    internal var labelLayoutKey: [Double]
+    {
+        let matrix = transformer.valueToPixelMatrix
+        
+        return [
+            Double(matrix.a), Double(matrix.b), Double(matrix.c), Double(matrix.d), Double(matrix.tx), Double(matrix.ty),
+            Double(_minX), Double(_maxX), Double(_xAxis.axisLabelModulus), Double(_xAxis.values.count),
+            Double(viewPortHandler.contentLeft), Double(viewPortHandler.contentRight),
+            Double(viewPortHandler.chartWidth), Double(viewPortHandler.offsetRight),
+            _xAxis.isAvoidFirstLastClippingEnabled ? 1.0 : 0.0, Double(_xAxis.labelFont.hash)]
+    }
+    
+    /// - returns: the x-value, before transforming, that the label at `xIndex` is centered on
+    internal func labelXValue(xIndex xIndex: Int) -> CGFloat
+    {
+        return CGFloat(xIndex)
+    }
+    
+    /// - returns: the labels in the visible range and their x-positions in pixels.
+    /// They are only laid out again when `labelLayoutKey` changes, so redraws of the same viewport reuse them.
+    internal func laidOutLabels(attributes attributes: [String : NSObject], labelMaxSize: CGSize) -> [(xIndex: Int, label: String, x: CGFloat)]
+    {
+        let key = labelLayoutKey + [Double(labelMaxSize.width)]
+        
+        if (key == _laidOutLabelsKey)
+        {
+            return _laidOutLabels
+        }
+        
+        let valueToPixelMatrix = transformer.valueToPixelMatrix
+        
+        var labels = [(xIndex: Int, label: String, x: CGFloat)]()
+        
+        var position = CGPoint(x: 0.0, y: 0.0)
+        
         for (var i = _minX, maxX = min(_maxX + 1, _xAxis.values.count); i < maxX; i += _xAxis.axisLabelModulus)
         {
-            let label = _xAxis.values[i]
+            let label = i >= 0 ? _xAxis.values[i] : nil
             if (label == nil)
             {
                 continue
             }
             
-            position.x = CGFloat(i)
+            position.x = labelXValue(xIndex: i)
             position.y = 0.0
             position = CGPointApplyAffineTransform(position, valueToPixelMatrix)
             
             if (viewPortHandler.isInBoundsX(position.x))
             {
-                let labelns = label! as NSString
-                
                 if (_xAxis.isAvoidFirstLastClippingEnabled)
                 {
                     // avoid clipping of the last
                     if (i == _xAxis.values.count - 1 && _xAxis.values.count > 1)
                     {
-                        let width = labelns.boundingRectWithSize(labelMaxSize, options: .UsesLineFragmentOrigin, attributes: labelAttrs, context: nil).size.width
+                        let width = ChartTextCache.sharedCache.size(text: label!, attributes: attributes, constrainedToSize: labelMaxSize).width
                         
                         if (width > viewPortHandler.offsetRight * 2.0
                             && position.x + width > viewPortHandler.chartWidth)
@@ -175,14 +221,19 @@ public class ChartXAxisRenderer: ChartAxisRendererBase
                     }
                     else if (i == 0)
                     { // avoid clipping of the first
-                        let width = labelns.boundingRectWithSize(labelMaxSize, options: .UsesLineFragmentOrigin, attributes: labelAttrs, context: nil).size.width
+                        let width = ChartTextCache.sharedCache.size(text: label!, attributes: attributes, constrainedToSize: labelMaxSize).width
                         position.x += width / 2.0
                     }
                 }
                 
-                drawLabel(context: context, label: label!, xIndex: i, x: position.x, y: pos, align: .Center, attributes: labelAttrs, constrainedToSize: labelMaxSize)
+                labels.append((xIndex: i, label: label!, x: position.x))
             }
         }
+        
+        _laidOutLabels = labels
+        _laidOutLabelsKey = key
+        
+        return labels
     }
     
     internal func drawLabel(context context: CGContext?, label: String, xIndex: Int, x: CGFloat, y: CGFloat, align: NSTextAlignment, attributes: [String: NSObject], constrainedToSize: CGSize)
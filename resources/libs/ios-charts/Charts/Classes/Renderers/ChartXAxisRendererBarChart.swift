@@ -34,71 +34,31 @@ public class ChartXAxisRendererBarChart: ChartXAxisRenderer
             return
         }
         
-        let paraStyle = NSParagraphStyle.defaultParagraphStyle().mutableCopy() as! NSMutableParagraphStyle
-        paraStyle.alignment = .Center
-        
-        let labelAttrs = [NSFontAttributeName: _xAxis.labelFont,
-            NSForegroundColorAttributeName: _xAxis.labelTextColor,
-            NSParagraphStyleAttributeName: paraStyle]
+        super.drawLabels(context: context, pos: pos)
+    }
+    
+    /// labels are centered on their group of bars
+    internal override var labelLayoutKey: [Double]
+    {
+        let barData = _chart.data as! BarChartData
         
+        return super.labelLayoutKey + [Double(barData.dataSetCount), Double(barData.groupSpace)]
+    }
+    
+    internal override func labelXValue(xIndex xIndex: Int) -> CGFloat
+    {
         let barData = _chart.data as! BarChartData
         let step = barData.dataSetCount
         
-        let valueToPixelMatrix = transformer.valueToPixelMatrix
-        
-        var position = CGPoint(x: 0.0, y: 0.0)
+        var x = CGFloat(xIndex * step) + CGFloat(xIndex) * barData.groupSpace + barData.groupSpace / 2.0
         
-        var labelMaxSize = CGSize()
-        
-        if (_xAxis.isWordWrapEnabled)
+        // consider groups (center label for each group)
+        if (step > 1)
         {
-            labelMaxSize.width = _xAxis.wordWrapWidthPercent * valueToPixelMatrix.a
+            x += (CGFloat(step) - 1.0) / 2.0
         }
         
-        for (var i = _minX, maxX = min(_maxX + 1, _xAxis.values.count); i < maxX; i += _xAxis.axisLabelModulus)
-        {
-            let label = i >= 0 && i < _xAxis.values.count ? _xAxis.values[i] : nil
-            if (label == nil)
-            {
-                continue
-            }
-            
-            position.x = CGFloat(i * step) + CGFloat(i) * barData.groupSpace + barData.groupSpace / 2.0
-            position.y = 0.0
-            
-            // consider groups (center label for each group)
-            if (step > 1)
-            {
-                position.x += (CGFloat(step) - 1.0) / 2.0
-            }
-            
-            position = CGPointApplyAffineTransform(position, valueToPixelMatrix)
-            
-            if (viewPortHandler.isInBoundsX(position.x))
-            {
-                if (_xAxis.isAvoidFirstLastClippingEnabled)
-                {
-                    // avoid clipping of the last
-                    if (i == _xAxis.values.count - 1)
-                    {
-                        let width = label!.sizeWithAttributes(labelAttrs).width
-                        
-                        if (width > viewPortHandler.offsetRight * 2.0
-                            && position.x + width > viewPortHandler.chartWidth)
-                        {
-                            position.x -= width / 2.0
-                        }
-                    }
-                    else if (i == 0)
-                    { // avoid clipping of the first
-                        let width = label!.sizeWithAttributes(labelAttrs).width
-                        position.x += width / 2.0
-                    }
-                }
-                
-                drawLabel(context: context, label: label!, xIndex: i, x: position.x, y: pos, align: .Center, attributes: labelAttrs, constrainedToSize: labelMaxSize)
-            }
-        }
+        return x
     }
     
     private var _gridLineSegmentsBuffer = [CGPoint](count: 2, repeatedValue: CGPoint())
@@ -26,8 +26,8 @@ public class ChartXAxisRendererHorizontalBarChart: ChartXAxisRendererBarChart
     {
         _xAxis.values = xValues
        
-        let longest = _xAxis.getLongestLabel() as NSString
-        let longestSize = longest.sizeWithAttributes([NSFontAttributeName: _xAxis.labelFont])
+        let longest = _xAxis.getLongestLabel()
+        let longestSize = ChartTextCache.sharedCache.size(text: longest, attributes: [NSFontAttributeName: _xAxis.labelFont])
         _xAxis.labelWidth = floor(longestSize.width + _xAxis.xOffset * 3.5)
         _xAxis.labelHeight = longestSize.height
     }
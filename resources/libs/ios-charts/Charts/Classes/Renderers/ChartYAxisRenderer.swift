@@ -234,15 +234,19 @@ public class ChartYAxisRenderer: ChartAxisRendererBase
         CGContextRestoreGState(context)
     }
     
+    /// the positions of the labels of the last layout, one per entry
+    private var _labelPositions = [CGPoint]()
+    
+    /// what `_labelPositions` were laid out for: transform, label offsets and the axis entries
+    private var _labelPositionsKey = [Double]()
+    
     /// draws the y-labels on the specified x-position
     internal func drawYLabels(context context: CGContext?, fixedPosition: CGFloat, offset: CGFloat, textAlign: NSTextAlignment)
     {
         let labelFont = _yAxis.labelFont
         let labelTextColor = _yAxis.labelTextColor
         
-        let valueToPixelMatrix = transformer.valueToPixelMatrix
-        
-        var pt = CGPoint()
+        let positions = labelPositions(fixedPosition: fixedPosition, offset: offset)
         
         for (var i = 0; i < _yAxis.entryCount; i++)
         {
@@ -253,15 +257,44 @@ public class ChartYAxisRenderer: ChartAxisRendererBase
                 break
             }
             
+            ChartUtils.drawText(context: context, text: text, point: positions[i], align: textAlign, attributes: [NSFontAttributeName: labelFont, NSForegroundColorAttributeName: labelTextColor])
+        }
+    }
+    
+    /// - returns: the position of the label of each entry, laid out again only when the transform, the offsets or the entries change
+    private func labelPositions(fixedPosition fixedPosition: CGFloat, offset: CGFloat) -> [CGPoint]
+    {
+        let valueToPixelMatrix = transformer.valueToPixelMatrix
+        
+        // with x at 0 only d and ty place a label vertically
+        let key = [Double(valueToPixelMatrix.d), Double(valueToPixelMatrix.ty), Double(fixedPosition), Double(offset)] + _yAxis.entries
+        
+        if (key == _labelPositionsKey)
+        {
+            return _labelPositions
+        }
+        
+        var positions = [CGPoint]()
+        positions.reserveCapacity(_yAxis.entryCount)
+        
+        var pt = CGPoint()
+        
+        for entry in _yAxis.entries
+        {
             pt.x = 0
-            pt.y = CGFloat(_yAxis.entries[i])
+            pt.y = CGFloat(entry)
             pt = CGPointApplyAffineTransform(pt, valueToPixelMatrix)
             
             pt.x = fixedPosition
             pt.y += offset
             
-            ChartUtils.drawText(context: context, text: text, point: pt, align: textAlign, attributes: [NSFontAttributeName: labelFont, NSForegroundColorAttributeName: labelTextColor])
+            positions.append(pt)
         }
+        
+        _labelPositions = positions
+        _labelPositionsKey = key
+        
+        return positions
     }
     
     private var _gridLineBuffer = [CGPoint](count: 2, repeatedValue: CGPoint())
@@ -49,6 +49,11 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
             return
         }
         
+        if (!_animator.isPacing && !_pacedFrames.isEmpty)
+        {
+            _pacedFrames.removeAll()
+        }
+        
         for (var i = 0; i < lineData.dataSetCount; i++)
         {
             let set = lineData.getDataSetByIndex(i)
@@ -79,9 +84,7 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
     
     internal func drawDataSet(context context: CGContext?, dataSet: LineChartDataSet)
     {
-        let entries = dataSet.yVals
-        
-        if (entries.count < 1)
+        if (dataSet.entryCount < 1)
         {
             return
         }
@@ -101,11 +104,15 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
         // if drawing cubic lines is enabled
         if (dataSet.isDrawCubicEnabled)
         {
-            drawCubic(context: context, dataSet: dataSet, entries: entries)
+            drawCubic(context: context, dataSet: dataSet, entries: dataSet.yVals)
+        }
+        else if let columns = dataSet._columns where dataSet.colors.count == 1 && !dataSet.isDrawFilledEnabled
+        { // straight single color lines read columnar DataSets without materializing entries
+            drawLinear(context: context, dataSet: dataSet, columns: columns)
         }
         else
         { // draw normal (straight) lines
-            drawLinear(context: context, dataSet: dataSet, entries: entries)
+            drawLinear(context: context, dataSet: dataSet, entries: dataSet.yVals)
         }
         
         CGContextRestoreGState(context)
@@ -244,71 +251,61 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
     
     private var _lineSegments = [CGPoint](count: 2, repeatedValue: CGPoint())
     
+    /// value label positions, reused between frames
+    private var _valuePositions = [CGPoint]()
+    
     internal func drawLinear(context context: CGContext?, dataSet: LineChartDataSet, entries: [ChartDataEntry])
     {
         let trans = delegate!.lineChartRenderer(self, transformerForAxis: dataSet.axisDependency)
-        let valueToPixelMatrix = trans.valueToPixelMatrix
         
         let phaseX = _animator.phaseX
         let phaseY = _animator.phaseY
         
         CGContextSaveGState(context)
         
-        let entryFrom = dataSet.entryForXIndex(_minX)
-        let entryTo = dataSet.entryForXIndex(_maxX)
-        
-        let minx = max(dataSet.entryIndex(entry: entryFrom!, isEqual: true), 0)
-        let maxx = min(dataSet.entryIndex(entry: entryTo!, isEqual: true) + 1, entries.count)
+        // binary searches for the visible x-range; the context is clipped to the content rect, so nothing else is culled
+        let (minx, maxx) = visibleEntryRange(dataSet)
         
         // more than 1 color
         if (dataSet.colors.count > 1)
         {
-            if (_lineSegments.count != 2)
+            let count = Int(ceil(CGFloat(maxx - minx) * phaseX + CGFloat(minx)))
+            let segmentCount = max(count - minx - 1, 1)
+            
+            if (_lineSegments.count < segmentCount * 2)
             {
-                _lineSegments = [CGPoint](count: 2, repeatedValue: CGPoint())
+                _lineSegments = [CGPoint](count: segmentCount * 2, repeatedValue: CGPoint())
             }
             
-            for (var j = minx, count = Int(ceil(CGFloat(maxx - minx) * phaseX + CGFloat(minx))); j < count; j++)
+            // segment k goes from entry minx + k to the next one, and has the color of entry minx + k
+            for (var k = 0, j = 0; k < segmentCount; k++)
             {
-                if (count > 1 && j == count - 1)
-                { // Last point, we have already drawn a line to this point
-                    break
-                }
+                let e1 = entries[minx + k]
+                let e2 = minx + k + 1 < count ? entries[minx + k + 1] : e1
                 
-                var e = entries[j]
-                
-                _lineSegments[0].x = CGFloat(e.xIndex)
-                _lineSegments[0].y = CGFloat(e.value) * phaseY
-                _lineSegments[0] = CGPointApplyAffineTransform(_lineSegments[0], valueToPixelMatrix)
-                if (j + 1 < count)
+                _lineSegments[j++] = CGPoint(x: CGFloat(e1.xIndex), y: CGFloat(e1.value))
+                _lineSegments[j++] = CGPoint(x: CGFloat(e2.xIndex), y: CGFloat(e2.value))
+            }
+            
+            trans.pointValuesToPixel(&_lineSegments, count: segmentCount * 2, phaseY: phaseY)
+            
+            // consecutive segments of the same color are stroked together, one color change per run
+            _lineSegments.withUnsafeBufferPointer { (segments: UnsafeBufferPointer<CGPoint>) -> Void in
+                for (var runStart = 0; runStart < segmentCount; )
                 {
-                    e = entries[j + 1]
+                    let color = dataSet.colorAt(minx + runStart)
                     
-                    _lineSegments[1].x = CGFloat(e.xIndex)
-                    _lineSegments[1].y = CGFloat(e.value) * phaseY
-                    _lineSegments[1] = CGPointApplyAffineTransform(_lineSegments[1], valueToPixelMatrix)
-                }
-                else
-                {
-                    _lineSegments[1] = _lineSegments[0]
-                }
-                
-                if (!viewPortHandler.isInBoundsRight(_lineSegments[0].x))
-                {
-                    break
-                }
-                
-                // make sure the lines don't do shitty things outside bounds
-                if (!viewPortHandler.isInBoundsLeft(_lineSegments[1].x)
-                    || (!viewPortHandler.isInBoundsTop(_lineSegments[0].y) && !viewPortHandler.isInBoundsBottom(_lineSegments[1].y))
-                    || (!viewPortHandler.isInBoundsTop(_lineSegments[0].y) && !viewPortHandler.isInBoundsBottom(_lineSegments[1].y)))
-                {
-                    continue
+                    var runEnd = runStart + 1
+                    while (runEnd < segmentCount && LineChartRenderer.isSameColor(dataSet.colorAt(minx + runEnd), color))
+                    {
+                        runEnd++
+                    }
+                    
+                    CGContextSetStrokeColorWithColor(context, color.CGColor)
+                    CGContextStrokeLineSegments(context, segments.baseAddress + runStart * 2, (runEnd - runStart) * 2)
+                    
+                    runStart = runEnd
                 }
-                
-                // get the color that is set for this line-segment
-                CGContextSetStrokeColorWithColor(context, dataSet.colorAt(j).CGColor)
-                CGContextStrokeLineSegments(context, _lineSegments, 2)
             }
         }
         else
@@ -326,16 +323,49 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
             
             let count = Int(ceil(CGFloat(maxx - minx) * phaseX + CGFloat(minx)))
             
-            for (var x = count > 1 ? minx + 1 : minx, j = 0; x < count; x++)
+            var size = max((count - minx - 1) * 2, 2)
+            
+            if (_animator.isPacing && dataSet.approximator == nil && count - minx > 1)
+            {
+                size = interpolatePacedSegments(dataSet: dataSet, trans: trans, minx: minx, maxx: maxx, count: count, phaseY: phaseY) { x in
+                    let e = entries[x]
+                    return CGPoint(x: CGFloat(e.xIndex), y: CGFloat(e.value))
+                }
+            }
+            else
             {
-                e1 = entries[x == 0 ? 0 : (x - 1)]
-                e2 = entries[x]
+                // reduce to a few entries per pixel column, if the DataSet asks for it
+                let columns = Int(ceil(viewPortHandler.contentWidth * UIScreen.mainScreen().scale))
                 
-                _lineSegments[j++] = CGPointApplyAffineTransform(CGPoint(x: CGFloat(e1.xIndex), y: CGFloat(e1.value) * phaseY), valueToPixelMatrix)
-                _lineSegments[j++] = CGPointApplyAffineTransform(CGPoint(x: CGFloat(e2.xIndex), y: CGFloat(e2.value) * phaseY), valueToPixelMatrix)
+                if let reduced = dataSet.approximator?.reducedIndices(entries, from: minx, to: count, columns: columns)
+                {
+                    size = max((reduced.count - 1) * 2, 2)
+                    
+                    for (var k = 1, j = 0; k < reduced.count; k++)
+                    {
+                        e1 = entries[reduced[k - 1]]
+                        e2 = entries[reduced[k]]
+                        
+                        _lineSegments[j++] = CGPoint(x: CGFloat(e1.xIndex), y: CGFloat(e1.value))
+                        _lineSegments[j++] = CGPoint(x: CGFloat(e2.xIndex), y: CGFloat(e2.value))
+                    }
+                }
+                else
+                {
+                    for (var x = count > 1 ? minx + 1 : minx, j = 0; x < count; x++)
+                    {
+                        e1 = entries[x == 0 ? 0 : (x - 1)]
+                        e2 = entries[x]
+                        
+                        _lineSegments[j++] = CGPoint(x: CGFloat(e1.xIndex), y: CGFloat(e1.value))
+                        _lineSegments[j++] = CGPoint(x: CGFloat(e2.xIndex), y: CGFloat(e2.value))
+                    }
+                }
+                
+                // all segments go through the matrix, and the animation phase, in one pass
+                trans.pointValuesToPixel(&_lineSegments, count: size, phaseY: phaseY)
             }
             
-            let size = max((count - minx - 1) * 2, 2)
             CGContextSetStrokeColorWithColor(context, dataSet.colorAt(0).CGColor)
             CGContextStrokeLineSegments(context, _lineSegments, size)
         }
@@ -349,6 +379,139 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
         }
     }
     
+    /// Straight single color lines, read from the buffers of a columnar DataSet.
+    internal func drawLinear(context context: CGContext?, dataSet: LineChartDataSet, columns: ChartDataColumns)
+    {
+        let trans = delegate!.lineChartRenderer(self, transformerForAxis: dataSet.axisDependency)
+        
+        let phaseX = _animator.phaseX
+        let phaseY = _animator.phaseY
+        
+        let (minx, maxx) = visibleEntryRange(dataSet)
+        let count = Int(ceil(CGFloat(maxx - minx) * phaseX + CGFloat(minx)))
+        
+        if (_lineSegments.count != max((columns.count - 1) * 2, 2))
+        {
+            _lineSegments = [CGPoint](count: max((columns.count - 1) * 2, 2), repeatedValue: CGPoint())
+        }
+        
+        var j = 0
+        
+        if (_animator.isPacing && count - minx > 1)
+        {
+            j = interpolatePacedSegments(dataSet: dataSet, trans: trans, minx: minx, maxx: maxx, count: count, phaseY: phaseY) { x in
+                CGPoint(x: CGFloat(columns.xIndices[x]), y: CGFloat(columns.values[x]))
+            }
+        }
+        else
+        {
+            var previous = CGPoint(x: CGFloat(columns.xIndices[minx]), y: CGFloat(columns.values[minx]))
+            
+            for (var x = minx + 1; x < count; x++)
+            {
+                let point = CGPoint(x: CGFloat(columns.xIndices[x]), y: CGFloat(columns.values[x]))
+                
+                _lineSegments[j++] = previous
+                _lineSegments[j++] = point
+                previous = point
+            }
+            
+            if (j == 0)
+            {
+                // a single point
+                _lineSegments[j++] = previous
+                _lineSegments[j++] = previous
+            }
+            
+            trans.pointValuesToPixel(&_lineSegments, count: j, phaseY: phaseY)
+        }
+        
+        CGContextSaveGState(context)
+        CGContextSetStrokeColorWithColor(context, dataSet.colorAt(0).CGColor)
+        CGContextStrokeLineSegments(context, _lineSegments, j)
+        CGContextRestoreGState(context)
+    }
+    
+    /// Pixel positions of the visible segments of a DataSet at phaseY 0 and 1, for paced animations.
+    private class PacedFrames
+    {
+        /// what the positions were computed for: visible range, matrix and DataSet contents
+        let key: [Double]
+        var start: [CGPoint]
+        var end: [CGPoint]
+        
+        init(key: [Double], end: [CGPoint])
+        {
+            self.key = key
+            self.start = end
+            self.end = end
+        }
+    }
+    
+    /// precomputed segments of the DataSets drawn during the current paced animation
+    private var _pacedFrames = [ObjectIdentifier: PacedFrames]()
+    
+    /// Writes the first `count - minx - 1` segments of the visible range into `_lineSegments`, at `phaseY`, for paced animations.
+    /// The segments of the whole visible range are transformed once at phaseY 0 and 1, every frame only interpolates between them.
+    /// - parameter point: the value space point of the entry at an index
+    /// - returns: the number of points written
+    private func interpolatePacedSegments(dataSet dataSet: ChartDataSet, trans: ChartTransformer, minx: Int, maxx: Int, count: Int, phaseY: CGFloat, point: (Int) -> CGPoint) -> Int
+    {
+        let matrix = trans.valueToPixelMatrix
+        let key = [Double(minx), Double(maxx), Double(dataSet.entryCount), dataSet.yValueSum,
+            Double(matrix.a), Double(matrix.b), Double(matrix.c), Double(matrix.d), Double(matrix.tx), Double(matrix.ty)]
+        
+        var frames: PacedFrames! = _pacedFrames[ObjectIdentifier(dataSet)]
+        
+        if (frames === nil || frames.key != key)
+        {
+            var segments = [CGPoint](count: max((maxx - minx - 1) * 2, 0), repeatedValue: CGPoint())
+            
+            for (var x = minx + 1, j = 0; x < maxx; x++)
+            {
+                segments[j++] = point(x - 1)
+                segments[j++] = point(x)
+            }
+            
+            frames = PacedFrames(key: key, end: segments)
+            trans.pointValuesToPixel(&frames.start, count: segments.count, phaseY: 0.0)
+            trans.pointValuesToPixel(&frames.end, count: segments.count, phaseY: 1.0)
+            
+            _pacedFrames[ObjectIdentifier(dataSet)] = frames
+        }
+        
+        let size = min((count - minx - 1) * 2, frames.end.count)
+        
+        if (_lineSegments.count < size)
+        {
+            _lineSegments = [CGPoint](count: size, repeatedValue: CGPoint())
+        }
+        
+        ChartTransformer.interpolatePoints(frames.start, to: frames.end, t: phaseY, result: &_lineSegments, count: size)
+        
+        return size
+    }
+    
+    /// - returns: true if both colors stroke the same, checking identity first as colors are usually shared objects
+    private static func isSameColor(c1: UIColor, _ c2: UIColor) -> Bool
+    {
+        return c1 === c2 || c1.isEqual(c2)
+    }
+    
+    /// - returns: the indices of the entries, `minx..<maxx`, covering the visible x-range
+    private func visibleEntryRange(dataSet: ChartDataSet) -> (minx: Int, maxx: Int)
+    {
+        if let columns = dataSet._columns
+        {
+            return (max(columns.entryIndex(xIndex: _minX), 0), min(columns.entryIndex(xIndex: _maxX) + 1, columns.count))
+        }
+        
+        let entryFrom = dataSet.entryForXIndex(_minX)
+        let entryTo = dataSet.entryForXIndex(_maxX)
+        
+        return (max(dataSet.entryIndex(entry: entryFrom!, isEqual: true), 0), min(dataSet.entryIndex(entry: entryTo!, isEqual: true) + 1, dataSet.entryCount))
+    }
+    
     internal func drawLinearFill(context context: CGContext?, dataSet: LineChartDataSet, entries: [ChartDataEntry], minx: Int, maxx: Int, trans: ChartTransformer)
     {
         CGContextSaveGState(context)
@@ -442,22 +605,30 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
                     valOffset = valOffset / 2
                 }
                 
-                var entries = dataSet.yVals
+                let columns = dataSet._columns
+                let entries = columns == nil ? dataSet.yVals : [ChartDataEntry]()
                 
-                let entryFrom = dataSet.entryForXIndex(_minX)
-                let entryTo = dataSet.entryForXIndex(_maxX)
+                let (minx, maxx) = visibleEntryRange(dataSet)
                 
-                let minx = max(dataSet.entryIndex(entry: entryFrom!, isEqual: true), 0)
-                let maxx = min(dataSet.entryIndex(entry: entryTo!, isEqual: true) + 1, entries.count)
+                let count = columns != nil
+                    ? trans.transformValuesLine(
+                        columns!,
+                        phaseX: _animator.phaseX,
+                        phaseY: _animator.phaseY,
+                        from: minx,
+                        to: maxx,
+                        buffer: &_valuePositions)
+                    : trans.transformValuesLine(
+                        entries,
+                        phaseX: _animator.phaseX,
+                        phaseY: _animator.phaseY,
+                        from: minx,
+                        to: maxx,
+                        buffer: &_valuePositions)
                 
-                var positions = trans.generateTransformedValuesLine(
-                    entries,
-                    phaseX: _animator.phaseX,
-                    phaseY: _animator.phaseY,
-                    from: minx,
-                    to: maxx)
+                let positions = _valuePositions
                 
-                for (var j = 0, count = positions.count; j < count; j++)
+                for (var j = 0; j < count; j++)
                 {
                     if (!viewPortHandler.isInBoundsRight(positions[j].x))
                     {
@@ -469,7 +640,7 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
                         continue
                     }
                     
-                    let val = entries[j + minx].value
+                    let val = columns != nil ? columns!.values[j + minx] : entries[j + minx].value
                     
                     ChartUtils.drawText(context: context, text: formatter!.stringFromNumber(val)!, point: CGPoint(x: positions[j].x, y: positions[j].y - CGFloat(valOffset) - valueFont.lineHeight), align: .Center, attributes: [NSFontAttributeName: valueFont, NSForegroundColorAttributeName: valueTextColor])
                 }
@@ -508,7 +679,8 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
             let trans = delegate!.lineChartRenderer(self, transformerForAxis: dataSet.axisDependency)
             let valueToPixelMatrix = trans.valueToPixelMatrix
             
-            var entries = dataSet.yVals
+            let columns = dataSet._columns
+            let entries = columns == nil ? dataSet.yVals : [ChartDataEntry]()
             
             let circleRadius = dataSet.circleRadius
             let circleDiameter = circleRadius * 2.0
@@ -516,17 +688,21 @@ public class LineChartRenderer: LineScatterCandleRadarChartRenderer
             let circleHoleRadius = circleHoleDiameter / 2.0
             let isDrawCircleHoleEnabled = dataSet.isDrawCircleHoleEnabled
             
-            let entryFrom = dataSet.entryForXIndex(_minX)!
-            let entryTo = dataSet.entryForXIndex(_maxX)!
-            
-            let minx = max(dataSet.entryIndex(entry: entryFrom, isEqual: true), 0)
-            let maxx = min(dataSet.entryIndex(entry: entryTo, isEqual: true) + 1, entries.count)
+            let (minx, maxx) = visibleEntryRange(dataSet)
             
             for (var j = minx, count = Int(ceil(CGFloat(maxx - minx) * phaseX + CGFloat(minx))); j < count; j++)
             {
-                let e = entries[j]
-                pt.x = CGFloat(e.xIndex)
-                pt.y = CGFloat(e.value) * phaseY
+                if (columns != nil)
+                {
+                    pt.x = CGFloat(columns!.xIndices[j])
+                    pt.y = CGFloat(columns!.values[j]) * phaseY
+                }
+                else
+                {
+                    let e = entries[j]
+                    pt.x = CGFloat(e.xIndex)
+                    pt.y = CGFloat(e.value) * phaseY
+                }
                 pt = CGPointApplyAffineTransform(pt, valueToPixelMatrix)
                 
                 if (!viewPortHandler.isInBoundsRight(pt.x))
@@ -15,9 +15,21 @@ import Foundation
 import CoreGraphics
 import UIKit
 
+@objc
+public protocol PieChartRendererDelegate
+{
+    func pieChartRendererData(renderer: PieChartRenderer) -> ChartData!
+    func pieChartRendererCircleBox(renderer: PieChartRenderer) -> CGRect
+    func pieChartRendererRotationAngle(renderer: PieChartRenderer) -> CGFloat
+    func pieChartRendererDrawAngles(renderer: PieChartRenderer) -> [CGFloat]
+    func pieChartRendererAbsoluteAngles(renderer: PieChartRenderer) -> [CGFloat]
+    func pieChartDefaultRendererValueFormatter(renderer: PieChartRenderer) -> NSNumberFormatter!
+    func pieChartRenderer(renderer: PieChartRenderer, needsHighlightXIndex xIndex: Int, dataSetIndex: Int) -> Bool
+}
+
 public class PieChartRenderer: ChartDataRendererBase
 {
-    internal weak var _chart: PieChartView!
+    public weak var delegate: PieChartRendererDelegate?
     
     public var drawHoleEnabled = true
     public var holeTransparent = true
@@ -33,18 +45,18 @@ public class PieChartRenderer: ChartDataRendererBase
     public var centerTextLineBreakMode = NSLineBreakMode.ByTruncatingTail
     public var centerTextRadiusPercent: CGFloat = 1.0
     
-    public init(chart: PieChartView, animator: ChartAnimator?, viewPortHandler: ChartViewPortHandler)
+    public init(delegate: PieChartRendererDelegate?, animator: ChartAnimator?, viewPortHandler: ChartViewPortHandler)
     {
         super.init(animator: animator, viewPortHandler: viewPortHandler)
         
-        _chart = chart
+        self.delegate = delegate
     }
     
     public override func drawData(context context: CGContext?)
     {
-        if (_chart !== nil)
+        if (delegate !== nil)
         {
-            let pieData = _chart.data
+            let pieData = delegate!.pieChartRendererData(self)
             
             if (pieData != nil)
             {
@@ -61,14 +73,15 @@ public class PieChartRenderer: ChartDataRendererBase
     
     internal func drawDataSet(context context: CGContext?, dataSet: PieChartDataSet)
     {
-        var angle = _chart.rotationAngle
+        var angle = delegate!.pieChartRendererRotationAngle(self)
         
         var cnt = 0
         
         var entries = dataSet.yVals
-        var drawAngles = _chart.drawAngles
-        let circleBox = _chart.circleBox
-        let radius = _chart.radius
+        var drawAngles = delegate!.pieChartRendererDrawAngles(self)
+        let circleBox = delegate!.pieChartRendererCircleBox(self)
+        let radius = circleBox.width / 2.0
+        let dataSetIndex = delegate!.pieChartRendererData(self).indexOfDataSet(dataSet)
         let innerRadius = drawHoleEnabled && holeTransparent ? radius * holeRadiusPercent : 0.0
         
         CGContextSaveGState(context)
@@ -83,8 +96,7 @@ public class PieChartRenderer: ChartDataRendererBase
             // draw only if the value is greater than zero
             if ((abs(e.value) > 0.000001))
             {
-                if (!_chart.needsHighlight(xIndex: e.xIndex,
-                    dataSetIndex: _chart.data!.indexOfDataSet(dataSet)))
+                if (!delegate!.pieChartRenderer(self, needsHighlightXIndex: e.xIndex, dataSetIndex: dataSetIndex))
                 {
                     let startAngle = angle + sliceSpace / 2.0
                     var sweepAngle = newangle * _animator.phaseY
@@ -123,30 +135,31 @@ public class PieChartRenderer: ChartDataRendererBase
     
     public override func drawValues(context context: CGContext?)
     {
-        let center = _chart.centerCircleBox
+        let circleBox = delegate!.pieChartRendererCircleBox(self)
+        let center = CGPoint(x: circleBox.midX, y: circleBox.midY)
         
         // get whole the radius
-        var r = _chart.radius
-        let rotationAngle = _chart.rotationAngle
-        var drawAngles = _chart.drawAngles
-        var absoluteAngles = _chart.absoluteAngles
+        var r = circleBox.width / 2.0
+        let rotationAngle = delegate!.pieChartRendererRotationAngle(self)
+        var drawAngles = delegate!.pieChartRendererDrawAngles(self)
+        var absoluteAngles = delegate!.pieChartRendererAbsoluteAngles(self)
         
         var off = r / 10.0 * 3.0
         
         if (drawHoleEnabled)
         {
-            off = (r - (r * _chart.holeRadiusPercent)) / 2.0
+            off = (r - (r * holeRadiusPercent)) / 2.0
         }
         
         r -= off; // offset to keep things inside the chart
         
-        let data: ChartData! = _chart.data
+        let data: ChartData! = delegate!.pieChartRendererData(self)
         if (data === nil)
         {
             return
         }
         
-        let defaultValueFormatter = _chart.valueFormatter
+        let defaultValueFormatter = delegate!.pieChartDefaultRendererValueFormatter(self)
         
         var dataSets = data.dataSets
         let drawXVals = drawXLabelsEnabled
@@ -229,13 +242,14 @@ public class PieChartRenderer: ChartDataRendererBase
     /// draws the hole in the center of the chart and the transparent circle / hole
     private func drawHole(context context: CGContext?)
     {
-        if (_chart.drawHoleEnabled)
+        if (drawHoleEnabled)
         {
             CGContextSaveGState(context)
             
-            let radius = _chart.radius
+            let circleBox = delegate!.pieChartRendererCircleBox(self)
+            let radius = circleBox.width / 2.0
             let holeRadius = radius * holeRadiusPercent
-            let center = _chart.centerCircleBox
+            let center = CGPoint(x: circleBox.midX, y: circleBox.midY)
             
             if (holeColor !== nil && holeColor != UIColor.clearColor())
             {
@@ -264,8 +278,10 @@ public class PieChartRenderer: ChartDataRendererBase
     {
         if (drawCenterTextEnabled && centerText != nil && centerText.characters.count > 0)
         {
-            let center = _chart.centerCircleBox
-            let innerRadius = drawHoleEnabled && holeTransparent ? _chart.radius * holeRadiusPercent : _chart.radius
+            let circleBox = delegate!.pieChartRendererCircleBox(self)
+            let center = CGPoint(x: circleBox.midX, y: circleBox.midY)
+            let radius = circleBox.width / 2.0
+            let innerRadius = drawHoleEnabled && holeTransparent ? radius * holeRadiusPercent : radius
             let holeRect = CGRect(x: center.x - innerRadius, y: center.y - innerRadius, width: innerRadius * 2.0, height: innerRadius * 2.0)
             var boundingRect = holeRect
             
@@ -304,20 +320,22 @@ public class PieChartRenderer: ChartDataRendererBase
     
     public override func drawHighlighted(context context: CGContext?, indices: [ChartHighlight])
     {
-        if (_chart.data === nil)
+        let data: ChartData! = delegate!.pieChartRendererData(self)
+        if (data === nil)
         {
             return
         }
         
         CGContextSaveGState(context)
         
-        let rotationAngle = _chart.rotationAngle
+        let rotationAngle = delegate!.pieChartRendererRotationAngle(self)
         var angle = CGFloat(0.0)
         
-        var drawAngles = _chart.drawAngles
-        var absoluteAngles = _chart.absoluteAngles
+        var drawAngles = delegate!.pieChartRendererDrawAngles(self)
+        var absoluteAngles = delegate!.pieChartRendererAbsoluteAngles(self)
         
-        let innerRadius = drawHoleEnabled && holeTransparent ? _chart.radius * holeRadiusPercent : 0.0
+        let circleBox = delegate!.pieChartRendererCircleBox(self)
+        let innerRadius = drawHoleEnabled && holeTransparent ? circleBox.width / 2.0 * holeRadiusPercent : 0.0
         
         for (var i = 0; i < indices.count; i++)
         {
@@ -328,7 +346,7 @@ public class PieChartRenderer: ChartDataRendererBase
                 continue
             }
             
-            let set = _chart.data?.getDataSetByIndex(indices[i].dataSetIndex) as! PieChartDataSet!
+            let set = data.getDataSetByIndex(indices[i].dataSetIndex) as! PieChartDataSet!
             
             if (set === nil || !set.isHighlightEnabled)
             {
@@ -349,7 +367,6 @@ public class PieChartRenderer: ChartDataRendererBase
             let sliceDegrees = drawAngles[xIndex]
             
             let shift = set.selectionShift
-            let circleBox = _chart.circleBox
             
             let highlighted = CGRect(
                 x: circleBox.origin.x - shift,
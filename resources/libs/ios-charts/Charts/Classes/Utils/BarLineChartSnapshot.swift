@@ -0,0 +1,270 @@
+//
+//  BarLineChartSnapshot.swift
+//  Charts
+//
+//  Copyright 2015 Daniel Cohen Gindi & Philipp Jahoda
+//  A port of MPAndroidChart for iOS
+//  Licensed under Apache License 2.0
+//
+//  https://github.com/danielgindi/ios-charts
+//
+
+import Foundation
+import CoreGraphics
+import UIKit
+
+/// Snapshot of a line or bar chart (`LineChartRenderer`, `BarChartRenderer`, `HorizontalBarChartRenderer`).
+internal class BarLineChartSnapshot: ChartSnapshot, LineChartRendererDelegate, BarChartRendererDelegate
+{
+    private let _leftAxisTransformer: ChartTransformer
+    private let _rightAxisTransformer: ChartTransformer
+
+    private let _leftAxisInverted: Bool
+    private let _rightAxisInverted: Bool
+
+    private let _chartXMin: Double
+    private let _chartXMax: Double
+    private let _chartYMin: Double
+    private let _chartYMax: Double
+
+    private let _maxVisibleValueCount: Int
+
+    private var _defaultValueFormatter: NSNumberFormatter!
+    private var _fillFormatter: ChartFillFormatter!
+
+    private var _drawHighlightArrowEnabled = false
+    private var _drawValueAboveBarEnabled = true
+    private var _drawBarShadowEnabled = false
+
+    /// - returns: true if the renderer of `chart` can draw from a snapshot
+    internal static func canSnapshot(chart: BarLineChartViewBase) -> Bool
+    {
+        return (chart.renderer as? LineChartRenderer)?.delegate !== nil || (chart.renderer as? BarChartRenderer)?.delegate !== nil
+    }
+
+    internal init(chart: BarLineChartViewBase, transparent: Bool)
+    {
+        chart.prepareForDrawing()
+
+        let layers = chart.staticLayerImages()
+
+        _leftAxisInverted = chart.leftAxis.isInverted
+        _rightAxisInverted = chart.rightAxis.isInverted
+
+        _chartXMin = chart.chartXMin
+        _chartXMax = chart.chartXMax
+        _chartYMin = chart.chartYMin
+        _chartYMax = chart.chartYMax
+
+        _maxVisibleValueCount = chart.maxVisibleValueCount
+
+        // the transformers have to map into the copied viewport, which only exists after super.init
+        let viewPortHandler = chart.viewPortHandler.copy() as! ChartViewPortHandler
+        _leftAxisTransformer = chart.getTransformer(.Left).copy(viewPortHandler: viewPortHandler)
+        _rightAxisTransformer = chart.getTransformer(.Right).copy(viewPortHandler: viewPortHandler)
+
+        super.init(chart: chart, viewPortHandler: viewPortHandler, transparent: transparent)
+
+        _backgroundImage = layers.background
+        _foregroundImage = layers.foreground
+
+        if let renderer = chart.renderer as? LineChartRenderer, delegate = renderer.delegate
+        {
+            _defaultValueFormatter = delegate.lineChartDefaultRendererValueFormatter(renderer).copy() as! NSNumberFormatter
+
+            // fill formatters may read the chart, so the fill positions are taken now
+            let fillFormatter = delegate.lineChartRendererFillFormatter(renderer)
+            let lineData = delegate.lineChartRendererData(renderer)
+            var fillPositions = [CGFloat]()
+            for set in lineData.dataSets as! [LineChartDataSet]
+            {
+                fillPositions.append(fillFormatter.getFillLinePosition(dataSet: set, data: lineData, chartMaxY: _chartYMax, chartMinY: _chartYMin))
+            }
+            _fillFormatter = ChartSnapshotFillFormatter(positions: fillPositions)
+
+            _renderer = LineChartRenderer(delegate: self, animator: _animator, viewPortHandler: _viewPortHandler)
+        }
+        else if let renderer = chart.renderer as? BarChartRenderer, delegate = renderer.delegate
+        {
+            _defaultValueFormatter = delegate.barChartDefaultRendererValueFormatter(renderer).copy() as! NSNumberFormatter
+            _drawHighlightArrowEnabled = delegate.barChartIsDrawHighlightArrowEnabled(renderer)
+            _drawValueAboveBarEnabled = delegate.barChartIsDrawValueAboveBarEnabled(renderer)
+            _drawBarShadowEnabled = delegate.barChartIsDrawBarShadowEnabled(renderer)
+
+            if (renderer is HorizontalBarChartRenderer)
+            {
+                _renderer = HorizontalBarChartRenderer(delegate: self, animator: _animator, viewPortHandler: _viewPortHandler)
+            }
+            else
+            {
+                _renderer = BarChartRenderer(delegate: self, animator: _animator, viewPortHandler: _viewPortHandler)
+            }
+        }
+
+        _renderer._minX = chart.renderer!._minX
+        _renderer._maxX = chart.renderer!._maxX
+    }
+
+    internal override func drawChart(context context: CGContext?)
+    {
+        let rect = CGRect(origin: CGPoint(x: 0, y: 0), size: _size)
+
+        _backgroundImage?.drawInRect(rect)
+
+        // make sure the graph values cannot be drawn outside the content-rect
+        CGContextSaveGState(context)
+        CGContextClipToRect(context, _viewPortHandler.contentRect)
+
+        _renderer.drawData(context: context)
+
+        CGContextRestoreGState(context)
+
+        _foregroundImage?.drawInRect(rect)
+
+        if (!_indicesToHighlight.isEmpty)
+        {
+            CGContextSaveGState(context)
+            CGContextClipToRect(context, _viewPortHandler.contentRect)
+
+            _renderer.drawHighlighted(context: context, indices: _indicesToHighlight)
+
+            CGContextRestoreGState(context)
+        }
+
+        _renderer.drawExtras(context: context)
+
+        _renderer.drawValues(context: context)
+    }
+
+    private func transformer(which: ChartYAxis.AxisDependency) -> ChartTransformer
+    {
+        return which == .Left ? _leftAxisTransformer : _rightAxisTransformer
+    }
+
+    // MARK: - LineChartRendererDelegate
+
+    internal func lineChartRendererData(renderer: LineChartRenderer) -> LineChartData!
+    {
+        return _data as! LineChartData!
+    }
+
+    internal func lineChartRenderer(renderer: LineChartRenderer, transformerForAxis which: ChartYAxis.AxisDependency) -> ChartTransformer!
+    {
+        return transformer(which)
+    }
+
+    internal func lineChartRendererFillFormatter(renderer: LineChartRenderer) -> ChartFillFormatter
+    {
+        return _fillFormatter
+    }
+
+    internal func lineChartDefaultRendererValueFormatter(renderer: LineChartRenderer) -> NSNumberFormatter!
+    {
+        return _defaultValueFormatter
+    }
+
+    internal func lineChartRendererChartYMax(renderer: LineChartRenderer) -> Double
+    {
+        return _chartYMax
+    }
+
+    internal func lineChartRendererChartYMin(renderer: LineChartRenderer) -> Double
+    {
+        return _chartYMin
+    }
+
+    internal func lineChartRendererChartXMax(renderer: LineChartRenderer) -> Double
+    {
+        return _chartXMax
+    }
+
+    internal func lineChartRendererChartXMin(renderer: LineChartRenderer) -> Double
+    {
+        return _chartXMin
+    }
+
+    internal func lineChartRendererMaxVisibleValueCount(renderer: LineChartRenderer) -> Int
+    {
+        return _maxVisibleValueCount
+    }
+
+    // MARK: - BarChartRendererDelegate
+
+    internal func barChartRendererData(renderer: BarChartRenderer) -> BarChartData!
+    {
+        return _data as! BarChartData!
+    }
+
+    internal func barChartRenderer(renderer: BarChartRenderer, transformerForAxis which: ChartYAxis.AxisDependency) -> ChartTransformer!
+    {
+        return transformer(which)
+    }
+
+    internal func barChartRendererMaxVisibleValueCount(renderer: BarChartRenderer) -> Int
+    {
+        return _maxVisibleValueCount
+    }
+
+    internal func barChartDefaultRendererValueFormatter(renderer: BarChartRenderer) -> NSNumberFormatter!
+    {
+        return _defaultValueFormatter
+    }
+
+    internal func barChartRendererChartYMax(renderer: BarChartRenderer) -> Double
+    {
+        return _chartYMax
+    }
+
+    internal func barChartRendererChartYMin(renderer: BarChartRenderer) -> Double
+    {
+        return _chartYMin
+    }
+
+    internal func barChartRendererChartXMax(renderer: BarChartRenderer) -> Double
+    {
+        return _chartXMax
+    }
+
+    internal func barChartRendererChartXMin(renderer: BarChartRenderer) -> Double
+    {
+        return _chartXMin
+    }
+
+    internal func barChartIsDrawHighlightArrowEnabled(renderer: BarChartRenderer) -> Bool
+    {
+        return _drawHighlightArrowEnabled
+    }
+
+    internal func barChartIsDrawValueAboveBarEnabled(renderer: BarChartRenderer) -> Bool
+    {
+        return _drawValueAboveBarEnabled
+    }
+
+    internal func barChartIsDrawBarShadowEnabled(renderer: BarChartRenderer) -> Bool
+    {
+        return _drawBarShadowEnabled
+    }
+
+    internal func barChartIsInverted(renderer: BarChartRenderer, axis: ChartYAxis.AxisDependency) -> Bool
+    {
+        return axis == .Left ? _leftAxisInverted : _rightAxisInverted
+    }
+}
+
+/// Answers with the fill positions the chart's fill formatter gave when the snapshot was taken, by DataSet index.
+internal class ChartSnapshotFillFormatter: NSObject, ChartFillFormatter
+{
+    private let _positions: [CGFloat]
+
+    internal init(positions: [CGFloat])
+    {
+        _positions = positions
+    }
+
+    internal func getFillLinePosition(dataSet dataSet: LineChartDataSet, data: LineChartData, chartMaxY: Double, chartMinY: Double) -> CGFloat
+    {
+        let index = data.indexOfDataSet(dataSet)
+
+        return index >= 0 && index < _positions.count ? _positions[index] : 0.0
+    }
+}
@@ -0,0 +1,137 @@
+//
+//  ChartRangeMinMax.swift
+//  Charts
+//
+//  Copyright 2015 Daniel Cohen Gindi & Philipp Jahoda
+//  A port of MPAndroidChart for iOS
+//  Licensed under Apache License 2.0
+//
+//  https://github.com/danielgindi/ios-charts
+//
+
+import Foundation
+
+/// A segment tree over the per-entry y-extents of a DataSet.
+/// Answers the minimum and maximum of any index range in O(log n), and supports appending in amortized O(log n).
+/// NaN extents are ignored, like in the linear scans it replaces.
+/// The tree is a flat bottom-up layout: leaves live at `_capacity + i`, and node `k` covers nodes `2k` and `2k + 1`.
+internal struct ChartRangeMinMax
+{
+    private var _mins = [Double]()
+    private var _maxs = [Double]()
+    private var _capacity = 0
+    private var _count = 0
+
+    /// the number of entries in the index
+    internal var count: Int { return _count }
+
+    /// Builds the index over `count` entries in O(n).
+    /// - parameter entryMin: the lowest y-value of the entry at an index
+    /// - parameter entryMax: the highest y-value of the entry at an index
+    internal init(count: Int, entryMin: (Int) -> Double, entryMax: (Int) -> Double)
+    {
+        _count = count
+        _capacity = 1
+        while (_capacity < count)
+        {
+            _capacity <<= 1
+        }
+
+        _mins = [Double](count: 2 * _capacity, repeatedValue: DBL_MAX)
+        _maxs = [Double](count: 2 * _capacity, repeatedValue: -DBL_MAX)
+
+        for (var i = 0; i < count; i++)
+        {
+            setLeaf(i, min: entryMin(i), max: entryMax(i))
+        }
+
+        for (var k = _capacity - 1; k > 0; k--)
+        {
+            pull(k)
+        }
+    }
+
+    /// Appends the extents of a new last entry.
+    internal mutating func append(min min: Double, max: Double)
+    {
+        if (_count == _capacity)
+        {
+            grow()
+        }
+
+        setLeaf(_count, min: min, max: max)
+
+        for (var k = (_capacity + _count) >> 1; k > 0; k >>= 1)
+        {
+            pull(k)
+        }
+
+        _count++
+    }
+
+    /// - returns: the minimum and maximum over the entries `start...end`, clamped to the index.
+    /// (DBL_MAX, -DBL_MAX) if the range holds no entries, or only NaN values.
+    internal func minMax(start start: Int, end: Int) -> (min: Double, max: Double)
+    {
+        var yMin = DBL_MAX
+        var yMax = -DBL_MAX
+
+        var lo = Swift.max(start, 0) + _capacity
+        var hi = Swift.min(end, _count - 1) + _capacity + 1
+
+        while (lo < hi)
+        {
+            if (lo & 1 == 1)
+            {
+                yMin = Swift.min(yMin, _mins[lo])
+                yMax = Swift.max(yMax, _maxs[lo])
+                lo++
+            }
+            if (hi & 1 == 1)
+            {
+                hi--
+                yMin = Swift.min(yMin, _mins[hi])
+                yMax = Swift.max(yMax, _maxs[hi])
+            }
+            lo >>= 1
+            hi >>= 1
+        }
+
+        return (yMin, yMax)
+    }
+
+    private mutating func setLeaf(index: Int, min: Double, max: Double)
+    {
+        _mins[_capacity + index] = min.isNaN ? DBL_MAX : min
+        _maxs[_capacity + index] = max.isNaN ? -DBL_MAX : max
+    }
+
+    private mutating func pull(k: Int)
+    {
+        _mins[k] = Swift.min(_mins[2 * k], _mins[2 * k + 1])
+        _maxs[k] = Swift.max(_maxs[2 * k], _maxs[2 * k + 1])
+    }
+
+    /// Doubles the capacity, moving the leaves and rebuilding the inner nodes.
+    private mutating func grow()
+    {
+        let oldCapacity = _capacity
+        let oldMins = _mins
+        let oldMaxs = _maxs
+
+        _capacity = Swift.max(1, oldCapacity * 2)
+        _mins = [Double](count: 2 * _capacity, repeatedValue: DBL_MAX)
+        _maxs = [Double](count: 2 * _capacity, repeatedValue: -DBL_MAX)
+
+        for (var i = 0; i < _count; i++)
+        {
+            _mins[_capacity + i] = oldMins[oldCapacity + i]
+            _maxs[_capacity + i] = oldMaxs[oldCapacity + i]
+        }
+
+        for (var k = _capacity - 1; k > 0; k--)
+        {
+            pull(k)
+        }
+    }
+}
@@ -0,0 +1,158 @@
+//
+//  ChartSnapshot.swift
+//  Charts
+//
+//  Copyright 2015 Daniel Cohen Gindi & Philipp Jahoda
+//  A port of MPAndroidChart for iOS
+//  Licensed under Apache License 2.0
+//
+//  https://github.com/danielgindi/ios-charts
+//
+
+import Foundation
+import CoreGraphics
+import UIKit
+
+/// An immutable copy of what a chart draws: its data, viewport, highlights and style.
+/// Take one on the main thread with `ChartViewBase.chartSnapshot(transparent:)`; rendering it does not touch the chart view,
+/// so it can run on any thread while the chart keeps changing.
+///
+/// Axes, legend and description are drawn into images when the snapshot is taken, the renderer draws the copied data
+/// when the snapshot is rendered. Markers are not drawn.
+public class ChartSnapshot: NSObject
+{
+    /// the serial queue `ChartViewBase` renders and encodes snapshots on
+    internal static let renderQueue = dispatch_queue_create("com.github.danielgindi.charts.snapshot", DISPATCH_QUEUE_SERIAL)
+
+    internal let _size: CGSize
+    internal let _scale: CGFloat
+    internal let _opaque: Bool
+    internal let _backgroundColor: UIColor?
+
+    internal let _viewPortHandler: ChartViewPortHandler
+    internal let _animator = ChartAnimator()
+    internal let _data: ChartData
+    internal let _indicesToHighlight: [ChartHighlight]
+
+    /// the renderer drawing the copied data, set up by subclasses with the snapshot as its delegate
+    internal var _renderer: ChartDataRendererBase!
+
+    /// what the chart draws behind and in front of the data, drawn when the snapshot is taken
+    internal var _backgroundImage: UIImage?
+    internal var _foregroundImage: UIImage?
+
+    /// - parameter viewPortHandler: a copy of the chart's viewport, for the snapshot to keep
+    internal init(chart: ChartViewBase, viewPortHandler: ChartViewPortHandler, transparent: Bool)
+    {
+        _size = chart.bounds.size
+        _scale = UIScreen.mainScreen().scale
+        _opaque = chart.opaque || !transparent
+        _backgroundColor = chart.backgroundColor
+
+        _viewPortHandler = viewPortHandler
+        _animator.phaseX = chart.animator.phaseX
+        _animator.phaseY = chart.animator.phaseY
+
+        _data = ChartSnapshot.copyData(chart.data!)
+        _indicesToHighlight = chart.highlighted
+
+        super.init()
+    }
+
+    /// - returns: the chart drawn into a bitmap, like `ChartViewBase.getChartImage(transparent:)`. Can be called on any thread.
+    public func renderImage() -> UIImage
+    {
+        UIGraphicsBeginImageContextWithOptions(_size, _opaque, _scale)
+
+        let context = UIGraphicsGetCurrentContext()
+        let rect = CGRect(origin: CGPoint(x: 0, y: 0), size: _size)
+
+        if (_opaque)
+        {
+            // Background color may be partially transparent, we must fill with white if we want to output an opaque image
+            CGContextSetFillColorWithColor(context, UIColor.whiteColor().CGColor)
+            CGContextFillRect(context, rect)
+        }
+
+        if (_backgroundColor !== nil)
+        {
+            CGContextSetFillColorWithColor(context, _backgroundColor!.CGColor)
+            CGContextFillRect(context, rect)
+        }
+
+        drawChart(context: context)
+
+        let image = UIGraphicsGetImageFromCurrentImageContext()
+
+        UIGraphicsEndImageContext()
+
+        return image
+    }
+
+    /// Draws the layers in the order the chart's `drawRect` does. Subclasses override this.
+    internal func drawChart(context context: CGContext?)
+    {
+        _backgroundImage?.drawInRect(CGRect(origin: CGPoint(x: 0, y: 0), size: _size))
+
+        _renderer.drawData(context: context)
+
+        if (!_indicesToHighlight.isEmpty)
+        {
+            _renderer.drawHighlighted(context: context, indices: _indicesToHighlight)
+        }
+
+        _renderer.drawExtras(context: context)
+
+        _renderer.drawValues(context: context)
+
+        _foregroundImage?.drawInRect(CGRect(origin: CGPoint(x: 0, y: 0), size: _size))
+    }
+
+    /// - returns: an image the size of the snapshot, with what `drawing` draws into its context
+    internal func drawLayer(drawing: (CGContext?) -> Void) -> UIImage?
+    {
+        UIGraphicsBeginImageContextWithOptions(_size, false, _scale)
+        drawing(UIGraphicsGetCurrentContext())
+        let image = UIGraphicsGetImageFromCurrentImageContext()
+        UIGraphicsEndImageContext()
+
+        return image
+    }
+
+    /// - returns: a copy of `data` holding copies of its DataSets and their entries, so later changes to the chart's data do not reach the snapshot.
+    /// Columnar DataSets share their buffers, which are copied on write.
+    internal static func copyData(data: ChartData) -> ChartData
+    {
+        var dataSets = [ChartDataSet]()
+        dataSets.reserveCapacity(data.dataSetCount)
+
+        for set in data.dataSets
+        {
+            let copy = set.copy() as! ChartDataSet
+
+            if (!set.isColumnar)
+            {
+                copy._yVals = set.yVals.map { $0.copy() as! ChartDataEntry }
+            }
+
+            dataSets.append(copy)
+        }
+
+        if let barData = data as? BarChartData
+        {
+            let copy = BarChartData(xVals: data.xVals, dataSets: dataSets)
+            copy.groupSpace = barData.groupSpace
+            return copy
+        }
+        else if (data is LineChartData)
+        {
+            return LineChartData(xVals: data.xVals, dataSets: dataSets)
+        }
+        else if (data is PieChartData)
+        {
+            return PieChartData(xVals: data.xVals, dataSets: dataSets)
+        }
+
+        return ChartData(xVals: data.xVals, dataSets: dataSets)
+    }
+}
@@ -0,0 +1,212 @@
+//
+//  ChartTextCache.swift
+//  Charts
+//
+//  Copyright 2015 Daniel Cohen Gindi & Philipp Jahoda
+//  A port of MPAndroidChart for iOS
+//  Licensed under Apache License 2.0
+//
+//  https://github.com/danielgindi/ios-charts
+//
+
+import Foundation
+import CoreText
+import UIKit
+
+/// A least-recently-used cache of measured text sizes and laid out glyph runs (CTLine), shared by all charts.
+/// Axis labels, legend entries and values repeat the same few strings on every layout and redraw;
+/// the cache makes measuring and laying them out a dictionary lookup after the first time.
+/// Safe to use from any thread.
+internal class ChartTextCache
+{
+    internal static let sharedCache = ChartTextCache(capacity: 1024)
+
+    private class Node
+    {
+        let key: String
+        var size = CGSize()
+        var line: CTLine?
+
+        var newer: Node?
+        weak var older: Node?
+
+        init(key: String)
+        {
+            self.key = key
+        }
+    }
+
+    /// the maximum number of entries, the least recently used ones are dropped beyond it
+    internal let capacity: Int
+
+    private var _nodes = [String: Node]()
+
+    /// the least and most recently used nodes
+    private var _oldest: Node?
+    private var _newest: Node?
+
+    private let _lock = NSLock()
+
+    /// lookups answered from the cache, and lookups that had to measure or lay out text
+    private var _hits = 0
+    private var _misses = 0
+
+    internal init(capacity: Int)
+    {
+        self.capacity = max(capacity, 1)
+    }
+
+    internal var count: Int
+    {
+        _lock.lock()
+        defer { _lock.unlock() }
+        return _nodes.count
+    }
+
+    internal var hits: Int
+    {
+        _lock.lock()
+        defer { _lock.unlock() }
+        return _hits
+    }
+
+    internal var misses: Int
+    {
+        _lock.lock()
+        defer { _lock.unlock() }
+        return _misses
+    }
+
+    internal func removeAll()
+    {
+        _lock.lock()
+        defer { _lock.unlock() }
+
+        _nodes.removeAll()
+        _oldest = nil
+        _newest = nil
+        _hits = 0
+        _misses = 0
+    }
+
+    /// - returns: the size of `text` drawn with `attributes`: on a single line if `constrainedToSize` is nil,
+    /// otherwise wrapped like `boundingRectWithSize(_:options: .UsesLineFragmentOrigin, ...)`.
+    internal func size(text text: String, attributes: [String : AnyObject]?, constrainedToSize: CGSize? = nil) -> CGSize
+    {
+        var key = "s\u{0}"
+        ChartTextCache.appendKey(&key, attributes: attributes)
+        if let constraint = constrainedToSize
+        {
+            key += "\(constraint.width)\u{0}\(constraint.height)\u{0}"
+        }
+        key += text
+
+        return node(key: key) { node in
+            if let constraint = constrainedToSize
+            {
+                node.size = (text as NSString).boundingRectWithSize(constraint, options: .UsesLineFragmentOrigin, attributes: attributes, context: nil).size
+            }
+            else
+            {
+                node.size = (text as NSString).sizeWithAttributes(attributes)
+            }
+        }.size
+    }
+
+    /// - returns: `text` laid out on a single line with `font` and `color`, and the line's size
+    internal func line(text text: String, font: UIFont, color: UIColor) -> (line: CTLine, size: CGSize)
+    {
+        let key = "l\u{0}\(font.fontName)\u{0}\(font.pointSize)\u{0}\(color)\u{0}\(text)"
+
+        let node = self.node(key: key) { node in
+            let attributed = NSAttributedString(string: text, attributes: [
+                kCTFontAttributeName as String: font,
+                kCTForegroundColorAttributeName as String: color.CGColor])
+
+            let line = CTLineCreateWithAttributedString(attributed)
+            node.line = line
+            node.size = CGSize(width: CGFloat(CTLineGetTypographicBounds(line, nil, nil, nil)), height: font.lineHeight)
+        }
+
+        return (node.line!, node.size)
+    }
+
+    /// - returns: the node for `key`, made the most recently used one; created with `fill` if it is not cached
+    private func node(key key: String, fill: (Node) -> Void) -> Node
+    {
+        _lock.lock()
+        defer { _lock.unlock() }
+
+        if let node = _nodes[key]
+        {
+            _hits++
+            unlink(node)
+            append(node)
+            return node
+        }
+
+        _misses++
+
+        let node = Node(key: key)
+        fill(node)
+
+        _nodes[key] = node
+        append(node)
+
+        if (_nodes.count > capacity)
+        {
+            let oldest = _oldest!
+            unlink(oldest)
+            _nodes.removeValueForKey(oldest.key)
+        }
+
+        return node
+    }
+
+    private func append(node: Node)
+    {
+        node.older = _newest
+        node.newer = nil
+        _newest?.newer = node
+        _newest = node
+
+        if (_oldest == nil)
+        {
+            _oldest = node
+        }
+    }
+
+    private func unlink(node: Node)
+    {
+        if (_oldest === node)
+        {
+            _oldest = node.newer
+        }
+        if (_newest === node)
+        {
+            _newest = node.older
+        }
+
+        node.older?.newer = node.newer
+        node.newer?.older = node.older
+        node.older = nil
+        node.newer = nil
+    }
+
+    /// Appends the attributes that change a measured size to `key`: the font and the paragraph style.
+    private static func appendKey(inout key: String, attributes: [String : AnyObject]?)
+    {
+        if let font = attributes?[NSFontAttributeName] as? UIFont
+        {
+            key += "\(font.fontName)\u{0}\(font.pointSize)\u{0}"
+        }
+        if let paragraphStyle = attributes?[NSParagraphStyleAttributeName] as? NSParagraphStyle
+        {
+            key += "\(paragraphStyle.hash)\u{0}"
+        }
+        if let kern = attributes?[NSKernAttributeName] as? NSNumber
+        {
+            key += "k\(kern)\u{0}"
+        }
+    }
+}
@@ -13,6 +13,7 @@
 
 import Foundation
 import CoreGraphics
+import Accelerate
 
 /// Transformer class that contains all matrices and is responsible for transforming values into pixels on the screen and backwards.
 public class ChartTransformer: NSObject
@@ -25,10 +26,19 @@ public class ChartTransformer: NSObject
 
     internal var _viewPortHandler: ChartViewPortHandler
 
-    public init(viewPortHandler: ChartViewPortHandler)
+    public required init(viewPortHandler: ChartViewPortHandler)
     {
         _viewPortHandler = viewPortHandler
     }
+    
+    /// - returns: a transformer of the same class with the same matrices, mapping into `viewPortHandler` instead
+    internal func copy(viewPortHandler viewPortHandler: ChartViewPortHandler) -> ChartTransformer
+    {
+        let copy = self.dynamicType.init(viewPortHandler: viewPortHandler)
+        copy._matrixValueToPx = _matrixValueToPx
+        copy._matrixOffset = _matrixOffset
+        return copy
+    }
 
     /// Prepares the matrix that transforms values to pixels. Calculates the scale factors from the charts size and offsets.
     public func prepareMatrixValuePx(chartXMin chartXMin: Double, deltaX: CGFloat, deltaY: CGFloat, chartYMin: Double)
@@ -65,10 +75,10 @@ public class ChartTransformer: NSObject
         for (var j = 0; j < entries.count; j++)
         {
             let e = entries[j]
-            valuePoints.append(CGPoint(x: CGFloat(e.xIndex), y: CGFloat(e.value) * phaseY))
+            valuePoints.append(CGPoint(x: CGFloat(e.xIndex), y: CGFloat(e.value)))
         }
 
-        pointValuesToPixel(&valuePoints)
+        pointValuesToPixel(&valuePoints, count: valuePoints.count, phaseY: phaseY)
 
         return valuePoints
     }
@@ -94,21 +104,65 @@ public class ChartTransformer: NSObject
 
     /// Transforms an arraylist of Entry into a double array containing the x and y values transformed with all matrices for the LINECHART.
     public func generateTransformedValuesLine(entries: [ChartDataEntry], phaseX: CGFloat, phaseY: CGFloat, from: Int, to: Int) -> [CGPoint]
+    {
+        var valuePoints = [CGPoint]()
+        let count = transformValuesLine(entries, phaseX: phaseX, phaseY: phaseY, from: from, to: to, buffer: &valuePoints)
+        valuePoints.removeRange(count..<valuePoints.count)
+        return valuePoints
+    }
+    
+    /// Same as `generateTransformedValuesLine(_:phaseX:phaseY:from:to:)`, for a columnar DataSet.
+    internal func generateTransformedValuesLine(columns: ChartDataColumns, phaseX: CGFloat, phaseY: CGFloat, from: Int, to: Int) -> [CGPoint]
+    {
+        var valuePoints = [CGPoint]()
+        let count = transformValuesLine(columns, phaseX: phaseX, phaseY: phaseY, from: from, to: to, buffer: &valuePoints)
+        valuePoints.removeRange(count..<valuePoints.count)
+        return valuePoints
+    }
+    
+    /// Like `generateTransformedValuesLine(_:phaseX:phaseY:from:to:)`, but writes into `buffer` instead of a new array.
+    /// The buffer only grows, so a renderer can keep one around and reuse it every frame.
+    /// - returns: the number of points written to the start of `buffer`
+    public func transformValuesLine(entries: [ChartDataEntry], phaseX: CGFloat, phaseY: CGFloat, from: Int, to: Int, inout buffer: [CGPoint]) -> Int
     {
         let count = Int(ceil(CGFloat(to - from) * phaseX))
         
-        var valuePoints = [CGPoint]()
-        valuePoints.reserveCapacity(count)
-
+        if (buffer.count < count)
+        {
+            buffer = [CGPoint](count: count, repeatedValue: CGPoint())
+        }
+        
         for (var j = 0; j < count; j++)
         {
             let e = entries[j + from]
-            valuePoints.append(CGPoint(x: CGFloat(e.xIndex), y: CGFloat(e.value) * phaseY))
+            buffer[j].x = CGFloat(e.xIndex)
+            buffer[j].y = CGFloat(e.value)
         }
-
-        pointValuesToPixel(&valuePoints)
-
-        return valuePoints
+        
+        pointValuesToPixel(&buffer, count: count, phaseY: phaseY)
+        
+        return count
+    }
+    
+    /// Same as `transformValuesLine(_:phaseX:phaseY:from:to:buffer:)`, for a columnar DataSet.
+    internal func transformValuesLine(columns: ChartDataColumns, phaseX: CGFloat, phaseY: CGFloat, from: Int, to: Int, inout buffer: [CGPoint]) -> Int
+    {
+        let count = Int(ceil(CGFloat(to - from) * phaseX))
+        
+        if (buffer.count < count)
+        {
+            buffer = [CGPoint](count: count, repeatedValue: CGPoint())
+        }
+        
+        for (var j = 0; j < count; j++)
+        {
+            buffer[j].x = CGFloat(columns.xIndices[j + from])
+            buffer[j].y = CGFloat(columns.values[j + from])
+        }
+        
+        pointValuesToPixel(&buffer, count: count, phaseY: phaseY)
+        
+        return count
     }
     
     /// Transforms an arraylist of Entry into a double array containing the x and y values transformed with all matrices for the CANDLESTICKCHART.
@@ -120,10 +174,10 @@ public class ChartTransformer: NSObject
         for (var j = 0; j < entries.count; j++)
         {
             let e = entries[j]
-            valuePoints.append(CGPoint(x: CGFloat(e.xIndex), y: CGFloat(e.high) * phaseY))
+            valuePoints.append(CGPoint(x: CGFloat(e.xIndex), y: CGFloat(e.high)))
         }
         
-        pointValuesToPixel(&valuePoints)
+        pointValuesToPixel(&valuePoints, count: valuePoints.count, phaseY: phaseY)
         
         return valuePoints
     }
@@ -183,13 +237,78 @@ public class ChartTransformer: NSObject
     // VERY IMPORTANT: Keep matrix order "value-touch-offset" when transforming.
     public func pointValuesToPixel(inout pts: [CGPoint])
     {
-        let trans = valueToPixelMatrix
-        for (var i = 0, count = pts.count; i < count; i++)
+        ChartTransformer.applyTransform(valueToPixelMatrix, points: &pts, count: pts.count)
+    }
+    
+    /// Transform the first `count` points of an array with all matrices, multiplying the y-values with the animation phase first.
+    /// The phase is folded into the matrix, and the points are transformed in one vectorized pass.
+    public func pointValuesToPixel(inout pts: [CGPoint], count: Int, phaseY: CGFloat)
+    {
+        let trans = phaseY == 1.0
+            ? valueToPixelMatrix
+            : CGAffineTransformConcat(CGAffineTransformMakeScale(1.0, phaseY), valueToPixelMatrix)
+        
+        ChartTransformer.applyTransform(trans, points: &pts, count: min(count, pts.count))
+    }
+    
+    /// Applies `trans` in place to `count` points.
+    /// The value-to-pixel matrix only scales and translates, so x and y are mapped separately with vDSP, straight on the interleaved CGPoint buffer.
+    /// Rotated or skewed matrices fall back to CGPointApplyAffineTransform.
+    internal static func applyTransform(trans: CGAffineTransform, points: UnsafeMutablePointer<CGPoint>, count: Int)
+    {
+        if (count <= 0)
         {
-            pts[i] = CGPointApplyAffineTransform(pts[i], trans)
+            return
         }
+        
+        if (trans.b != 0.0 || trans.c != 0.0)
+        {
+            for (var i = 0; i < count; i++)
+            {
+                points[i] = CGPointApplyAffineTransform(points[i], trans)
+            }
+            return
+        }
+        
+        let length = vDSP_Length(count)
+        
+        #if arch(x86_64) || arch(arm64)
+        let p = UnsafeMutablePointer<Double>(points)
+        var a = Double(trans.a), tx = Double(trans.tx)
+        var d = Double(trans.d), ty = Double(trans.ty)
+        
+        vDSP_vsmsaD(p, 2, &a, &tx, p, 2, length)
+        vDSP_vsmsaD(p + 1, 2, &d, &ty, p + 1, 2, length)
+        #else
+        let p = UnsafeMutablePointer<Float>(points)
+        var a = Float(trans.a), tx = Float(trans.tx)
+        var d = Float(trans.d), ty = Float(trans.ty)
+        
+        vDSP_vsmsa(p, 2, &a, &tx, p, 2, length)
+        vDSP_vsmsa(p + 1, 2, &d, &ty, p + 1, 2, length)
+        #endif
     }
-    
+
+    /// Writes `from + t * (to - from)` for `count` points into `result`, in one vectorized pass over the interleaved coordinates.
+    /// As the matrices are affine, interpolating the pixel positions of phase 0 and 1 by `t` gives the pixel positions of phase `t`.
+    internal static func interpolatePoints(from: UnsafePointer<CGPoint>, to: UnsafePointer<CGPoint>, t: CGFloat, result: UnsafeMutablePointer<CGPoint>, count: Int)
+    {
+        if (count <= 0)
+        {
+            return
+        }
+
+        let length = vDSP_Length(count * 2)
+
+        #if arch(x86_64) || arch(arm64)
+        var t = Double(t)
+        vDSP_vintbD(UnsafePointer<Double>(from), 1, UnsafePointer<Double>(to), 1, &t, UnsafeMutablePointer<Double>(result), 1, length)
+        #else
+        var t = Float(t)
+        vDSP_vintb(UnsafePointer<Float>(from), 1, UnsafePointer<Float>(to), 1, &t, UnsafeMutablePointer<Float>(result), 1, length)
+        #endif
+    }
+
     public func pointValueToPixel(inout point: CGPoint)
     {
         point = CGPointApplyAffineTransform(point, valueToPixelMatrix)
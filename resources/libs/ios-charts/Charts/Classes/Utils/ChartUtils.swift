@@ -14,6 +14,7 @@
 
 import Foundation
 import UIKit
+import CoreText
 import Darwin
 
 internal class ChartUtils
@@ -120,13 +121,45 @@ internal class ChartUtils
     
     internal class func drawText(context context: CGContext?, text: String, var point: CGPoint, align: NSTextAlignment, attributes: [String : AnyObject]?)
     {
+        if (text.isEmpty)
+        {
+            return
+        }
+        
+        // plain font and color text on a single line is drawn from a cached line, measured and laid out once.
+        // A CTLine does not break lines, so text with line breaks goes through UIKit.
+        if let font = attributes?[NSFontAttributeName] as? UIFont
+            where (attributes!.count == 1 || (attributes!.count == 2 && attributes![NSForegroundColorAttributeName] is UIColor))
+                && text.rangeOfCharacterFromSet(NSCharacterSet.newlineCharacterSet()) == nil
+        {
+            let color = attributes![NSForegroundColorAttributeName] as? UIColor ?? UIColor.blackColor()
+            let cached = ChartTextCache.sharedCache.line(text: text, font: font, color: color)
+            
+            if (align == .Center)
+            {
+                point.x -= cached.size.width / 2.0
+            }
+            else if (align == .Right)
+            {
+                point.x -= cached.size.width
+            }
+            
+            // lines are drawn from the baseline, in a context flipped like UIKit's
+            let textMatrix = CGContextGetTextMatrix(context)
+            CGContextSetTextMatrix(context, CGAffineTransformMakeScale(1.0, -1.0))
+            CGContextSetTextPosition(context, point.x, point.y + font.ascender)
+            CTLineDraw(cached.line, context!)
+            CGContextSetTextMatrix(context, textMatrix)
+            return
+        }
+        
         if (align == .Center)
         {
-            point.x -= text.sizeWithAttributes(attributes).width / 2.0
+            point.x -= ChartTextCache.sharedCache.size(text: text, attributes: attributes).width / 2.0
         }
         else if (align == .Right)
         {
-            point.x -= text.sizeWithAttributes(attributes).width
+            point.x -= ChartTextCache.sharedCache.size(text: text, attributes: attributes).width
         }
     
         UIGraphicsPushContext(context)
@@ -156,8 +189,8 @@ internal class ChartUtils
     
     internal class func drawMultilineText(context context: CGContext?, text: String, point: CGPoint, align: NSTextAlignment, attributes: [String : AnyObject]?, constrainedToSize: CGSize)
     {
-        let rect = text.boundingRectWithSize(constrainedToSize, options: .UsesLineFragmentOrigin, attributes: attributes, context: nil)
-        drawMultilineText(context: context, text: text, knownTextSize: rect.size, point: point, align: align, attributes: attributes, constrainedToSize: constrainedToSize)
+        let size = ChartTextCache.sharedCache.size(text: text, attributes: attributes, constrainedToSize: constrainedToSize)
+        drawMultilineText(context: context, text: text, knownTextSize: size, point: point, align: align, attributes: attributes, constrainedToSize: constrainedToSize)
     }
     
     /// - returns: an angle between 0.0 < 360.0 (not less than zero, less than 360)
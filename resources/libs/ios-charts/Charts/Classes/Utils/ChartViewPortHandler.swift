@@ -14,7 +14,7 @@
 import Foundation
 import CoreGraphics
 
-public class ChartViewPortHandler: NSObject
+public class ChartViewPortHandler: NSObject, NSCopying
 {
     /// matrix used for touch events
     private var _touchMatrix = CGAffineTransformIdentity
@@ -457,4 +457,26 @@ public class ChartViewPortHandler: NSObject
     {
         return (_scaleX < _maxScaleX)
     }
+    
+    // MARK: NSCopying
+    
+    public func copyWithZone(zone: NSZone) -> AnyObject
+    {
+        let copy = ChartViewPortHandler()
+        copy._touchMatrix = _touchMatrix
+        copy._contentRect = _contentRect
+        copy._chartWidth = _chartWidth
+        copy._chartHeight = _chartHeight
+        copy._minScaleY = _minScaleY
+        copy._maxScaleY = _maxScaleY
+        copy._minScaleX = _minScaleX
+        copy._maxScaleX = _maxScaleX
+        copy._scaleX = _scaleX
+        copy._scaleY = _scaleY
+        copy._transX = _transX
+        copy._transY = _transY
+        copy._transOffsetX = _transOffsetX
+        copy._transOffsetY = _transOffsetY
+        return copy
+    }
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+//
+//  PieChartSnapshot.swift
+//  Charts
+//
+//  Copyright 2015 Daniel Cohen Gindi & Philipp Jahoda
+//  A port of MPAndroidChart for iOS
+//  Licensed under Apache License 2.0
+//
+//  https://github.com/danielgindi/ios-charts
+//
+
+import Foundation
+import CoreGraphics
+import UIKit
+
+/// Snapshot of a pie chart (`PieChartRenderer`).
+internal class PieChartSnapshot: ChartSnapshot, PieChartRendererDelegate
+{
+    private let _circleBox: CGRect
+    private let _rotationAngle: CGFloat
+    private let _drawAngles: [CGFloat]
+    private let _absoluteAngles: [CGFloat]
+    private let _valueFormatter: NSNumberFormatter
+
+    internal init(chart: PieChartView, transparent: Bool)
+    {
+        _circleBox = chart.circleBox
+        _rotationAngle = chart.rotationAngle
+        _drawAngles = chart.drawAngles
+        _absoluteAngles = chart.absoluteAngles
+        _valueFormatter = chart.valueFormatter.copy() as! NSNumberFormatter
+
+        super.init(chart: chart, viewPortHandler: chart.viewPortHandler.copy() as! ChartViewPortHandler, transparent: transparent)
+
+        _foregroundImage = drawLayer { context in
+            chart._legendRenderer.renderLegend(context: context)
+            chart.drawDescription(context: context)
+        }
+
+        let live = chart.renderer as! PieChartRenderer
+        let renderer = PieChartRenderer(delegate: self, animator: _animator, viewPortHandler: _viewPortHandler)
+        renderer.drawHoleEnabled = live.drawHoleEnabled
+        renderer.holeTransparent = live.holeTransparent
+        renderer.holeColor = live.holeColor
+        renderer.holeRadiusPercent = live.holeRadiusPercent
+        renderer.transparentCircleRadiusPercent = live.transparentCircleRadiusPercent
+        renderer.centerTextColor = live.centerTextColor
+        renderer.centerTextFont = live.centerTextFont
+        renderer.drawXLabelsEnabled = live.drawXLabelsEnabled
+        renderer.usePercentValuesEnabled = live.usePercentValuesEnabled
+        renderer.centerText = live.centerText
+        renderer.drawCenterTextEnabled = live.drawCenterTextEnabled
+        renderer.centerTextLineBreakMode = live.centerTextLineBreakMode
+        renderer.centerTextRadiusPercent = live.centerTextRadiusPercent
+        _renderer = renderer
+    }
+
+    // MARK: - PieChartRendererDelegate
+
+    internal func pieChartRendererData(renderer: PieChartRenderer) -> ChartData!
+    {
+        return _data
+    }
+
+    internal func pieChartRendererCircleBox(renderer: PieChartRenderer) -> CGRect
+    {
+        return _circleBox
+    }
+
+    internal func pieChartRendererRotationAngle(renderer: PieChartRenderer) -> CGFloat
+    {
+        return _rotationAngle
+    }
+
+    internal func pieChartRendererDrawAngles(renderer: PieChartRenderer) -> [CGFloat]
+    {
+        return _drawAngles
+    }
+
+    internal func pieChartRendererAbsoluteAngles(renderer: PieChartRenderer) -> [CGFloat]
+    {
+        return _absoluteAngles
+    }
+
+    internal func pieChartDefaultRendererValueFormatter(renderer: PieChartRenderer) -> NSNumberFormatter!
+    {
+        return _valueFormatter
+    }
+
+    internal func pieChartRenderer(renderer: PieChartRenderer, needsHighlightXIndex xIndex: Int, dataSetIndex: Int) -> Bool
+    {
+        if (dataSetIndex < 0)
+        {
+            return false
+        }
+
+        for high in _indicesToHighlight
+        {
+            if (high.xIndex == xIndex && high.dataSetIndex == dataSetIndex)
+            {
+                return true
+            }
+        }
+
+        return false
+    }
+}